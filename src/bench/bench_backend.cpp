@@ -0,0 +1,67 @@
+#include <chrono>
+#include <cstdio>
+
+#include "s21_backend.h"
+#include "s21_matrix_oop.h"
+
+namespace {
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Время одного вызова fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Матрица с псевдослучайными элементами и преобладающей диагональю
+S21Matrix Random(int n) {
+  S21Matrix m(n, n);
+  unsigned state = 12345;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      state = state * 1103515245u + 12345u;
+      m(i, j) = (state >> 8) * 0x1p-23 - 1.0;
+    }
+    m(i, i) += n;
+  }
+  return m;
+}
+
+// Время умножения, определителя и обращения на выбранном бэкенде
+void Measure(const S21Matrix& a, S21Backend backend, double* times) {
+  S21LinearAlgebra::set_backend(backend);
+  times[0] = Milliseconds([&]() { sink = (a * a)(0, 0); });
+  // Копии сбрасывают кэш LU, чтобы разложение выполнялось заново
+  S21Matrix det_copy = a;
+  det_copy(0, 0) += 0.0;
+  times[1] = Milliseconds([&]() { sink = det_copy.Determinant(); });
+  S21Matrix inverse_copy = a;
+  inverse_copy(0, 0) += 0.0;
+  times[2] = Milliseconds([&]() { sink = inverse_copy.InverseMatrix()(0, 0); });
+}
+}  // namespace
+
+int main() {
+  if (!S21LinearAlgebra::IsAvailable(S21Backend::kOpenBlas)) {
+    std::printf("OpenBLAS is not installed, only the builtin backend runs\n");
+  }
+  std::printf("%-6s %-9s %12s %12s %12s\n", "n", "backend", "MulMatrix",
+              "Determinant", "Inverse");
+  for (int n : {128, 256, 512}) {
+    S21Matrix a = Random(n);
+    for (S21Backend backend : {S21Backend::kBuiltin, S21Backend::kOpenBlas}) {
+      double times[3];
+      Measure(a, backend, times);
+      std::printf("%-6d %-9s %9.3f ms %9.3f ms %9.3f ms\n", n,
+                  S21LinearAlgebra::get_backend() == S21Backend::kOpenBlas
+                      ? "openblas"
+                      : "builtin",
+                  times[0], times[1], times[2]);
+    }
+  }
+  return 0;
+}
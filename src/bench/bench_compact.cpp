@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstdio>
+
+#include "s21_compact_matrix.h"
+
+namespace {
+constexpr int kRepeats = 5;
+
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Среднее время одного вызова fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < kRepeats; ++r) fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count() /
+         kRepeats;
+}
+
+// Матрица с псевдослучайными элементами из [-1, 1)
+S21Matrix Random(int rows, int cols, unsigned state) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      state = state * 1103515245u + 12345u;
+      m(i, j) = (state >> 8) * 0x1p-23 - 1.0;
+    }
+  }
+  return m;
+}
+}  // namespace
+
+int main() {
+  // Умножение на вектор упирается в пропускную способность памяти
+  std::printf("%-6s %12s %12s %12s %12s\n", "n", "double", "fp16 simd",
+              "fp16 scalar", "bf16 simd");
+  for (int n : {1024, 2048, 4096}) {
+    S21Matrix a = Random(n, n, 1);
+    S21Vector x(n);
+    for (int i = 0; i < n; ++i) x(i) = a(0, i);
+    S21CompactMatrix half(a, S21Precision::kHalf);
+    S21CompactMatrix bf16(a, S21Precision::kBFloat16);
+    double dense = Milliseconds([&]() { sink = a.MulVector(x)(0); });
+    double simd = Milliseconds([&]() { sink = half.MulVector(x)(0); });
+    double bf16_time = Milliseconds([&]() { sink = bf16.MulVector(x)(0); });
+    S21CompactMatrix::set_simd_enabled(false);
+    double scalar = Milliseconds([&]() { sink = half.MulVector(x)(0); });
+    S21CompactMatrix::set_simd_enabled(true);
+    std::printf("%-6d %9.3f ms %9.3f ms %9.3f ms %9.3f ms\n", n, dense, simd,
+                scalar, bf16_time);
+  }
+
+  // Произведение матриц: обе в 16 битах или левая в 16 битах
+  std::printf("\n%-6s %12s %12s %12s\n", "n", "double", "fp16 x fp16",
+              "fp16 x dbl");
+  for (int n : {256, 512}) {
+    S21Matrix a = Random(n, n, 2);
+    S21Matrix b = Random(n, n, 3);
+    S21CompactMatrix ca(a, S21Precision::kHalf);
+    S21CompactMatrix cb(b, S21Precision::kHalf);
+    double dense = Milliseconds([&]() { sink = (a * b)(0, 0); });
+    double compact = Milliseconds([&]() { sink = ca.MulMatrix(cb)(0, 0); });
+    double mixed = Milliseconds([&]() { sink = ca.MulMatrix(b)(0, 0); });
+    std::printf("%-6d %9.3f ms %9.3f ms %9.3f ms\n", n, dense, compact,
+                mixed);
+  }
+  return 0;
+}
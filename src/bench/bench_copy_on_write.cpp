@@ -0,0 +1,44 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+constexpr int kCopies = 2000;
+
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Среднее время одной копии в наносекундах для типичной нагрузки очереди:
+// каждая копия только читается, каждая десятая дополнительно изменяется.
+double NanosecondsPerCopy(const S21Matrix& source) {
+  std::vector<S21Matrix> queue;
+  queue.reserve(kCopies);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kCopies; ++i) queue.push_back(source);
+  double sum = 0.0;
+  for (int i = 0; i < kCopies; ++i) {
+    const S21Matrix& item = queue[i];
+    sum += item(i % item.get_rows(), 0);
+    if (i % 10 == 0) queue[i](0, 0) = sum;
+  }
+  queue.clear();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  sink = sum;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / kCopies;
+}
+}  // namespace
+
+int main() {
+  std::printf("%-6s %14s %16s\n", "n", "deep copy", "copy-on-write");
+  for (int n : {8, 32, 128, 256}) {
+    S21Matrix source(n, n);
+    for (int i = 0; i < n; ++i) source(i, i) = 1.0;
+    double deep = NanosecondsPerCopy(source);
+    source.set_copy_on_write(true);
+    double shared = NanosecondsPerCopy(source);
+    std::printf("%-6d %11.1f ns %13.1f ns\n", n, deep, shared);
+  }
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <cstdio>
+
+#include "s21_eigen.h"
+
+namespace {
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Время одного вызова fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Симметричная матрица с псевдослучайными элементами из [-1, 1)
+S21Matrix RandomSymmetric(int n) {
+  S21Matrix m(n, n);
+  unsigned state = 12345;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      state = state * 1103515245u + 12345u;
+      m(i, j) = m(j, i) = (state >> 8) * 0x1p-23 - 1.0;
+    }
+  }
+  return m;
+}
+}  // namespace
+
+int main() {
+  std::printf("%-6s %14s %14s %14s %14s\n", "n", "values", "full",
+              "Lanczos k=5", "rSVD k=5");
+  for (int n : {100, 300, 600}) {
+    S21Matrix m = RandomSymmetric(n);
+    double values = Milliseconds(
+        [&]() { sink = S21Eigen::Symmetric(m, false).values(0); });
+    double full =
+        Milliseconds([&]() { sink = S21Eigen::Symmetric(m).values(0); });
+    double lanczos =
+        Milliseconds([&]() { sink = S21Eigen::Lanczos(m, 5).values(0); });
+    double svd =
+        Milliseconds([&]() { sink = S21Eigen::RandomizedSvd(m, 5).values(0); });
+    std::printf("%-6d %11.3f ms %11.3f ms %11.3f ms %11.3f ms\n", n, values,
+                full, lanczos, svd);
+  }
+  return 0;
+}
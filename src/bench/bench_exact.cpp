@@ -0,0 +1,46 @@
+#include <chrono>
+#include <cstdio>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Время одного вызова fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Матрица смежности случайного графа с вероятностью ребра 1/4
+S21Matrix Adjacency(int n) {
+  S21Matrix m(n, n);
+  unsigned state = 12345;
+  for (int i = 0; i < n; ++i) {
+    for (int j = i + 1; j < n; ++j) {
+      state = state * 1103515245u + 12345u;
+      if ((state >> 16) % 4 == 0) m(i, j) = m(j, i) = 1.0;
+    }
+  }
+  return m;
+}
+}  // namespace
+
+int main() {
+  std::printf("%-6s %12s %18s %10s %10s\n", "n", "LU det", "DeterminantExact",
+              "Rank", "digits");
+  for (int n : {20, 60, 120}) {
+    S21Matrix m = Adjacency(n);
+    double lu = Milliseconds([&]() { sink = m.Determinant(); });
+    S21BigInt det;
+    double exact = Milliseconds([&]() { det = m.DeterminantExact(); });
+    double rank = Milliseconds([&]() { sink = m.Rank(); });
+    std::printf("%-6d %9.3f ms %15.3f ms %7.3f ms %10zu\n", n, lu, exact, rank,
+                det.ToString().size());
+  }
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include <chrono>
+#include <cstdio>
+
+#include "s21_expression.h"
+
+namespace {
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Время одного вызова fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Матрица с псевдослучайными элементами из [-1, 1)
+S21Matrix Random(int rows, int cols, unsigned state) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      state = state * 1103515245u + 12345u;
+      m(i, j) = (state >> 8) * 0x1p-23 - 1.0;
+    }
+  }
+  return m;
+}
+}  // namespace
+
+int main() {
+  // G = A^T A встречается дважды, затем цепочка поэлементных операций
+  std::printf("%-6s %12s %12s %8s %8s\n", "n", "eager", "lazy", "kernels",
+              "fused");
+  for (int n : {64, 128, 256}) {
+    S21Matrix a = Random(2 * n, n, 1);
+    S21Matrix b = Random(n, n, 2);
+    double eager = Milliseconds([&]() {
+      S21Matrix gram = a.Transpose() * a;
+      S21Matrix r = gram * b + b * (a.Transpose() * a) * 0.5 - b * 3.0 + gram;
+      sink = r(0, 0);
+    });
+    S21EvaluationReport report;
+    double lazy = Milliseconds([&]() {
+      S21Expression la(a), lb(b);
+      S21Expression gram = la.Transpose() * la;
+      S21Expression r = gram * lb + lb * (la.Transpose() * la) * 0.5 -
+                        lb * 3.0 + gram;
+      sink = r.Eval(&report)(0, 0);
+    });
+    std::printf("%-6d %9.3f ms %9.3f ms %8zu %8zu\n", n, eager, lazy,
+                report.kernels, report.fused);
+  }
+  return 0;
+}
@@ -0,0 +1,49 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+constexpr int kRepeats = 10;
+
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Среднее время одного шага обновления C += A * B * 0.5 в микросекундах
+template <typename Step>
+double Microseconds(S21Matrix& c, Step step) {
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < kRepeats; ++r) step();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  sink = c(0, 0);
+  return std::chrono::duration<double, std::micro>(elapsed).count() / kRepeats;
+}
+
+S21Matrix Sample(int n, double shift) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) m(i, j) = std::sin(i + j * 0.5 + shift);
+  }
+  return m;
+}
+}  // namespace
+
+int main() {
+  std::printf("%-6s %18s %14s\n", "n", "Mul+MulNumber+Sum", "Gemm");
+  for (int n : {32, 128, 384}) {
+    S21Matrix a = Sample(n, 0.0);
+    S21Matrix b = Sample(n, 1.0);
+    S21Matrix c(n, n);
+    double separate = Microseconds(c, [&]() {
+      S21Matrix product = a;
+      product.MulMatrix(b);
+      product.MulNumber(0.5);
+      c.SumMatrix(product);
+    });
+    double fused =
+        Microseconds(c, [&]() { S21Matrix::Gemm(0.5, a, b, 1.0, c); });
+    std::printf("%-6d %15.1f us %11.1f us\n", n, separate, fused);
+  }
+  return 0;
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "s21_layout.h"
+
+namespace {
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Время одного вызова fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Матрица с псевдослучайными элементами из [-1, 1)
+S21Matrix Random(int n, unsigned state) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      state = state * 1103515245u + 12345u;
+      m(i, j) = (state >> 8) * 0x1p-23 - 1.0;
+    }
+  }
+  return m;
+}
+}  // namespace
+
+int main() {
+  // Транспонирование: наивный цикл против копирования плитками 32 x 32
+  std::printf("%-6s %12s %12s\n", "n", "naive T", "tiled T");
+  for (int n : {512, 1024, 2048}) {
+    S21Matrix a = Random(n, 1);
+    double naive = Milliseconds([&]() {
+      S21Matrix t(n, n);
+      const double* in = a.cbegin();
+      double* out = t.data();
+      for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) out[j * n + i] = in[i * n + j];
+      }
+      sink = t(0, 0);
+    });
+    double tiled = Milliseconds([&]() { sink = a.Transpose()(0, 0); });
+    std::printf("%-6d %9.3f ms %9.3f ms\n", n, naive, tiled);
+  }
+
+  // Произведение внешних матриц по столбцам: копия в S21Matrix против
+  // представления без копирования
+  std::printf("\n%-6s %16s %16s\n", "n", "convert + mul", "column views");
+  for (int n : {128, 256, 512}) {
+    S21Matrix a = Random(n, 2);
+    S21Matrix b = Random(n, 3);
+    std::vector<double> a_col(static_cast<size_t>(n) * n);
+    std::vector<double> b_col(a_col.size());
+    std::vector<double> c_col(a_col.size());
+    S21LayoutOps::Copy(S21ConstMatrixView<S21Layout::kRowMajor>(a),
+                       S21MatrixView<S21Layout::kColMajor>(a_col.data(), n, n));
+    S21LayoutOps::Copy(S21ConstMatrixView<S21Layout::kRowMajor>(b),
+                       S21MatrixView<S21Layout::kColMajor>(b_col.data(), n, n));
+    S21ConstMatrixView<S21Layout::kColMajor> a_view(a_col.data(), n, n);
+    S21ConstMatrixView<S21Layout::kColMajor> b_view(b_col.data(), n, n);
+    S21MatrixView<S21Layout::kColMajor> c_view(c_col.data(), n, n);
+    double convert = Milliseconds([&]() {
+      S21Matrix x(n, n), y(n, n);
+      for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+          x(i, j) = a_col[j * n + i];
+          y(i, j) = b_col[j * n + i];
+        }
+      }
+      S21Matrix z = x * y;
+      for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) c_col[j * n + i] = z(i, j);
+      }
+    });
+    double views = Milliseconds(
+        [&]() { S21LayoutOps::Gemm(1.0, a_view, b_view, 0.0, c_view); });
+    sink = c_col[0];
+    std::printf("%-6d %13.3f ms %13.3f ms\n", n, convert, views);
+  }
+  return 0;
+}
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <random>
+
+#include "s21_permutation.h"
+
+namespace {
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Время одного вызова fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Матрица с псевдослучайными элементами из [-1, 1)
+S21Matrix Random(int rows, int cols, unsigned state) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      state = state * 1103515245u + 12345u;
+      m(i, j) = (state >> 8) * 0x1p-23 - 1.0;
+    }
+  }
+  return m;
+}
+
+// Случайная перестановка [0, n)
+S21Permutation Shuffle(int n, unsigned seed) {
+  std::vector<int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937(seed));
+  return S21Permutation(order);
+}
+}  // namespace
+
+int main() {
+  // Перемешивание строк: копия через operator() против перестановки на месте
+  std::printf("%-6s %14s %14s %14s\n", "n", "copy rows", "PermuteRows",
+              "PermuteCols");
+  for (int n : {512, 1024, 2048}) {
+    S21Matrix m = Random(n, n, 1);
+    S21Permutation p = Shuffle(n, 2);
+    double copy = Milliseconds([&]() {
+      S21Matrix out(n, n);
+      for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) out(i, j) = m(p[i], j);
+      }
+      sink = out(0, 0);
+    });
+    double rows = Milliseconds([&]() { m.PermuteRows(p); });
+    double cols = Milliseconds([&]() { m.PermuteCols(p); });
+    sink = m(0, 0);
+    std::printf("%-6d %11.3f ms %11.3f ms %11.3f ms\n", n, copy, rows, cols);
+  }
+
+  // Мини-батч из перемешанных строк, умноженный на веса
+  std::printf("\n%-6s %16s %16s\n", "batch", "gather + mul", "view mul");
+  S21Matrix samples = Random(20000, 256, 3);
+  S21Matrix weights = Random(256, 128, 4);
+  for (int batch : {256, 1024, 4096}) {
+    std::vector<int> rows(batch);
+    std::mt19937 engine(5);
+    std::uniform_int_distribution<int> pick(0, 19999);
+    for (int& r : rows) r = pick(engine);
+    double gathered = Milliseconds([&]() {
+      S21Matrix x(batch, 256);
+      for (int i = 0; i < batch; ++i) {
+        for (int j = 0; j < 256; ++j) x(i, j) = samples(rows[i], j);
+      }
+      sink = (x * weights)(0, 0);
+    });
+    double view = Milliseconds([&]() {
+      S21GatherView x(samples, rows, {});
+      sink = S21GatherOps::Multiply(x, weights)(0, 0);
+    });
+    std::printf("%-6d %13.3f ms %13.3f ms\n", batch, gathered, view);
+  }
+  return 0;
+}
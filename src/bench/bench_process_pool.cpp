@@ -0,0 +1,67 @@
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "s21_process_pool.h"
+
+namespace {
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Время одного вызова fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Процессорное время завершившихся дочерних процессов в миллисекундах
+double ChildrenCpuMilliseconds() {
+  rusage usage{};
+  getrusage(RUSAGE_CHILDREN, &usage);
+  return usage.ru_utime.tv_sec * 1e3 + usage.ru_utime.tv_usec * 1e-3;
+}
+
+// Матрица с псевдослучайными элементами из [-1, 1)
+S21Matrix Random(int n, unsigned state) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      state = state * 1103515245u + 12345u;
+      m(i, j) = (state >> 8) * 0x1p-23 - 1.0;
+    }
+  }
+  return m;
+}
+}  // namespace
+
+int main() {
+  // Процессы пула создаются до первого использования потоков библиотеки
+  std::printf("%-6s %-8s %12s %12s %14s\n", "n", "workers", "serial", "pool",
+              "workers cpu");
+  for (int workers : {1, 3}) {
+    for (int n : {512, 1024}) {
+      double before = ChildrenCpuMilliseconds();
+      double pooled = 0.0;
+      {
+        S21ProcessPool pool(workers);
+        S21SharedMatrix a(Random(n, 1));
+        S21SharedMatrix b(Random(n, 2));
+        S21SharedMatrix c(n, n);
+        pooled = Milliseconds([&]() { pool.Multiply(a, b, c); });
+        sink = c(0, 0);
+      }
+      // Время рабочих процессов учитывается после их завершения
+      double children = ChildrenCpuMilliseconds() - before;
+      S21Matrix a = Random(n, 1);
+      S21Matrix b = Random(n, 2);
+      double serial = Milliseconds([&]() { sink = (a * b)(0, 0); });
+      std::printf("%-6d %-8d %9.3f ms %9.3f ms %11.3f ms\n", n, workers,
+                  serial, pooled, children);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,47 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+constexpr int kRepeats = 20;
+
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Среднее время одного вызова fn в микросекундах
+template <typename Fn>
+double Microseconds(Fn fn) {
+  double value = 0.0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < kRepeats; ++r) value += fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  sink = value;
+  return std::chrono::duration<double, std::micro>(elapsed).count() / kRepeats;
+}
+
+// Прежний способ: цикл через operator() с проверкой границ
+double LoopFrobenius(const S21Matrix& m) {
+  double sum = 0.0;
+  for (int i = 0; i < m.get_rows(); ++i) {
+    for (int j = 0; j < m.get_cols(); ++j) sum += m(i, j) * m(i, j);
+  }
+  return std::sqrt(sum);
+}
+}  // namespace
+
+int main() {
+  std::printf("%-6s %16s %16s\n", "n", "operator() loop", "NormFrobenius");
+  for (int n : {64, 256, 1024}) {
+    S21Matrix m(n, n);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) m(i, j) = std::sin(i * 0.1 + j);
+    }
+    const S21Matrix& view = m;
+    double loop = Microseconds([&]() { return LoopFrobenius(view); });
+    double blocked = Microseconds([&]() { return view.NormFrobenius(); });
+    std::printf("%-6d %13.1f us %13.1f us\n", n, loop, blocked);
+  }
+  return 0;
+}
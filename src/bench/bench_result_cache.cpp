@@ -0,0 +1,73 @@
+#include <chrono>
+#include <cstdio>
+
+#include "s21_result_cache.h"
+
+namespace {
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+// Время одного вызова fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Матрица с псевдослучайными элементами из [-1, 1) и усиленной диагональю
+S21Matrix Random(int n, unsigned state) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      state = state * 1103515245u + 12345u;
+      m(i, j) = (state >> 8) * 0x1p-23 - 1.0;
+    }
+    m(i, i) += n;
+  }
+  return m;
+}
+}  // namespace
+
+int main() {
+  // Пропускная способность хеша содержимого
+  std::printf("%-6s %14s %12s\n", "n", "Hash", "GB/s");
+  for (int n : {64, 512, 2048}) {
+    S21Matrix m = Random(n, 1);
+    int repeats = n < 512 ? 1000 : 10;
+    double ms = Milliseconds([&]() {
+      for (int r = 0; r < repeats; ++r) {
+        sink = static_cast<double>(S21ResultCache::Hash(m));
+      }
+    }) / repeats;
+    double gbs = n * static_cast<double>(n) * sizeof(double) / ms / 1e6;
+    std::printf("%-6d %11.4f ms %12.2f\n", n, ms, gbs);
+  }
+
+  // Новый экземпляр с тем же содержимым: вычисление против попадания
+  S21ResultCache::set_enabled(true);
+  std::printf("\n%-6s %-12s %14s %14s\n", "n", "operation", "computed",
+              "cached");
+  for (int n : {64, 256, 512}) {
+    S21ResultCache::Clear();
+    double inverse_cold = Milliseconds([&]() {
+      sink = Random(n, 2).InverseMatrix()(0, 0);
+    });
+    double inverse_hit = Milliseconds([&]() {
+      sink = Random(n, 2).InverseMatrix()(0, 0);
+    });
+    double det_cold =
+        Milliseconds([&]() { sink = Random(n, 3).Determinant(); });
+    double det_hit =
+        Milliseconds([&]() { sink = Random(n, 3).Determinant(); });
+    std::printf("%-6d %-12s %11.3f ms %11.3f ms\n", n, "inverse",
+                inverse_cold, inverse_hit);
+    std::printf("%-6d %-12s %11.3f ms %11.3f ms\n", n, "determinant",
+                det_cold, det_hit);
+  }
+  S21CacheStats stats = S21ResultCache::get_stats();
+  std::printf("\nhits %zu, misses %zu, entries %zu, %zu bytes\n", stats.hits,
+              stats.misses, stats.entries, stats.bytes);
+  return 0;
+}
@@ -0,0 +1,46 @@
+#include <chrono>
+#include <cstdio>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+constexpr int kIterations = 200000;
+
+// Значение, которое компилятор не может выбросить
+volatile double sink;
+
+S21Matrix Sample(int n) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) m(i, j) = ((i * 7 + j * 13) % 17) / 4.0;
+    m(i, i) += n;
+  }
+  return m;
+}
+
+// Среднее время одного вызова fn в наносекундах
+template <typename Fn>
+double NanosecondsPerCall(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kIterations; ++i) fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() /
+         kIterations;
+}
+}  // namespace
+
+int main() {
+  std::printf("%-4s %14s %14s %14s\n", "n", "Determinant", "Complements",
+              "Inverse");
+  for (int n = 2; n <= 6; ++n) {
+    const S21Matrix m = Sample(n);
+    double det = NanosecondsPerCall([&]() { sink = m.Determinant(); });
+    double complements = NanosecondsPerCall(
+        [&]() { sink = m.CalcComplements()(0, 0); });
+    double inverse = NanosecondsPerCall(
+        [&]() { sink = m.InverseMatrix()(0, 0); });
+    std::printf("%-4d %11.1f ns %11.1f ns %11.1f ns\n", n, det, complements,
+                inverse);
+  }
+  return 0;
+}
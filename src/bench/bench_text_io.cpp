@@ -0,0 +1,59 @@
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "s21_matrix_io.h"
+
+namespace {
+// Время выполнения fn в миллисекундах
+template <typename Fn>
+double Milliseconds(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Чтение CSV через iostream, как это делалось вне библиотеки
+S21Matrix ReadWithStreams(const std::string& path) {
+  std::ifstream in(path);
+  std::vector<double> values;
+  std::string line;
+  int rows = 0;
+  while (std::getline(in, line)) {
+    std::stringstream fields(line);
+    std::string field;
+    while (std::getline(fields, field, ',')) values.push_back(std::stod(field));
+    ++rows;
+  }
+  S21Matrix result(rows, static_cast<int>(values.size()) / rows);
+  std::copy(values.begin(), values.end(), result.data());
+  return result;
+}
+}  // namespace
+
+int main() {
+  const int n = 1500;
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) m(i, j) = (i * 31 + j * 17) % 1000 / 7.0;
+  }
+  std::string path =
+      (std::filesystem::temp_directory_path() / "s21_bench.csv").string();
+
+  double write = Milliseconds([&]() { S21MatrixIo::WriteCsv(m, path); });
+  double size = std::filesystem::file_size(path) / 1048576.0;
+  double streams = Milliseconds([&]() { ReadWithStreams(path); });
+  double chunked = Milliseconds([&]() { S21MatrixIo::ReadCsv(path); });
+  std::remove(path.c_str());
+
+  std::printf("%dx%d CSV, %.1f MiB\n", n, n, size);
+  std::printf("%-24s %9.1f ms\n", "WriteCsv (to_chars)", write);
+  std::printf("%-24s %9.1f ms\n", "iostream + stod", streams);
+  std::printf("%-24s %9.1f ms\n", "ReadCsv (from_chars)", chunked);
+  return 0;
+}
@@ -0,0 +1,265 @@
+#include "s21_allocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "s21_parallel.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr std::size_t kHugePageSize = std::size_t{1} << 21;
+// Elements per thread below which first touch stays on the calling thread.
+constexpr int kFirstTouchElements = 1 << 16;
+
+// Memory policy modes of the mbind system call (linux/mempolicy.h).
+constexpr int kMpolInterleave = 3;
+constexpr int kMpolLocal = 4;
+
+std::mutex policy_mutex;
+S21AllocationPolicy policy;
+// True while the policy may route an allocation to mmap; lets the common
+// case skip the policy lock.
+std::atomic<bool> mapping_enabled{false};
+
+std::atomic<std::size_t> mapped_count{0};
+std::atomic<std::size_t> advised_count{0};
+std::atomic<std::size_t> explicit_count{0};
+std::atomic<std::size_t> bound_count{0};
+std::atomic<std::size_t> fallback_count{0};
+
+// Live mappings: element pointer -> (mapping start, mapping length).
+std::mutex mappings_mutex;
+std::unordered_map<const double*, std::pair<void*, std::size_t>> mappings;
+std::atomic<std::size_t> live_mappings{0};
+
+std::size_t RoundUp(std::size_t value, std::size_t step) {
+  return (value + step - 1) / step * step;
+}
+
+#ifdef __linux__
+/**
+ * @brief Bit mask of the online NUMA nodes, read once from sysfs. Node 0
+ * only if the list is unavailable.
+ */
+unsigned long OnlineNodes() {
+  static const unsigned long nodes = []() {
+    std::ifstream file("/sys/devices/system/node/online");
+    std::string list;
+    unsigned long mask = 0;
+    if (file >> list) {
+      std::size_t pos = 0;
+      while (pos < list.size()) {
+        std::size_t end = list.find(',', pos);
+        if (end == std::string::npos) end = list.size();
+        std::string range = list.substr(pos, end - pos);
+        std::size_t dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos
+                       ? first
+                       : std::stoi(range.substr(dash + 1));
+        for (int node = first; node <= last && node < 64; ++node) {
+          mask |= 1UL << node;
+        }
+        pos = end + 1;
+      }
+    }
+    return mask == 0 ? 1UL : mask;
+  }();
+  return nodes;
+}
+
+/**
+ * @brief Applies the NUMA placement to a mapped range with mbind.
+ */
+void Place(void* data, std::size_t length, S21NumaPlacement placement) {
+  if (placement == S21NumaPlacement::kDefault) return;
+  long result = -1;
+  if (placement == S21NumaPlacement::kInterleave) {
+    unsigned long nodes = OnlineNodes();
+    result = syscall(SYS_mbind, data, length, kMpolInterleave, &nodes,
+                     sizeof(nodes) * 8, 0);
+  } else {
+    result = syscall(SYS_mbind, data, length, kMpolLocal, nullptr, 0, 0);
+  }
+  ++(result == 0 ? bound_count : fallback_count);
+}
+
+/**
+ * @brief Maps a zeroed buffer of bytes bytes according to the policy.
+ *
+ * @return The element pointer, or nullptr if mmap failed.
+ */
+double* Map(std::size_t bytes, const S21AllocationPolicy& current) {
+  void* base = MAP_FAILED;
+  std::size_t length = 0;
+  std::size_t used = 0;
+  char* data = nullptr;
+
+  if (current.huge_pages == S21HugePages::kExplicit) {
+    length = used = RoundUp(bytes, kHugePageSize);
+    base = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (base != MAP_FAILED) {
+      data = static_cast<char*>(base);
+      ++explicit_count;
+    } else {
+      ++fallback_count;
+    }
+  }
+  if (base == MAP_FAILED && current.huge_pages != S21HugePages::kNone) {
+    // Over-allocate by one huge page so the data can start on a 2 MiB
+    // boundary, the precondition for the kernel to use a huge page there.
+    used = RoundUp(bytes, kHugePageSize);
+    length = used + kHugePageSize;
+    base = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base != MAP_FAILED) {
+      auto address = reinterpret_cast<std::uintptr_t>(base);
+      data = reinterpret_cast<char*>(RoundUp(address, kHugePageSize));
+      ++(madvise(data, used, MADV_HUGEPAGE) == 0 ? advised_count
+                                                 : fallback_count);
+    }
+  }
+  if (base == MAP_FAILED && current.huge_pages == S21HugePages::kNone) {
+    length = used = RoundUp(bytes, static_cast<std::size_t>(getpagesize()));
+    base = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base != MAP_FAILED) data = static_cast<char*>(base);
+  }
+  if (base == MAP_FAILED) return nullptr;
+
+  Place(data, used, current.placement);
+  double* elements = reinterpret_cast<double*>(data);
+  {
+    std::lock_guard<std::mutex> lock(mappings_mutex);
+    mappings.emplace(elements, std::make_pair(base, length));
+  }
+  ++live_mappings;
+  ++mapped_count;
+  return elements;
+}
+#endif
+}  // namespace
+
+// --- Accessors ---
+
+/**
+ * @brief Get the current allocation policy.
+ */
+S21AllocationPolicy S21Allocator::get_policy() {
+  std::lock_guard<std::mutex> lock(policy_mutex);
+  return policy;
+}
+
+/**
+ * @brief Get the counters of mapped buffers, honoured requests and
+ * fallbacks since program start.
+ */
+S21AllocationStats S21Allocator::get_stats() {
+  S21AllocationStats stats;
+  stats.mapped = mapped_count.load();
+  stats.huge_pages_advised = advised_count.load();
+  stats.explicit_huge_pages = explicit_count.load();
+  stats.numa_bound = bound_count.load();
+  stats.fallbacks = fallback_count.load();
+  return stats;
+}
+
+/**
+ * @brief Set the policy for buffers allocated from now on. Existing buffers
+ * keep their placement and are released correctly regardless of the policy.
+ *
+ * @param new_policy The new policy.
+ */
+void S21Allocator::set_policy(const S21AllocationPolicy& new_policy) {
+  std::lock_guard<std::mutex> lock(policy_mutex);
+  policy = new_policy;
+  mapping_enabled = new_policy.huge_pages != S21HugePages::kNone ||
+                    new_policy.placement != S21NumaPlacement::kDefault;
+}
+
+// --- Allocation ---
+
+/**
+ * @brief Allocates a zero-initialized buffer of count doubles.
+ *
+ * Large buffers are mapped according to the policy; a mapped buffer is
+ * zeroed row block by row block on the threads of ParallelFor, which is the
+ * first touch that decides the page placement under kLocal or the default
+ * policy. The threads are not pinned, so the placement only spreads the
+ * pages; it does not match them to the threads of later kernels. Every step
+ * that the system refuses falls back to the next best option, down to
+ * operator new[].
+ *
+ * @param count Number of elements, at least 1.
+ * @param rows Number of rows the buffer is split into for first touch.
+ * @return The buffer; release it with Deallocate().
+ */
+double* S21Allocator::Allocate(std::size_t count, int rows) {
+#ifdef __linux__
+  if (mapping_enabled.load(std::memory_order_relaxed)) {
+    S21AllocationPolicy current = get_policy();
+    std::size_t bytes = count * sizeof(double);
+    if (bytes >= current.min_bytes) {
+      double* data = Map(bytes, current);
+      if (data) {
+        if (current.parallel_first_touch && rows > 0) {
+          std::size_t row_length = count / rows;
+          int min_rows = std::max<int>(
+              1, kFirstTouchElements / std::max<std::size_t>(row_length, 1));
+          s21_internal::ParallelFor(0, rows, min_rows, [&](int lo, int hi) {
+            std::fill(data + lo * row_length,
+                      hi == rows ? data + count : data + hi * row_length,
+                      0.0);
+          });
+        }
+        return data;
+      }
+      ++fallback_count;
+    }
+  }
+#else
+  (void)rows;
+#endif
+  return new double[count]();
+}
+
+/**
+ * @brief Releases a buffer obtained from Allocate().
+ *
+ * @param data The buffer; nullptr is ignored.
+ */
+void S21Allocator::Deallocate(double* data) noexcept {
+  if (!data) return;
+#ifdef __linux__
+  if (live_mappings.load() > 0) {
+    std::pair<void*, std::size_t> mapping(nullptr, 0);
+    {
+      std::lock_guard<std::mutex> lock(mappings_mutex);
+      auto it = mappings.find(data);
+      if (it != mappings.end()) {
+        mapping = it->second;
+        mappings.erase(it);
+      }
+    }
+    if (mapping.first) {
+      munmap(mapping.first, mapping.second);
+      --live_mappings;
+      return;
+    }
+  }
+#endif
+  delete[] data;
+}
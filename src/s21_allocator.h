@@ -0,0 +1,79 @@
+#ifndef S21_ALLOCATOR_H
+#define S21_ALLOCATOR_H
+
+#include <cstddef>
+
+/**
+ * @brief Page size used for the element buffers of large matrices.
+ *
+ * kTransparent maps 2 MiB aligned memory and advises the kernel to back it
+ * with transparent huge pages (madvise MADV_HUGEPAGE). kExplicit requests
+ * pages from the hugetlbfs pool (MAP_HUGETLB) and falls back to kTransparent
+ * when the pool is empty.
+ */
+enum class S21HugePages { kNone, kTransparent, kExplicit };
+
+/**
+ * @brief NUMA placement of the element buffers of large matrices.
+ *
+ * kLocal binds each page to the node of the thread that first touches it;
+ * kInterleave spreads the pages round-robin over all online nodes. kDefault
+ * keeps the process policy.
+ */
+enum class S21NumaPlacement { kDefault, kLocal, kInterleave };
+
+/**
+ * @brief Process-wide allocation policy for matrix element buffers.
+ *
+ * Buffers smaller than min_bytes, and all buffers while both huge_pages and
+ * placement are left at their defaults, come from operator new[]. Otherwise
+ * they are mapped with mmap. With parallel_first_touch the mapped pages are
+ * zeroed in row blocks on several threads, so under first-touch placement
+ * the pages are spread over the nodes those threads ran on instead of all
+ * landing on the allocating thread's node. This is best effort: the pool
+ * threads are not pinned, and the kernels that later compute on the buffer
+ * partition the rows by their own work estimate, so a block is not
+ * guaranteed to be local to the thread that computes on it.
+ */
+struct S21AllocationPolicy {
+  S21HugePages huge_pages = S21HugePages::kNone;
+  S21NumaPlacement placement = S21NumaPlacement::kDefault;
+  std::size_t min_bytes = std::size_t{1} << 21;
+  bool parallel_first_touch = true;
+};
+
+/**
+ * @brief Counters of what the allocator actually did. A request the system
+ * cannot honour (no huge page pool, NUMA syscalls unavailable, mmap failure)
+ * is counted in fallbacks and served with the next best option.
+ */
+struct S21AllocationStats {
+  std::size_t mapped = 0;
+  std::size_t huge_pages_advised = 0;
+  std::size_t explicit_huge_pages = 0;
+  std::size_t numa_bound = 0;
+  std::size_t fallbacks = 0;
+};
+
+/**
+ * @brief Allocates the heap element buffers of S21Matrix according to the
+ * current S21AllocationPolicy.
+ */
+class S21Allocator {
+ public:
+  // --- Getters ---
+
+  static S21AllocationPolicy get_policy();
+  static S21AllocationStats get_stats();
+
+  // --- Setters ---
+
+  static void set_policy(const S21AllocationPolicy& policy);
+
+  // --- Public methods ---
+
+  static double* Allocate(std::size_t count, int rows = 1);
+  static void Deallocate(double* data) noexcept;
+};
+
+#endif  // S21_ALLOCATOR_H
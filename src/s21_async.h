@@ -0,0 +1,30 @@
+#ifndef S21_ASYNC_H
+#define S21_ASYNC_H
+
+#include <functional>
+#include <stdexcept>
+#include <stop_token>
+
+/**
+ * @brief Thrown through the future of an asynchronous operation that was
+ * cancelled with its stop token.
+ */
+class S21OperationCancelled : public std::runtime_error {
+ public:
+  S21OperationCancelled() : std::runtime_error("Operation was cancelled.") {}
+};
+
+/**
+ * @brief Controls an asynchronous matrix operation.
+ *
+ * stop_token is checked at tile boundaries; once stop is requested the
+ * operation stops and its future throws S21OperationCancelled. progress, if
+ * set, is called from the worker thread with the completed fraction in
+ * [0, 1] after every tile.
+ */
+struct S21AsyncOptions {
+  std::stop_token stop_token;
+  std::function<void(double)> progress;
+};
+
+#endif  // S21_ASYNC_H
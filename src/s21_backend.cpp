@@ -0,0 +1,245 @@
+#include "s21_backend.h"
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "s21_parallel.h"
+
+namespace {
+// Products with fewer multiply-adds, and factorizations of smaller
+// matrices, stay on the builtin kernels: the call overhead of the system
+// library would dominate.
+constexpr long long kSystemGemmWork = 1LL << 15;
+constexpr int kSystemLuOrder = 32;
+
+// CBLAS enumerators (cblas.h).
+constexpr int kCblasRowMajor = 101;
+constexpr int kCblasNoTrans = 111;
+constexpr int kCblasTrans = 112;
+
+using DgemmFunction = void (*)(int, int, int, int, int, int, double,
+                               const double*, int, const double*, int,
+                               double, double*, int);
+using DgetrfFunction = void (*)(const int*, const int*, double*, const int*,
+                                int*, int*);
+using DgetriFunction = void (*)(const int*, double*, const int*, const int*,
+                                double*, const int*, int*);
+
+/**
+ * @brief Entry points of the system library; null where a routine or the
+ * whole library is missing.
+ */
+struct SystemLibrary {
+  DgemmFunction dgemm = nullptr;
+  DgetrfFunction dgetrf = nullptr;
+  DgetriFunction dgetri = nullptr;
+};
+
+/**
+ * @brief Loads the system library on first use. The handle stays open for
+ * the lifetime of the process.
+ */
+const SystemLibrary& System() {
+  static const SystemLibrary library = []() {
+    SystemLibrary result;
+    std::vector<const char*> candidates;
+    if (const char* path = std::getenv("S21_BLAS_LIBRARY")) {
+      candidates.push_back(path);
+    }
+    candidates.push_back("libopenblas.so.0");
+    candidates.push_back("libopenblas.so");
+    for (const char* name : candidates) {
+      void* handle = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+      if (!handle) continue;
+      void* dgemm = dlsym(handle, "cblas_dgemm");
+      if (!dgemm) {
+        dlclose(handle);
+        continue;
+      }
+      result.dgemm = reinterpret_cast<DgemmFunction>(dgemm);
+      result.dgetrf =
+          reinterpret_cast<DgetrfFunction>(dlsym(handle, "dgetrf_"));
+      result.dgetri =
+          reinterpret_cast<DgetriFunction>(dlsym(handle, "dgetri_"));
+      break;
+    }
+    return result;
+  }();
+  return library;
+}
+
+#ifdef S21_DEFAULT_BACKEND_OPENBLAS
+std::atomic<S21Backend> selected{S21Backend::kOpenBlas};
+#else
+std::atomic<S21Backend> selected{S21Backend::kBuiltin};
+#endif
+
+std::atomic<std::size_t> system_count{0};
+std::atomic<std::size_t> fallback_count{0};
+
+/**
+ * @brief Whether calls go to the system library: it is selected and the
+ * calling thread has no ThreadLimit(). The library runs its own thread
+ * team, which a per-thread cap cannot reach, so capped callers stay on the
+ * builtin kernels that honour it.
+ */
+bool SystemSelected() {
+  return selected.load() == S21Backend::kOpenBlas &&
+         s21_internal::ThreadLimit() == 0;
+}
+
+/**
+ * @brief Passes a system routine through, counting the call as routed, or
+ * as a fallback if the routine is missing.
+ */
+template <typename Function>
+Function Route(Function routine) {
+  if (routine) {
+    ++system_count;
+  } else {
+    ++fallback_count;
+  }
+  return routine;
+}
+
+/**
+ * @brief Copies a row-major n x n array into column-major order (or back:
+ * the operation is a transpose).
+ */
+void TransposeSquare(const double* in, int n, double* out) {
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      out[static_cast<size_t>(j) * n + i] = in[static_cast<size_t>(i) * n + j];
+    }
+  }
+}
+}  // namespace
+
+// --- Accessors ---
+
+/**
+ * @brief Get the backend in effect: the selected one, or kBuiltin if the
+ * system library is not available.
+ */
+S21Backend S21LinearAlgebra::get_backend() {
+  S21Backend backend = selected.load();
+  return IsAvailable(backend) ? backend : S21Backend::kBuiltin;
+}
+
+/**
+ * @brief Get the counters of routed calls and fallbacks since program
+ * start.
+ */
+S21BackendStats S21LinearAlgebra::get_stats() {
+  S21BackendStats stats;
+  stats.system_calls = system_count.load();
+  stats.fallbacks = fallback_count.load();
+  return stats;
+}
+
+/**
+ * @brief Select the backend for operations started from now on.
+ *
+ * @param backend The backend; kOpenBlas falls back to kBuiltin at run time
+ * when the library is missing.
+ */
+void S21LinearAlgebra::set_backend(S21Backend backend) { selected = backend; }
+
+// --- Public methods ---
+
+/**
+ * @brief Checks whether a backend can be used in this process. The first
+ * call for kOpenBlas loads the system library.
+ */
+bool S21LinearAlgebra::IsAvailable(S21Backend backend) {
+  return backend == S21Backend::kBuiltin || System().dgemm != nullptr;
+}
+
+// --- Internal entry points ---
+
+bool s21_internal::SystemGemm(bool trans_a, bool trans_b, int m, int n, int k,
+                              double alpha, const double* a, int lda,
+                              const double* b, int ldb, double beta,
+                              double* c, int ldc) {
+  if (!SystemSelected() ||
+      static_cast<long long>(m) * n * k < kSystemGemmWork) {
+    return false;
+  }
+  DgemmFunction dgemm = Route(System().dgemm);
+  if (!dgemm) return false;
+  dgemm(kCblasRowMajor, trans_a ? kCblasTrans : kCblasNoTrans,
+        trans_b ? kCblasTrans : kCblasNoTrans, m, n, k, alpha, a, lda, b, ldb,
+        beta, c, ldc);
+  return true;
+}
+
+bool s21_internal::SystemLu(double* lu, int* permutation, int n,
+                            double* sign) {
+  if (!SystemSelected() || n < kSystemLuOrder) {
+    return false;
+  }
+  DgetrfFunction dgetrf = Route(System().dgetrf);
+  if (!dgetrf) return false;
+
+  // LAPACK is column-major: factor a column-major copy and transpose the
+  // packed factors back.
+  std::vector<double> factors(static_cast<size_t>(n) * n);
+  TransposeSquare(lu, n, factors.data());
+  std::vector<int> pivots(n);
+  int info = 0;
+  dgetrf(&n, &n, factors.data(), &n, pivots.data(), &info);
+  if (info < 0) return false;
+  // info > 0 reports an exactly zero pivot; the factors are still complete.
+  TransposeSquare(factors.data(), n, lu);
+
+  *sign = 1.0;
+  for (int i = 0; i < n; ++i) permutation[i] = i;
+  for (int i = 0; i < n; ++i) {
+    int pivot = pivots[i] - 1;
+    if (pivot != i) {
+      std::swap(permutation[i], permutation[pivot]);
+      *sign = -*sign;
+    }
+  }
+  return true;
+}
+
+bool s21_internal::SystemInverse(const double* lu, const int* permutation,
+                                 int n, double* inverse) {
+  if (!SystemSelected() || n < kSystemLuOrder) {
+    return false;
+  }
+  DgetriFunction dgetri = Route(System().dgetri);
+  if (!dgetri) return false;
+
+  std::vector<double> factors(static_cast<size_t>(n) * n);
+  TransposeSquare(lu, n, factors.data());
+  // Rebuild the sequence of row interchanges that yields the permutation.
+  std::vector<int> pivots(n);
+  std::vector<int> rows(n);
+  std::vector<int> position(n);
+  for (int i = 0; i < n; ++i) rows[i] = position[i] = i;
+  for (int i = 0; i < n; ++i) {
+    int from = position[permutation[i]];
+    pivots[i] = from + 1;
+    std::swap(rows[i], rows[from]);
+    position[rows[i]] = i;
+    position[rows[from]] = from;
+  }
+
+  int info = 0;
+  int query = -1;
+  double optimal = 0.0;
+  dgetri(&n, factors.data(), &n, pivots.data(), &optimal, &query, &info);
+  int length = std::max(n, static_cast<int>(optimal));
+  std::vector<double> work(length);
+  dgetri(&n, factors.data(), &n, pivots.data(), work.data(), &length, &info);
+  if (info != 0) return false;
+  TransposeSquare(factors.data(), n, inverse);
+  return true;
+}
@@ -0,0 +1,92 @@
+#ifndef S21_BACKEND_H
+#define S21_BACKEND_H
+
+#include <cstddef>
+
+/**
+ * @brief Implementation of large matrix products and LU factorizations.
+ *
+ * kBuiltin uses the library's own kernels. kOpenBlas routes Gemm,
+ * MulMatrix, Determinant and InverseMatrix of large matrices to a system
+ * OpenBLAS (cblas_dgemm, dgetrf_, dgetri_) loaded at run time. The default
+ * is kBuiltin, or kOpenBlas when built with make BACKEND=openblas.
+ */
+enum class S21Backend { kBuiltin, kOpenBlas };
+
+/**
+ * @brief Counters of the calls routed to the system library, and of calls
+ * that were meant for it but ran on the builtin kernels because the
+ * library or the routine is missing.
+ */
+struct S21BackendStats {
+  std::size_t system_calls = 0;
+  std::size_t fallbacks = 0;
+};
+
+/**
+ * @brief Process-wide selection of the linear algebra backend.
+ *
+ * The system library is searched once, on first use: the path in the
+ * S21_BLAS_LIBRARY environment variable, then libopenblas.so.0 and
+ * libopenblas.so. Selecting kOpenBlas when it is not found is not an error;
+ * every operation then falls back to the builtin kernels. Threads with a
+ * s21_internal::ThreadLimit(), such as S21ProcessPool participants and the
+ * tasks of S21Expression::Eval, also use the builtin kernels, because the
+ * library's own threads would ignore the cap.
+ */
+class S21LinearAlgebra {
+ public:
+  // --- Getters ---
+
+  static S21Backend get_backend();
+  static S21BackendStats get_stats();
+
+  // --- Setters ---
+
+  static void set_backend(S21Backend backend);
+
+  // --- Public methods ---
+
+  static bool IsAvailable(S21Backend backend);
+};
+
+namespace s21_internal {
+/**
+ * @brief C = alpha * op(A) * op(B) + beta * C on row-major arrays through
+ * the system BLAS, C m x n with row stride ldc.
+ *
+ * @return false, leaving C untouched, if the system backend is not selected
+ * or available, the calling thread has a ThreadLimit(), or the product is
+ * too small to be worth the call.
+ */
+bool SystemGemm(bool trans_a, bool trans_b, int m, int n, int k, double alpha,
+                const double* a, int lda, const double* b, int ldb,
+                double beta, double* c, int ldc);
+
+/**
+ * @brief LU factorization with partial pivoting of a row-major n x n
+ * matrix through LAPACK, in the packed layout of S21Matrix::LuFactorization.
+ *
+ * @param lu On input the matrix; on success L and U packed row-major.
+ * @param permutation Receives the row permutation, n elements.
+ * @param sign Receives the sign of the permutation, 1 or -1.
+ * @return false, leaving lu untouched, if the system backend is not
+ * selected or available, the calling thread has a ThreadLimit(), or the
+ * matrix is too small.
+ */
+bool SystemLu(double* lu, int* permutation, int n, double* sign);
+
+/**
+ * @brief Inverse of a matrix from its packed LU factors through LAPACK.
+ *
+ * @param lu The factors as produced by SystemLu or LuFactorization.
+ * @param permutation Their row permutation.
+ * @param inverse Receives the row-major inverse, n x n.
+ * @return false if the system backend is not selected or available, the
+ * calling thread has a ThreadLimit(), or the matrix is too small.
+ */
+bool SystemInverse(const double* lu, const int* permutation, int n,
+                   double* inverse);
+}  // namespace s21_internal
+
+#endif  // S21_BACKEND_H
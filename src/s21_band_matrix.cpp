@@ -0,0 +1,318 @@
+#include "s21_band_matrix.h"
+
+#include <algorithm>
+
+#include "s21_kernels.h"
+
+/**
+ * @brief Banded LU factorization P * A = L * U with partial pivoting.
+ *
+ * Row i holds columns i - lower to i + lower + upper: pivoting can widen U
+ * by lower diagonals. The multipliers of step k stay in column k; later
+ * interchanges only swap columns to the right of their step, as in LAPACK
+ * dgbtrf, so the solve applies interchanges and eliminations step by step.
+ */
+struct S21BandMatrix::BandLu {
+  int n = 0;
+  int lower = 0;
+  int width = 0;
+  std::vector<double> lu;
+  std::vector<int> pivots;
+  double determinant = 1.0;
+  bool singular = false;
+
+  double& At(int row, int col) {
+    return lu[static_cast<std::size_t>(row) * width + (col - row + lower)];
+  }
+};
+
+// --- Constructors ---
+
+/**
+ * @brief Creates a zero band matrix.
+ *
+ * @param size The order n.
+ * @param lower Number of subdiagonals.
+ * @param upper Number of superdiagonals.
+ * @exception std::invalid_argument Thrown if size is less than 1 or a
+ * bandwidth is negative or not less than size.
+ */
+S21BandMatrix::S21BandMatrix(int size, int lower, int upper)
+    : size_(size), lower_(lower), upper_(upper) {
+  if (size < 1) {
+    throw std::invalid_argument("Incorrect matrix dimensions");
+  }
+  if (lower < 0 || upper < 0 || lower >= size || upper >= size) {
+    throw std::invalid_argument("Incorrect bandwidth");
+  }
+  values_.assign(static_cast<std::size_t>(size) * Width(), 0.0);
+}
+
+/**
+ * @brief Extracts the band of a dense matrix.
+ *
+ * @param dense A square matrix whose entries outside the band are zero
+ * (within 1e-7).
+ * @param lower Number of subdiagonals.
+ * @param upper Number of superdiagonals.
+ * @exception std::invalid_argument Thrown if the matrix is not square, the
+ * bandwidths are invalid, or entries outside the band are non-zero.
+ */
+S21BandMatrix::S21BandMatrix(const S21Matrix& dense, int lower, int upper)
+    : S21BandMatrix(dense.get_rows(), lower, upper) {
+  if (dense.get_rows() != dense.get_cols()) {
+    throw std::invalid_argument("Band matrix must be square.");
+  }
+  for (int i = 0; i < size_; ++i) {
+    for (int j = 0; j < size_; ++j) {
+      if (Contains(i, j)) {
+        values_[Position(i, j)] = dense(i, j);
+      } else if (std::fabs(dense(i, j)) > 1e-7) {
+        throw std::invalid_argument("Matrix has entries outside the band.");
+      }
+    }
+  }
+}
+
+// --- Accessors ---
+
+/**
+ * @brief Get the order of the matrix.
+ */
+int S21BandMatrix::get_size() const { return size_; }
+
+/**
+ * @brief Get the number of subdiagonals.
+ */
+int S21BandMatrix::get_lower_bandwidth() const { return lower_; }
+
+/**
+ * @brief Get the number of superdiagonals.
+ */
+int S21BandMatrix::get_upper_bandwidth() const { return upper_; }
+
+/**
+ * @brief Returns a reference to an entry inside the band.
+ *
+ * @exception std::out_of_range Thrown if the index is outside the matrix or
+ * outside the band, where the entries are structurally zero.
+ */
+double& S21BandMatrix::operator()(int row, int col) {
+  if (row < 0 || col < 0 || row >= size_ || col >= size_ ||
+      !Contains(row, col)) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return values_[Position(row, col)];
+}
+
+/**
+ * @brief Returns an entry; entries outside the band are zero.
+ *
+ * @exception std::out_of_range Thrown if the index is outside the matrix.
+ */
+double S21BandMatrix::operator()(int row, int col) const {
+  if (row < 0 || col < 0 || row >= size_ || col >= size_) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return Contains(row, col) ? values_[Position(row, col)] : 0.0;
+}
+
+// --- Operations ---
+
+/**
+ * @brief Expands the matrix into dense storage.
+ */
+S21Matrix S21BandMatrix::ToDense() const {
+  S21Matrix result(size_, size_);
+  double* out = result.data();
+  for (int i = 0; i < size_; ++i) {
+    int first = std::max(0, i - lower_);
+    int last = std::min(size_ - 1, i + upper_);
+    std::copy(values_.data() + Position(i, first),
+              values_.data() + Position(i, last) + 1,
+              out + static_cast<std::size_t>(i) * size_ + first);
+  }
+  return result;
+}
+
+/**
+ * @brief Multiplies the matrix by a vector in O(n * bandwidth).
+ *
+ * @exception std::invalid_argument Thrown if the sizes do not match.
+ */
+S21Vector S21BandMatrix::MulVector(const S21Vector& vec) const {
+  if (vec.get_size() != size_) {
+    throw std::invalid_argument(
+        "Matrix and vector dimensions are not suitable for multiplication.");
+  }
+  S21Vector result(size_);
+  for (int i = 0; i < size_; ++i) {
+    int first = std::max(0, i - lower_);
+    int last = std::min(size_ - 1, i + upper_);
+    result(i) = s21_internal::DotKernel(values_.data() + Position(i, first),
+                                        vec.data() + first, last - first + 1);
+  }
+  return result;
+}
+
+/**
+ * @brief Multiplies the matrix by a dense matrix, one AXPY per band entry.
+ *
+ * @exception std::invalid_argument Thrown if the dimensions do not match.
+ */
+S21Matrix S21BandMatrix::MulMatrix(const S21Matrix& other) const {
+  if (other.get_rows() != size_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  int cols = other.get_cols();
+  S21Matrix result(size_, cols);
+  const double* b = other.data();
+  double* out = result.data();
+  for (int i = 0; i < size_; ++i) {
+    int first = std::max(0, i - lower_);
+    int last = std::min(size_ - 1, i + upper_);
+    for (int j = first; j <= last; ++j) {
+      s21_internal::AxpyKernel(values_[Position(i, j)],
+                               b + static_cast<std::size_t>(j) * cols,
+                               out + static_cast<std::size_t>(i) * cols, cols);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Calculates the determinant from the banded LU factorization in
+ * O(n * lower * (lower + upper)); O(n) for tridiagonal matrices.
+ */
+double S21BandMatrix::Determinant() const { return Factorize().determinant; }
+
+/**
+ * @brief Solves A * x = b with the banded LU factorization.
+ *
+ * @exception std::invalid_argument Thrown if the sizes do not match or the
+ * matrix is singular.
+ */
+S21Vector S21BandMatrix::Solve(const S21Vector& rhs) const {
+  if (rhs.get_size() != size_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for solving a linear system.");
+  }
+  BandLu f = Factorize();
+  if (f.singular) {
+    throw std::invalid_argument("Matrix is singular, cannot solve.");
+  }
+  S21Vector x(rhs);
+  int reach = lower_ + upper_;
+  for (int k = 0; k < size_; ++k) {
+    std::swap(x(k), x(f.pivots[k]));
+    int last = std::min(size_ - 1, k + lower_);
+    for (int i = k + 1; i <= last; ++i) x(i) -= f.At(i, k) * x(k);
+  }
+  for (int k = size_ - 1; k >= 0; --k) {
+    int last = std::min(size_ - 1, k + reach);
+    double sum = x(k);
+    for (int j = k + 1; j <= last; ++j) sum -= f.At(k, j) * x(j);
+    x(k) = sum / f.At(k, k);
+  }
+  return x;
+}
+
+/**
+ * @brief Solves a tridiagonal system with the Thomas algorithm in O(n).
+ *
+ * The algorithm does not pivot; it is stable for diagonally dominant and
+ * symmetric positive definite matrices. Use Solve() otherwise.
+ *
+ * @exception std::invalid_argument Thrown if the matrix is not stored as
+ * tridiagonal, the sizes do not match, or a pivot vanishes.
+ */
+S21Vector S21BandMatrix::SolveTridiagonal(const S21Vector& rhs) const {
+  if (lower_ > 1 || upper_ > 1) {
+    throw std::invalid_argument("Matrix is not tridiagonal.");
+  }
+  if (rhs.get_size() != size_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for solving a linear system.");
+  }
+  std::vector<double> modified_upper(size_, 0.0);
+  S21Vector x(rhs);
+  for (int i = 0; i < size_; ++i) {
+    double sub = (i > 0) ? (*this)(i, i - 1) : 0.0;
+    double denominator = (*this)(i, i);
+    if (i > 0) {
+      denominator -= sub * modified_upper[i - 1];
+      x(i) -= sub * x(i - 1);
+    }
+    if (denominator == 0.0) {
+      throw std::invalid_argument("Zero pivot in tridiagonal solve.");
+    }
+    if (i + 1 < size_) modified_upper[i] = (*this)(i, i + 1) / denominator;
+    x(i) /= denominator;
+  }
+  for (int i = size_ - 2; i >= 0; --i) x(i) -= modified_upper[i] * x(i + 1);
+  return x;
+}
+
+// --- Helpers ---
+
+/**
+ * @brief Whether (row, col) lies inside the band.
+ */
+bool S21BandMatrix::Contains(int row, int col) const {
+  return col - row >= -lower_ && col - row <= upper_;
+}
+
+/**
+ * @brief Position of a band entry in values_.
+ */
+std::size_t S21BandMatrix::Position(int row, int col) const {
+  return static_cast<std::size_t>(row) * Width() + (col - row + lower_);
+}
+
+/**
+ * @brief Computes the banded LU factorization with partial pivoting.
+ */
+S21BandMatrix::BandLu S21BandMatrix::Factorize() const {
+  BandLu f;
+  f.n = size_;
+  f.lower = lower_;
+  f.width = 2 * lower_ + upper_ + 1;
+  f.lu.assign(static_cast<std::size_t>(size_) * f.width, 0.0);
+  f.pivots.resize(size_);
+  for (int i = 0; i < size_; ++i) {
+    int first = std::max(0, i - lower_);
+    int last = std::min(size_ - 1, i + upper_);
+    for (int j = first; j <= last; ++j) f.At(i, j) = values_[Position(i, j)];
+  }
+
+  int reach = lower_ + upper_;
+  for (int k = 0; k < size_; ++k) {
+    int last_row = std::min(size_ - 1, k + lower_);
+    int last_col = std::min(size_ - 1, k + reach);
+    int pivot = k;
+    for (int i = k + 1; i <= last_row; ++i) {
+      if (std::fabs(f.At(i, k)) > std::fabs(f.At(pivot, k))) pivot = i;
+    }
+    f.pivots[k] = pivot;
+    if (pivot != k) {
+      for (int j = k; j <= last_col; ++j) std::swap(f.At(k, j), f.At(pivot, j));
+      f.determinant = -f.determinant;
+    }
+    double diagonal = f.At(k, k);
+    f.determinant *= diagonal;
+    if (diagonal == 0.0) {
+      f.singular = true;
+      continue;
+    }
+    for (int i = k + 1; i <= last_row; ++i) {
+      double factor = f.At(i, k) / diagonal;
+      f.At(i, k) = factor;
+      if (factor != 0.0) {
+        s21_internal::AxpyKernel(-factor, &f.At(k, k + 1), &f.At(i, k + 1),
+                                 last_col - k);
+      }
+    }
+  }
+  return f;
+}
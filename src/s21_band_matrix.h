@@ -0,0 +1,59 @@
+#ifndef S21_BAND_MATRIX_H
+#define S21_BAND_MATRIX_H
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Square band matrix: entries (i, j) with -lower <= j - i <= upper.
+ *
+ * Each row stores lower + upper + 1 entries contiguously (columns i - lower
+ * to i + upper; positions outside the matrix stay zero). Products cost
+ * O(n * bandwidth); the determinant and general solves use a banded LU
+ * factorization with partial pivoting in O(n * lower * (lower + upper)).
+ * Tridiagonal systems (lower = upper = 1) can also be solved with the
+ * Thomas algorithm in O(n).
+ */
+class S21BandMatrix {
+ private:
+  struct BandLu;
+
+  int size_;
+  int lower_;
+  int upper_;
+  std::vector<double> values_;
+
+  int Width() const { return lower_ + upper_ + 1; }
+  bool Contains(int row, int col) const;
+  std::size_t Position(int row, int col) const;
+  BandLu Factorize() const;
+
+ public:
+  // -- Constructors --
+
+  S21BandMatrix(int size, int lower, int upper);
+  S21BandMatrix(const S21Matrix& dense, int lower, int upper);
+
+  // --- Getters ---
+
+  int get_size() const;
+  int get_lower_bandwidth() const;
+  int get_upper_bandwidth() const;
+
+  // --- Accessors ---
+
+  double& operator()(int row, int col);
+  double operator()(int row, int col) const;
+
+  // --- Public methods ---
+
+  S21Matrix ToDense() const;
+  S21Vector MulVector(const S21Vector& vec) const;
+  S21Matrix MulMatrix(const S21Matrix& other) const;
+  double Determinant() const;
+  S21Vector Solve(const S21Vector& rhs) const;
+  S21Vector SolveTridiagonal(const S21Vector& rhs) const;
+};
+
+#endif  // S21_BAND_MATRIX_H
@@ -0,0 +1,370 @@
+#include "s21_bigint.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+using Words = std::vector<std::uint32_t>;
+
+/**
+ * @brief Compares two magnitudes; returns -1, 0 or 1.
+ */
+int CompareMagnitude(const Words& a, const Words& b) {
+  if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+  for (std::size_t i = a.size(); i-- > 0;) {
+    if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+Words AddMagnitude(const Words& a, const Words& b) {
+  const Words& longer = a.size() >= b.size() ? a : b;
+  const Words& shorter = a.size() >= b.size() ? b : a;
+  Words sum(longer.size() + 1, 0);
+  std::uint64_t carry = 0;
+  for (std::size_t i = 0; i < longer.size(); ++i) {
+    carry += longer[i];
+    if (i < shorter.size()) carry += shorter[i];
+    sum[i] = static_cast<std::uint32_t>(carry);
+    carry >>= 32;
+  }
+  sum[longer.size()] = static_cast<std::uint32_t>(carry);
+  return sum;
+}
+
+/**
+ * @brief Computes a - b for magnitudes with a >= b.
+ */
+Words SubtractMagnitude(const Words& a, const Words& b) {
+  Words difference(a.size(), 0);
+  std::int64_t borrow = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    std::int64_t value = static_cast<std::int64_t>(a[i]) - borrow;
+    if (i < b.size()) value -= b[i];
+    borrow = value < 0 ? 1 : 0;
+    difference[i] = static_cast<std::uint32_t>(value + (borrow << 32));
+  }
+  return difference;
+}
+
+/**
+ * @brief Number of trailing zero bits of a non-zero magnitude.
+ */
+int TrailingZeroBits(const Words& a) {
+  int bits = 0;
+  std::size_t i = 0;
+  while (a[i] == 0) {
+    bits += 32;
+    ++i;
+  }
+  return bits + __builtin_ctz(a[i]);
+}
+
+Words ShiftRight(const Words& a, int bits) {
+  std::size_t word_shift = bits / 32;
+  int bit_shift = bits % 32;
+  if (word_shift >= a.size()) return {};
+  Words shifted(a.size() - word_shift, 0);
+  for (std::size_t i = 0; i < shifted.size(); ++i) {
+    std::uint64_t value = a[i + word_shift];
+    if (i + word_shift + 1 < a.size()) {
+      value |= static_cast<std::uint64_t>(a[i + word_shift + 1]) << 32;
+    }
+    shifted[i] = static_cast<std::uint32_t>(value >> bit_shift);
+  }
+  return shifted;
+}
+}  // namespace
+
+// --- Constructors ---
+
+/**
+ * @brief Creates zero.
+ */
+S21BigInt::S21BigInt() : negative_(false) {}
+
+/**
+ * @brief Creates the integer value.
+ *
+ * @param value The value.
+ */
+S21BigInt::S21BigInt(long long value) : negative_(value < 0) {
+  std::uint64_t magnitude = value < 0 ? 0 - static_cast<std::uint64_t>(value)
+                                      : static_cast<std::uint64_t>(value);
+  words_ = {static_cast<std::uint32_t>(magnitude),
+            static_cast<std::uint32_t>(magnitude >> 32)};
+  Trim();
+}
+
+/**
+ * @brief Creates the integer held exactly by a double.
+ *
+ * @param value A finite integer-valued double.
+ * @exception std::invalid_argument Thrown if value is not a finite integer.
+ */
+S21BigInt S21BigInt::FromDouble(double value) {
+  if (!std::isfinite(value) || std::trunc(value) != value) {
+    throw std::invalid_argument("Value is not a finite integer.");
+  }
+  S21BigInt result;
+  if (value == 0.0) return result;
+  int exponent = 0;
+  double fraction = std::frexp(std::fabs(value), &exponent);
+  // |value| = mantissa * 2^(exponent - 53) with a 53-bit integer mantissa.
+  auto mantissa = static_cast<long long>(std::ldexp(fraction, 53));
+  if (exponent >= 53) {
+    result = S21BigInt(mantissa) << (exponent - 53);
+  } else {
+    result = S21BigInt(mantissa >> (53 - exponent));
+  }
+  return value < 0 ? -result : result;
+}
+
+// --- Getters ---
+
+/**
+ * @brief Get the sign: -1, 0 or 1.
+ */
+int S21BigInt::Sign() const {
+  if (words_.empty()) return 0;
+  return negative_ ? -1 : 1;
+}
+
+/**
+ * @brief Check whether the value is zero.
+ */
+bool S21BigInt::IsZero() const { return words_.empty(); }
+
+// --- Overload operators ---
+
+/**
+ * @brief Negation.
+ */
+S21BigInt S21BigInt::operator-() const {
+  S21BigInt result(*this);
+  result.negative_ = !negative_;
+  result.Trim();
+  return result;
+}
+
+/**
+ * @brief Sum of two integers.
+ */
+S21BigInt S21BigInt::operator+(const S21BigInt& other) const {
+  S21BigInt result;
+  if (negative_ == other.negative_) {
+    result.words_ = AddMagnitude(words_, other.words_);
+    result.negative_ = negative_;
+  } else if (CompareMagnitude(words_, other.words_) >= 0) {
+    result.words_ = SubtractMagnitude(words_, other.words_);
+    result.negative_ = negative_;
+  } else {
+    result.words_ = SubtractMagnitude(other.words_, words_);
+    result.negative_ = other.negative_;
+  }
+  result.Trim();
+  return result;
+}
+
+/**
+ * @brief Difference of two integers.
+ */
+S21BigInt S21BigInt::operator-(const S21BigInt& other) const {
+  return *this + (-other);
+}
+
+/**
+ * @brief Product of two integers (schoolbook multiplication).
+ */
+S21BigInt S21BigInt::operator*(const S21BigInt& other) const {
+  S21BigInt result;
+  if (IsZero() || other.IsZero()) return result;
+  result.words_.assign(words_.size() + other.words_.size(), 0);
+  for (std::size_t i = 0; i < words_.size(); ++i) {
+    std::uint64_t carry = 0;
+    for (std::size_t j = 0; j < other.words_.size(); ++j) {
+      carry += static_cast<std::uint64_t>(words_[i]) * other.words_[j] +
+               result.words_[i + j];
+      result.words_[i + j] = static_cast<std::uint32_t>(carry);
+      carry >>= 32;
+    }
+    result.words_[i + other.words_.size()] = static_cast<std::uint32_t>(carry);
+  }
+  result.negative_ = negative_ != other.negative_;
+  result.Trim();
+  return result;
+}
+
+/**
+ * @brief Multiplies by 2^bits.
+ *
+ * @param bits A non-negative shift.
+ */
+S21BigInt S21BigInt::operator<<(int bits) const {
+  S21BigInt result;
+  if (IsZero()) return result;
+  std::size_t word_shift = bits / 32;
+  int bit_shift = bits % 32;
+  result.words_.assign(words_.size() + word_shift + 1, 0);
+  for (std::size_t i = 0; i < words_.size(); ++i) {
+    std::uint64_t value = static_cast<std::uint64_t>(words_[i]) << bit_shift;
+    result.words_[i + word_shift] |= static_cast<std::uint32_t>(value);
+    result.words_[i + word_shift + 1] |=
+        static_cast<std::uint32_t>(value >> 32);
+  }
+  result.negative_ = negative_;
+  result.Trim();
+  return result;
+}
+
+/**
+ * @brief Checks two integers for equality.
+ */
+bool S21BigInt::operator==(const S21BigInt& other) const {
+  return negative_ == other.negative_ && words_ == other.words_;
+}
+
+// --- Public methods ---
+
+/**
+ * @brief Divides by an integer that is known to divide this one exactly.
+ *
+ * Uses exact (Jebelean) division: after removing the common power of two
+ * the divisor is odd, and each quotient word is the lowest remaining word
+ * times the inverse of the divisor modulo 2^32. No trial quotients or
+ * normalization are needed, which makes it cheaper than long division. The
+ * result is unspecified if the division is not exact.
+ *
+ * @param divisor A non-zero divisor of this integer.
+ * @return The quotient.
+ * @exception std::invalid_argument Thrown if divisor is zero.
+ */
+S21BigInt S21BigInt::DivideExact(const S21BigInt& divisor) const {
+  if (divisor.IsZero()) {
+    throw std::invalid_argument("Division by zero.");
+  }
+  S21BigInt quotient;
+  if (IsZero()) return quotient;
+  int shift = TrailingZeroBits(divisor.words_);
+  Words d = ShiftRight(divisor.words_, shift);
+  Words a = ShiftRight(words_, shift);
+  while (!d.empty() && d.back() == 0) d.pop_back();
+  while (!a.empty() && a.back() == 0) a.pop_back();
+  if (a.size() < d.size()) return quotient;
+
+  // Newton iteration for d[0]^-1 mod 2^32; each step doubles the correct
+  // low bits, starting from 3 (d * d == 1 mod 8 for odd d).
+  std::uint32_t inverse = d[0];
+  for (int i = 0; i < 4; ++i) inverse *= 2 - d[0] * inverse;
+
+  quotient.words_.assign(a.size() - d.size() + 1, 0);
+  for (std::size_t i = 0; i < quotient.words_.size(); ++i) {
+    std::uint32_t q = a[i] * inverse;
+    quotient.words_[i] = q;
+    // a -= q * d * 2^(32 i); the low word becomes zero.
+    std::uint64_t carry = 0;
+    std::int64_t borrow = 0;
+    std::size_t k = i;
+    for (std::size_t j = 0; j < d.size(); ++j, ++k) {
+      carry += static_cast<std::uint64_t>(q) * d[j];
+      std::int64_t value = static_cast<std::int64_t>(a[k]) -
+                           static_cast<std::uint32_t>(carry) - borrow;
+      carry >>= 32;
+      borrow = value < 0 ? 1 : 0;
+      a[k] = static_cast<std::uint32_t>(value + (borrow << 32));
+    }
+    for (; k < a.size() && (carry || borrow); ++k) {
+      std::int64_t value = static_cast<std::int64_t>(a[k]) -
+                           static_cast<std::int64_t>(carry) - borrow;
+      carry = 0;
+      borrow = value < 0 ? 1 : 0;
+      a[k] = static_cast<std::uint32_t>(value + (borrow << 32));
+    }
+  }
+  quotient.negative_ = negative_ != divisor.negative_;
+  quotient.Trim();
+  return quotient;
+}
+
+/**
+ * @brief Formats the integer in decimal.
+ *
+ * @return The decimal digits, with a leading '-' for negative values.
+ */
+std::string S21BigInt::ToString() const {
+  if (IsZero()) return "0";
+  Words rest = words_;
+  std::string digits;
+  while (!rest.empty()) {
+    // Divide by 10^9 and emit the remainder as nine digits.
+    std::uint64_t remainder = 0;
+    for (std::size_t i = rest.size(); i-- > 0;) {
+      std::uint64_t value = (remainder << 32) | rest[i];
+      rest[i] = static_cast<std::uint32_t>(value / 1000000000);
+      remainder = value % 1000000000;
+    }
+    while (!rest.empty() && rest.back() == 0) rest.pop_back();
+    for (int i = 0; i < 9 && (remainder > 0 || !rest.empty()); ++i) {
+      digits.push_back(static_cast<char>('0' + remainder % 10));
+      remainder /= 10;
+    }
+  }
+  if (negative_) digits.push_back('-');
+  std::reverse(digits.begin(), digits.end());
+  return digits;
+}
+
+/**
+ * @brief Converts to the nearest double, or an infinity if out of range.
+ *
+ * @return The value as a double.
+ */
+double S21BigInt::ToDouble() const {
+  if (IsZero()) return 0.0;
+  // The top three words carry more than the 53 bits of a double; the words
+  // below can only affect the result through rounding ties.
+  std::size_t top = words_.size();
+  std::size_t first = top > 3 ? top - 3 : 0;
+  double value = 0.0;
+  for (std::size_t i = top; i-- > first;) {
+    value = value * 4294967296.0 + words_[i];
+  }
+  value = std::ldexp(value, static_cast<int>(32 * first));
+  return negative_ ? -value : value;
+}
+
+/**
+ * @brief Converts to a 64-bit integer.
+ *
+ * @return The value.
+ * @exception std::out_of_range Thrown if the value does not fit.
+ */
+long long S21BigInt::ToInt64() const {
+  if (words_.size() > 2) {
+    throw std::out_of_range("Value does not fit into 64 bits.");
+  }
+  std::uint64_t magnitude = 0;
+  for (std::size_t i = words_.size(); i-- > 0;) {
+    magnitude = (magnitude << 32) | words_[i];
+  }
+  std::uint64_t limit =
+      static_cast<std::uint64_t>(std::numeric_limits<long long>::max()) +
+      (negative_ ? 1 : 0);
+  if (magnitude > limit) {
+    throw std::out_of_range("Value does not fit into 64 bits.");
+  }
+  return negative_ ? static_cast<long long>(0 - magnitude)
+                   : static_cast<long long>(magnitude);
+}
+
+// --- Helpers ---
+
+/**
+ * @brief Removes leading zero words; zero is never negative.
+ */
+void S21BigInt::Trim() {
+  while (!words_.empty() && words_.back() == 0) words_.pop_back();
+  if (words_.empty()) negative_ = false;
+}
@@ -0,0 +1,52 @@
+#ifndef S21_BIGINT_H
+#define S21_BIGINT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Arbitrary-precision signed integer.
+ *
+ * Sign and magnitude; the magnitude is a little-endian vector of 32-bit
+ * words without leading zero words, so zero has no words. Provides the
+ * operations exact integer elimination needs: addition, subtraction,
+ * multiplication, shifts and exact division.
+ */
+class S21BigInt {
+ private:
+  bool negative_;
+  std::vector<std::uint32_t> words_;
+
+  void Trim();
+
+ public:
+  // -- Constructors --
+
+  S21BigInt();
+  S21BigInt(long long value);
+  static S21BigInt FromDouble(double value);
+
+  // --- Getters ---
+
+  int Sign() const;
+  bool IsZero() const;
+
+  // --- Overload operators ---
+
+  S21BigInt operator-() const;
+  S21BigInt operator+(const S21BigInt& other) const;
+  S21BigInt operator-(const S21BigInt& other) const;
+  S21BigInt operator*(const S21BigInt& other) const;
+  S21BigInt operator<<(int bits) const;
+  bool operator==(const S21BigInt& other) const;
+
+  // --- Public methods ---
+
+  S21BigInt DivideExact(const S21BigInt& divisor) const;
+  std::string ToString() const;
+  double ToDouble() const;
+  long long ToInt64() const;
+};
+
+#endif  // S21_BIGINT_H
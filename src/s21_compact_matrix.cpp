@@ -0,0 +1,551 @@
+#include "s21_compact_matrix.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "s21_kernels.h"
+#include "s21_layout.h"
+#include "s21_parallel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define S21_COMPACT_X86 1
+// Kernels compiled for F16C/AVX2/FMA and selected at run time, so the
+// library itself still builds for the baseline instruction set.
+#define S21_COMPACT_SIMD __attribute__((target("avx2,f16c,fma")))
+#endif
+
+namespace {
+// Entries widened at a time by the scalar kernels: 2 KB of doubles, which
+// stays in L1 next to the rows being updated.
+constexpr int kChunk = 256;
+// Rows of a compact left operand widened per product call.
+constexpr int kPanelRows = 64;
+// Rows of a compact right operand kept hot in cache by the product.
+constexpr int kPanelDepth = 128;
+
+/**
+ * @brief Rounds a double to nearest, ties to even, in a 16-bit format with
+ * the given exponent and stored mantissa widths.
+ *
+ * Works on the bits of the double, so there is no intermediate rounding to
+ * float. Values past the largest finite number become infinities, NaNs stay
+ * quiet NaNs.
+ */
+template <int kExponentBits, int kMantissaBits>
+std::uint16_t Narrow(double value) {
+  constexpr int kBias = (1 << (kExponentBits - 1)) - 1;
+  constexpr std::uint32_t kInfinity = ((1u << kExponentBits) - 1)
+                                      << kMantissaBits;
+  std::uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  std::uint32_t sign = static_cast<std::uint32_t>(bits >> 48) & 0x8000u;
+  bits &= 0x7fffffffffffffffULL;
+  if (bits >= 0x7ff0000000000000ULL) {
+    std::uint32_t quiet =
+        bits > 0x7ff0000000000000ULL ? 1u << (kMantissaBits - 1) : 0u;
+    return static_cast<std::uint16_t>(sign | kInfinity | quiet);
+  }
+  int exponent = static_cast<int>(bits >> 52) - 1023;
+  if (exponent > kBias) return static_cast<std::uint16_t>(sign | kInfinity);
+
+  // The implicit leading bit carries into the exponent field, hence the
+  // exponent offset of kBias - 1 for normal results.
+  std::uint64_t mantissa = (bits & ((1ULL << 52) - 1)) | (1ULL << 52);
+  int shift = 52 - kMantissaBits;
+  std::uint32_t offset = 0;
+  if (exponent >= 1 - kBias) {
+    offset = static_cast<std::uint32_t>(exponent + kBias - 1)
+             << kMantissaBits;
+  } else {
+    shift += 1 - kBias - exponent;
+    if (shift > 63) return static_cast<std::uint16_t>(sign);
+  }
+  std::uint64_t quotient = mantissa >> shift;
+  std::uint64_t rest = mantissa & ((1ULL << shift) - 1);
+  std::uint64_t half = 1ULL << (shift - 1);
+  if (rest > half || (rest == half && (quotient & 1))) ++quotient;
+  return static_cast<std::uint16_t>(sign |
+                                    (offset + static_cast<std::uint32_t>(
+                                                  quotient)));
+}
+
+/**
+ * @brief Widens a binary16 value; exact, including subnormals.
+ */
+inline float HalfToFloat(std::uint16_t h) {
+  constexpr std::uint32_t kExponentMask = 0x7c00u << 13;
+  std::uint32_t bits = (h & 0x7fffu) << 13;
+  std::uint32_t exponent = bits & kExponentMask;
+  bits += (127 - 15) << 23;
+  if (exponent == kExponentMask) {
+    bits += (128 - 16) << 23;  // infinity or NaN
+  } else if (exponent == 0) {
+    bits += 1u << 23;  // subnormal: renormalized by the subtraction below
+  }
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  if (exponent == 0) value -= 0x1p-14f;
+  std::memcpy(&bits, &value, sizeof(bits));
+  bits |= static_cast<std::uint32_t>(h & 0x8000u) << 16;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/**
+ * @brief Widens a bfloat16 value: it is the upper half of a float.
+ */
+inline float BFloat16ToFloat(std::uint16_t h) {
+  std::uint32_t bits = static_cast<std::uint32_t>(h) << 16;
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+inline double Widen(S21Precision precision, std::uint16_t h) {
+  return precision == S21Precision::kHalf ? HalfToFloat(h)
+                                          : BFloat16ToFloat(h);
+}
+
+inline std::uint16_t Narrow(S21Precision precision, double value) {
+  return precision == S21Precision::kHalf ? Narrow<5, 10>(value)
+                                          : Narrow<8, 7>(value);
+}
+
+bool CpuHasSimd() {
+#ifdef S21_COMPACT_X86
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c") &&
+         __builtin_cpu_supports("fma");
+#else
+  return false;
+#endif
+}
+
+std::atomic<bool>& SimdFlag() {
+  static std::atomic<bool> enabled(CpuHasSimd());
+  return enabled;
+}
+
+#ifdef S21_COMPACT_X86
+/**
+ * @brief Loads eight 16-bit entries and widens them to floats in a register.
+ */
+template <bool kBFloat16>
+S21_COMPACT_SIMD inline __m256 Load8(const std::uint16_t* x) {
+  __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x));
+  if (kBFloat16) {
+    return _mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_cvtepu16_epi32(raw), 16));
+  }
+  return _mm256_cvtph_ps(raw);
+}
+
+template <bool kBFloat16>
+S21_COMPACT_SIMD void WidenSimd(const std::uint16_t* x, double* y, int n) {
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = Load8<kBFloat16>(x + i);
+    _mm256_storeu_pd(y + i, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+    _mm256_storeu_pd(y + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+  }
+  for (; i < n; ++i) {
+    y[i] = kBFloat16 ? BFloat16ToFloat(x[i]) : HalfToFloat(x[i]);
+  }
+}
+
+template <bool kBFloat16>
+S21_COMPACT_SIMD double DotSimd(const std::uint16_t* x, const double* y,
+                                int n) {
+  __m256d s0 = _mm256_setzero_pd();
+  __m256d s1 = _mm256_setzero_pd();
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = Load8<kBFloat16>(x + i);
+    s0 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v)),
+                         _mm256_loadu_pd(y + i), s0);
+    s1 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)),
+                         _mm256_loadu_pd(y + i + 4), s1);
+  }
+  double lanes[4];
+  _mm256_storeu_pd(lanes, _mm256_add_pd(s0, s1));
+  double sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  for (; i < n; ++i) {
+    sum += (kBFloat16 ? BFloat16ToFloat(x[i]) : HalfToFloat(x[i])) * y[i];
+  }
+  return sum;
+}
+
+template <bool kBFloat16>
+S21_COMPACT_SIMD void AxpySimd(double alpha, const std::uint16_t* x,
+                               double* y, int n) {
+  __m256d a = _mm256_set1_pd(alpha);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = Load8<kBFloat16>(x + i);
+    _mm256_storeu_pd(y + i, _mm256_fmadd_pd(
+                                a, _mm256_cvtps_pd(_mm256_castps256_ps128(v)),
+                                _mm256_loadu_pd(y + i)));
+    _mm256_storeu_pd(
+        y + i + 4,
+        _mm256_fmadd_pd(a, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)),
+                        _mm256_loadu_pd(y + i + 4)));
+  }
+  for (; i < n; ++i) {
+    y[i] += alpha * (kBFloat16 ? BFloat16ToFloat(x[i]) : HalfToFloat(x[i]));
+  }
+}
+#endif
+
+/**
+ * @brief Widens n contiguous entries to doubles.
+ */
+void WidenKernel(S21Precision precision, const std::uint16_t* x, double* y,
+                 int n) {
+#ifdef S21_COMPACT_X86
+  if (SimdFlag().load(std::memory_order_relaxed)) {
+    if (precision == S21Precision::kHalf) {
+      WidenSimd<false>(x, y, n);
+    } else {
+      WidenSimd<true>(x, y, n);
+    }
+    return;
+  }
+#endif
+  if (precision == S21Precision::kHalf) {
+    for (int i = 0; i < n; ++i) y[i] = HalfToFloat(x[i]);
+  } else {
+    for (int i = 0; i < n; ++i) y[i] = BFloat16ToFloat(x[i]);
+  }
+}
+
+/**
+ * @brief Dot product of n compact entries with n doubles.
+ */
+double DotWidenKernel(S21Precision precision, const std::uint16_t* x,
+                      const double* y, int n) {
+#ifdef S21_COMPACT_X86
+  if (SimdFlag().load(std::memory_order_relaxed)) {
+    return precision == S21Precision::kHalf ? DotSimd<false>(x, y, n)
+                                            : DotSimd<true>(x, y, n);
+  }
+#endif
+  double buffer[kChunk];
+  double sum = 0.0;
+  for (int i = 0; i < n; i += kChunk) {
+    int count = std::min(kChunk, n - i);
+    WidenKernel(precision, x + i, buffer, count);
+    sum += s21_internal::DotKernel(buffer, y + i, count);
+  }
+  return sum;
+}
+
+/**
+ * @brief Computes y += alpha * x for n compact entries x.
+ */
+void AxpyWidenKernel(S21Precision precision, double alpha,
+                     const std::uint16_t* x, double* y, int n) {
+#ifdef S21_COMPACT_X86
+  if (SimdFlag().load(std::memory_order_relaxed)) {
+    if (precision == S21Precision::kHalf) {
+      AxpySimd<false>(alpha, x, y, n);
+    } else {
+      AxpySimd<true>(alpha, x, y, n);
+    }
+    return;
+  }
+#endif
+  double buffer[kChunk];
+  for (int i = 0; i < n; i += kChunk) {
+    int count = std::min(kChunk, n - i);
+    WidenKernel(precision, x + i, buffer, count);
+    s21_internal::AxpyKernel(alpha, buffer, y + i, count);
+  }
+}
+}  // namespace
+
+// --- Constructors ---
+
+/**
+ * @brief Creates a zero matrix.
+ *
+ * @exception std::invalid_argument Thrown if a dimension is less than 1.
+ */
+S21CompactMatrix::S21CompactMatrix(int rows, int cols, S21Precision precision)
+    : rows_(rows), cols_(cols), precision_(precision) {
+  if (rows < 1 || cols < 1) {
+    throw std::invalid_argument("Incorrect matrix dimensions");
+  }
+  values_.assign(static_cast<std::size_t>(rows) * cols, 0);
+}
+
+/**
+ * @brief Rounds every entry of a dense matrix to the 16-bit format.
+ */
+S21CompactMatrix::S21CompactMatrix(const S21Matrix& dense,
+                                   S21Precision precision)
+    : S21CompactMatrix(dense.get_rows(), dense.get_cols(), precision) {
+  const double* in = dense.cbegin();
+  for (std::size_t i = 0; i < values_.size(); ++i) {
+    values_[i] = Narrow(precision_, in[i]);
+  }
+}
+
+// --- Getters ---
+
+int S21CompactMatrix::get_rows() const { return rows_; }
+
+int S21CompactMatrix::get_cols() const { return cols_; }
+
+S21Precision S21CompactMatrix::get_precision() const { return precision_; }
+
+/**
+ * @brief Whether the kernels use the F16C/AVX2 paths.
+ */
+bool S21CompactMatrix::get_simd_enabled() { return SimdFlag().load(); }
+
+// --- Setters ---
+
+/**
+ * @brief Stores a value, rounded to the 16-bit format.
+ *
+ * @exception std::out_of_range Thrown if the index is out of range.
+ */
+void S21CompactMatrix::Set(int row, int col, double value) {
+  values_[Position(row, col)] = Narrow(precision_, value);
+}
+
+/**
+ * @brief Enables or disables the F16C/AVX2 kernels.
+ *
+ * Enabling has no effect on a CPU without these instructions. Both paths
+ * widen to the same values; sums may differ in the last bits because of
+ * fused multiply-adds and the summation order.
+ */
+void S21CompactMatrix::set_simd_enabled(bool enabled) {
+  SimdFlag().store(enabled && CpuHasSimd());
+}
+
+// --- Accessors ---
+
+/**
+ * @brief Reads an entry widened to double; the conversion is exact.
+ *
+ * @exception std::out_of_range Thrown if the index is out of range.
+ */
+double S21CompactMatrix::operator()(int row, int col) const {
+  return Widen(precision_, values_[Position(row, col)]);
+}
+
+/**
+ * @brief Raw row-major 16-bit storage.
+ */
+const std::uint16_t* S21CompactMatrix::data() const { return values_.data(); }
+
+// --- Public methods ---
+
+/**
+ * @brief Largest relative error of storing a value in the normal range:
+ * 2^-11 for kHalf, 2^-8 for kBFloat16.
+ */
+double S21CompactMatrix::UnitRoundoff(S21Precision precision) {
+  return precision == S21Precision::kHalf ? 0x1p-11 : 0x1p-8;
+}
+
+/**
+ * @brief The value that storing value in the given format would keep.
+ */
+double S21CompactMatrix::Round(double value, S21Precision precision) {
+  return Widen(precision, Narrow(precision, value));
+}
+
+/**
+ * @brief Widens the matrix to double precision.
+ */
+S21Matrix S21CompactMatrix::ToDense() const {
+  S21Matrix result(rows_, cols_);
+  double* out = result.data();
+  for (std::size_t i = 0; i < values_.size(); i += kChunk) {
+    int count = static_cast<int>(
+        std::min<std::size_t>(kChunk, values_.size() - i));
+    WidenKernel(precision_, values_.data() + i, out + i, count);
+  }
+  return result;
+}
+
+/**
+ * @brief Multiplies the matrix by a vector, one widening dot product per
+ * row.
+ *
+ * @exception std::invalid_argument Thrown if the sizes do not match.
+ */
+S21Vector S21CompactMatrix::MulVector(const S21Vector& vec) const {
+  if (vec.get_size() != cols_) {
+    throw std::invalid_argument(
+        "Matrix and vector dimensions are not suitable for multiplication.");
+  }
+  S21Vector result(rows_);
+  for (int i = 0; i < rows_; ++i) {
+    result(i) = DotWidenKernel(precision_, values_.data() + Position(i, 0),
+                               vec.data(), cols_);
+  }
+  return result;
+}
+
+/**
+ * @brief Multiplies the matrix by a dense matrix.
+ *
+ * Every entry of this matrix is used once per product, so panels of 64
+ * rows are widened to double and handed to the regular Gemm kernels; the
+ * dense operand, which is read once per row, is not copied.
+ *
+ * @exception std::invalid_argument Thrown if the dimensions do not match.
+ */
+S21Matrix S21CompactMatrix::MulMatrix(const S21Matrix& other) const {
+  if (other.get_rows() != cols_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  int n = other.get_cols();
+  S21Matrix result(rows_, n);
+  std::vector<double> panel(static_cast<std::size_t>(kPanelRows) * cols_);
+  for (int i = 0; i < rows_; i += kPanelRows) {
+    int count = std::min(kPanelRows, rows_ - i);
+    for (int r = 0; r < count; ++r) {
+      WidenKernel(precision_, values_.data() + Position(i + r, 0),
+                  panel.data() + static_cast<std::size_t>(r) * cols_, cols_);
+    }
+    s21_internal::GemmStrided(false, false, count, n, cols_, 1.0,
+                              panel.data(), cols_, other.cbegin(), n, 0.0,
+                              result.data() + static_cast<std::size_t>(i) * n,
+                              n);
+  }
+  return result;
+}
+
+/**
+ * @brief Multiplies two compact matrices; the result is double.
+ *
+ * The right operand is read once per row of the result, so it is never
+ * expanded: each row of the result accumulates axpy updates that widen
+ * eight entries of the right operand at a time in registers. Blocks of 128
+ * of its rows are reused across all rows of the result while they are in
+ * cache. The operands may use different formats.
+ *
+ * @exception std::invalid_argument Thrown if the dimensions do not match.
+ */
+S21Matrix S21CompactMatrix::MulMatrix(const S21CompactMatrix& other) const {
+  if (other.rows_ != cols_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  int n = other.cols_;
+  int k = cols_;
+  S21Matrix result(rows_, n);
+  double* out = result.data();
+  int min_rows = s21_internal::GemmMinRows(n, k);
+  s21_internal::ParallelFor(0, rows_, min_rows, [&](int lo, int hi) {
+    double a_row[kPanelDepth];
+    for (int p0 = 0; p0 < k; p0 += kPanelDepth) {
+      int depth = std::min(kPanelDepth, k - p0);
+      for (int i = lo; i < hi; ++i) {
+        WidenKernel(precision_, values_.data() + Position(i, p0), a_row,
+                    depth);
+        double* c_row = out + static_cast<std::size_t>(i) * n;
+        for (int p = 0; p < depth; ++p) {
+          if (a_row[p] == 0.0) continue;
+          AxpyWidenKernel(other.precision_, a_row[p],
+                          other.values_.data() + other.Position(p0 + p, 0),
+                          c_row, n);
+        }
+      }
+    }
+  });
+  return result;
+}
+
+/**
+ * @brief Entrywise sum, rounded to the format of this matrix.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+S21CompactMatrix S21CompactMatrix::SumMatrix(
+    const S21CompactMatrix& other) const {
+  return Zip(other, [](double x, double y) { return x + y; });
+}
+
+/**
+ * @brief Entrywise difference, rounded to the format of this matrix.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+S21CompactMatrix S21CompactMatrix::SubMatrix(
+    const S21CompactMatrix& other) const {
+  return Zip(other, [](double x, double y) { return x - y; });
+}
+
+/**
+ * @brief Entrywise product, rounded to the format of this matrix.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+S21CompactMatrix S21CompactMatrix::HadamardMul(
+    const S21CompactMatrix& other) const {
+  return Zip(other, [](double x, double y) { return x * y; });
+}
+
+/**
+ * @brief Multiplies every entry by a number, rounding once.
+ */
+S21CompactMatrix S21CompactMatrix::MulNumber(double num) const {
+  S21CompactMatrix result(rows_, cols_, precision_);
+  double buffer[kChunk];
+  for (std::size_t i = 0; i < values_.size(); i += kChunk) {
+    int count = static_cast<int>(
+        std::min<std::size_t>(kChunk, values_.size() - i));
+    WidenKernel(precision_, values_.data() + i, buffer, count);
+    for (int j = 0; j < count; ++j) {
+      result.values_[i + j] = Narrow(precision_, buffer[j] * num);
+    }
+  }
+  return result;
+}
+
+// --- Private methods ---
+
+std::size_t S21CompactMatrix::Position(int row, int col) const {
+  if (row < 0 || row >= rows_ || col < 0 || col >= cols_) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return static_cast<std::size_t>(row) * cols_ + col;
+}
+
+void S21CompactMatrix::CheckSameShape(const S21CompactMatrix& other) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    throw std::invalid_argument("Matrices have different dimensions.");
+  }
+}
+
+/**
+ * @brief Applies op to widened pairs of entries, a chunk at a time, and
+ * rounds the results to the format of this matrix.
+ */
+template <typename Op>
+S21CompactMatrix S21CompactMatrix::Zip(const S21CompactMatrix& other,
+                                       Op op) const {
+  CheckSameShape(other);
+  S21CompactMatrix result(rows_, cols_, precision_);
+  double lhs[kChunk];
+  double rhs[kChunk];
+  for (std::size_t i = 0; i < values_.size(); i += kChunk) {
+    int count = static_cast<int>(
+        std::min<std::size_t>(kChunk, values_.size() - i));
+    WidenKernel(precision_, values_.data() + i, lhs, count);
+    WidenKernel(other.precision_, other.values_.data() + i, rhs, count);
+    for (int j = 0; j < count; ++j) {
+      result.values_[i + j] = Narrow(precision_, op(lhs[j], rhs[j]));
+    }
+  }
+  return result;
+}
@@ -0,0 +1,90 @@
+#ifndef S21_COMPACT_MATRIX_H
+#define S21_COMPACT_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief 16-bit storage formats of S21CompactMatrix.
+ *
+ * kHalf is IEEE 754 binary16: 11 significant bits, normal range about
+ * 6.1e-5 to 65504. kBFloat16 keeps the 8-bit exponent of float with 8
+ * significant bits, so it covers the range of float with less precision.
+ */
+enum class S21Precision { kHalf, kBFloat16 };
+
+/**
+ * @brief Dense row-major matrix stored in 16 bits per entry.
+ *
+ * A quarter of the memory and bandwidth of S21Matrix for read-mostly data
+ * that tolerates 16-bit precision. Entries are rounded to nearest (ties to
+ * even) once, when they are stored; kernels widen them to double as they
+ * are loaded, eight at a time with F16C/AVX2 when the CPU has them and with
+ * a scalar loop otherwise, and accumulate in double.
+ *
+ * Error bounds, with u = UnitRoundoff(precision) (2^-11 for kHalf, 2^-8 for
+ * kBFloat16):
+ *  - storing x gives x * (1 + d), |d| <= u, for x in the normal range;
+ *    smaller kHalf values are stored with absolute error at most 2^-25 and
+ *    values beyond the range become infinities;
+ *  - reading back and ToDense() are exact;
+ *  - products are accurate to double rounding relative to the stored
+ *    values, so relative to the original data each entry of A * B is off by
+ *    at most (u + k * 2^-53) * (|A| |B|)_ij with one compact operand and
+ *    (2u + u^2 + k * 2^-53) * (|A| |B|)_ij with two, k the inner dimension;
+ *  - elementwise results are computed in double from the stored values and
+ *    rounded once more, adding at most u relative error.
+ */
+class S21CompactMatrix {
+ private:
+  int rows_;
+  int cols_;
+  S21Precision precision_;
+  std::vector<std::uint16_t> values_;
+
+  std::size_t Position(int row, int col) const;
+  void CheckSameShape(const S21CompactMatrix& other) const;
+  template <typename Op>
+  S21CompactMatrix Zip(const S21CompactMatrix& other, Op op) const;
+
+ public:
+  // -- Constructors --
+
+  S21CompactMatrix(int rows, int cols, S21Precision precision);
+  S21CompactMatrix(const S21Matrix& dense, S21Precision precision);
+
+  // --- Getters ---
+
+  int get_rows() const;
+  int get_cols() const;
+  S21Precision get_precision() const;
+  static bool get_simd_enabled();
+
+  // --- Setters ---
+
+  void Set(int row, int col, double value);
+  static void set_simd_enabled(bool enabled);
+
+  // --- Accessors ---
+
+  double operator()(int row, int col) const;
+  const std::uint16_t* data() const;
+
+  // --- Public methods ---
+
+  static double UnitRoundoff(S21Precision precision);
+  static double Round(double value, S21Precision precision);
+  S21Matrix ToDense() const;
+  S21Vector MulVector(const S21Vector& vec) const;
+  S21Matrix MulMatrix(const S21Matrix& other) const;
+  S21Matrix MulMatrix(const S21CompactMatrix& other) const;
+  S21CompactMatrix SumMatrix(const S21CompactMatrix& other) const;
+  S21CompactMatrix SubMatrix(const S21CompactMatrix& other) const;
+  S21CompactMatrix HadamardMul(const S21CompactMatrix& other) const;
+  S21CompactMatrix MulNumber(double num) const;
+};
+
+#endif  // S21_COMPACT_MATRIX_H
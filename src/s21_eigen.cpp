@@ -0,0 +1,564 @@
+#include "s21_eigen.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "s21_kernels.h"
+
+namespace {
+// QL sweeps allowed per eigenvalue before giving up; two or three suffice
+// in practice.
+constexpr int kMaxQlIterations = 60;
+constexpr int kMaxJacobiSweeps = 60;
+
+/**
+ * @brief Checks that a is square, finite and symmetric within
+ * n * eps * max|a_ij|.
+ *
+ * The bound follows the scale of the matrix: products such as B^T * B
+ * differ from their transpose by a few ulps of their largest entry, while
+ * an absolute bound would reject them at 1e12 and accept any asymmetry
+ * at 1e-12.
+ */
+void RequireSymmetric(const S21Matrix& a) {
+  int n = a.get_rows();
+  if (a.get_cols() != n) {
+    throw std::invalid_argument("Matrix must be square.");
+  }
+  const double* data = a.data();
+  double largest = 0.0;
+  for (size_t k = 0; k < static_cast<size_t>(n) * n; ++k) {
+    if (!std::isfinite(data[k])) {
+      throw std::invalid_argument("Matrix elements must be finite.");
+    }
+    largest = std::max(largest, std::fabs(data[k]));
+  }
+  double tolerance = n * DBL_EPSILON * largest;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < i; ++j) {
+      double x = data[static_cast<size_t>(i) * n + j];
+      if (std::fabs(x - data[static_cast<size_t>(j) * n + i]) > tolerance) {
+        throw std::invalid_argument("Matrix is not symmetric.");
+      }
+    }
+  }
+}
+
+/**
+ * @brief Householder reduction of a symmetric matrix to tridiagonal form,
+ * A = V T V^T (EISPACK tred2).
+ *
+ * @param v On input the matrix, row-major n x n; on output V if vectors is
+ * set.
+ * @param d Receives the diagonal of T.
+ * @param e Receives the subdiagonal of T in e[1..n-1]; e[0] = 0.
+ */
+void Tridiagonalize(std::vector<double>& v, std::vector<double>& d,
+                    std::vector<double>& e, int n, bool vectors) {
+  auto at = [&](int i, int j) -> double& {
+    return v[static_cast<size_t>(i) * n + j];
+  };
+  d.assign(n, 0.0);
+  e.assign(n, 0.0);
+  for (int j = 0; j < n; ++j) d[j] = at(n - 1, j);
+
+  for (int i = n - 1; i > 0; --i) {
+    double scale = 0.0;
+    double h = 0.0;
+    for (int k = 0; k < i; ++k) scale += std::fabs(d[k]);
+    if (scale == 0.0) {
+      e[i] = d[i - 1];
+      for (int j = 0; j < i; ++j) {
+        d[j] = at(i - 1, j);
+        at(i, j) = 0.0;
+        at(j, i) = 0.0;
+      }
+    } else {
+      // Householder vector of row i, scaled to avoid under/overflow.
+      for (int k = 0; k < i; ++k) {
+        d[k] /= scale;
+        h += d[k] * d[k];
+      }
+      double f = d[i - 1];
+      double g = f > 0 ? -std::sqrt(h) : std::sqrt(h);
+      e[i] = scale * g;
+      h -= f * g;
+      d[i - 1] = f - g;
+      for (int j = 0; j < i; ++j) e[j] = 0.0;
+
+      for (int j = 0; j < i; ++j) {
+        f = d[j];
+        at(j, i) = f;
+        g = e[j] + at(j, j) * f;
+        for (int k = j + 1; k < i; ++k) {
+          g += at(k, j) * d[k];
+          e[k] += at(k, j) * f;
+        }
+        e[j] = g;
+      }
+      f = 0.0;
+      for (int j = 0; j < i; ++j) {
+        e[j] /= h;
+        f += e[j] * d[j];
+      }
+      double hh = f / (h + h);
+      for (int j = 0; j < i; ++j) e[j] -= hh * d[j];
+      for (int j = 0; j < i; ++j) {
+        f = d[j];
+        g = e[j];
+        for (int k = j; k < i; ++k) at(k, j) -= f * e[k] + g * d[k];
+        d[j] = at(i - 1, j);
+        at(i, j) = 0.0;
+      }
+    }
+    d[i] = h;
+  }
+
+  if (!vectors) {
+    for (int j = 0; j < n; ++j) d[j] = at(j, j);
+    e[0] = 0.0;
+    return;
+  }
+  // Accumulate the transformations.
+  for (int i = 0; i < n - 1; ++i) {
+    at(n - 1, i) = at(i, i);
+    at(i, i) = 1.0;
+    double h = d[i + 1];
+    if (h != 0.0) {
+      for (int k = 0; k <= i; ++k) d[k] = at(k, i + 1) / h;
+      for (int j = 0; j <= i; ++j) {
+        double g = 0.0;
+        for (int k = 0; k <= i; ++k) g += at(k, i + 1) * at(k, j);
+        for (int k = 0; k <= i; ++k) at(k, j) -= g * d[k];
+      }
+    }
+    for (int k = 0; k <= i; ++k) at(k, i + 1) = 0.0;
+  }
+  for (int j = 0; j < n; ++j) {
+    d[j] = at(n - 1, j);
+    at(n - 1, j) = 0.0;
+  }
+  at(n - 1, n - 1) = 1.0;
+  e[0] = 0.0;
+}
+
+/**
+ * @brief Eigenvalues of a symmetric tridiagonal matrix by the implicit QL
+ * algorithm with Wilkinson-type shifts (EISPACK tql2), sorted ascending.
+ *
+ * The rotations are applied to the rows of w, so if w holds Q^T on input
+ * its rows hold the eigenvectors of Q T Q^T on output; row i belongs to
+ * d[i]. Rows are contiguous, so each rotation streams over memory.
+ *
+ * @param d The diagonal; receives the eigenvalues.
+ * @param e The subdiagonal in e[1..n-1]; destroyed.
+ * @param w Row-major n x n array to rotate, or nullptr for values only.
+ * @exception std::runtime_error Thrown if the iteration does not converge.
+ */
+void TridiagonalQl(std::vector<double>& d, std::vector<double>& e,
+                   std::vector<double>* w, int n) {
+  for (int i = 1; i < n; ++i) e[i - 1] = e[i];
+  e[n - 1] = 0.0;
+
+  double shift = 0.0;
+  double norm = 0.0;
+  for (int l = 0; l < n; ++l) {
+    norm = std::max(norm, std::fabs(d[l]) + std::fabs(e[l]));
+    int m = l;
+    while (m < n - 1 && std::fabs(e[m]) > DBL_EPSILON * norm) ++m;
+    if (m > l) {
+      int iterations = 0;
+      do {
+        if (++iterations > kMaxQlIterations) {
+          throw std::runtime_error("Eigenvalue iteration did not converge.");
+        }
+        double g = d[l];
+        double p = (d[l + 1] - g) / (2.0 * e[l]);
+        double r = std::hypot(p, 1.0);
+        if (p < 0) r = -r;
+        d[l] = e[l] / (p + r);
+        d[l + 1] = e[l] * (p + r);
+        double dl1 = d[l + 1];
+        double h = g - d[l];
+        for (int i = l + 2; i < n; ++i) d[i] -= h;
+        shift += h;
+
+        p = d[m];
+        double c = 1.0, c2 = 1.0, c3 = 1.0;
+        double el1 = e[l + 1];
+        double s = 0.0, s2 = 0.0;
+        for (int i = m - 1; i >= l; --i) {
+          c3 = c2;
+          c2 = c;
+          s2 = s;
+          g = c * e[i];
+          h = c * p;
+          r = std::hypot(p, e[i]);
+          e[i + 1] = s * r;
+          s = e[i] / r;
+          c = p / r;
+          p = c * d[i] - s * g;
+          d[i + 1] = h + s * (c * g + s * d[i]);
+          if (w) {
+            double* row_i = w->data() + static_cast<size_t>(i) * n;
+            double* row_next = row_i + n;
+            for (int k = 0; k < n; ++k) {
+              double next = row_next[k];
+              row_next[k] = s * row_i[k] + c * next;
+              row_i[k] = c * row_i[k] - s * next;
+            }
+          }
+        }
+        p = -s * s2 * c3 * el1 * e[l] / dl1;
+        e[l] = s * p;
+        d[l] = c * p;
+      } while (std::fabs(e[l]) > DBL_EPSILON * norm);
+    }
+    d[l] += shift;
+    e[l] = 0.0;
+  }
+
+  std::vector<int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&](int x, int y) { return d[x] < d[y]; });
+  std::vector<double> sorted(n);
+  for (int i = 0; i < n; ++i) sorted[i] = d[order[i]];
+  d.swap(sorted);
+  if (w) {
+    std::vector<double> rows(w->size());
+    for (int i = 0; i < n; ++i) {
+      std::copy_n(w->data() + static_cast<size_t>(order[i]) * n, n,
+                  rows.data() + static_cast<size_t>(i) * n);
+    }
+    w->swap(rows);
+  }
+}
+
+/**
+ * @brief Fills x with independent standard normal samples.
+ */
+void FillGaussian(double* x, std::size_t count, std::mt19937_64& engine) {
+  std::normal_distribution<double> normal;
+  for (std::size_t i = 0; i < count; ++i) x[i] = normal(engine);
+}
+
+/**
+ * @brief Makes x orthogonal to the first rows of the row-major basis
+ * (classical Gram-Schmidt, applied twice for stability) and normalizes it.
+ *
+ * @return The norm of x after orthogonalization, before normalization.
+ */
+double Orthonormalize(double* x, const double* basis, int rows, int n) {
+  double before = std::sqrt(s21_internal::DotKernel(x, x, n));
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int i = 0; i < rows; ++i) {
+      const double* q = basis + static_cast<size_t>(i) * n;
+      s21_internal::AxpyKernel(-s21_internal::DotKernel(q, x, n), q, x, n);
+    }
+  }
+  double norm = std::sqrt(s21_internal::DotKernel(x, x, n));
+  // A vector that lost almost all of its length lies in the span.
+  if (norm <= 1e-12 * before || norm == 0.0) return 0.0;
+  for (int k = 0; k < n; ++k) x[k] /= norm;
+  return norm;
+}
+
+/**
+ * @brief Orthonormalizes the rows of m in place. A row that is dependent
+ * on the rows above is replaced by a random unit vector orthogonal to them.
+ */
+void OrthonormalizeRows(S21Matrix& m, std::mt19937_64& engine) {
+  int rows = m.get_rows();
+  int n = m.get_cols();
+  double* data = m.data();
+  for (int i = 0; i < rows; ++i) {
+    double* row = data + static_cast<size_t>(i) * n;
+    while (Orthonormalize(row, data, i, n) == 0.0) {
+      FillGaussian(row, n, engine);
+    }
+  }
+}
+}  // namespace
+
+/**
+ * @brief Computes all eigenvalues, and optionally eigenvectors, of a
+ * symmetric matrix.
+ *
+ * The matrix is reduced to tridiagonal form by Householder reflections
+ * (4/3 n^3 flops, plus 4/3 n^3 to accumulate them) and the tridiagonal
+ * eigenproblem is solved by the implicit QL algorithm (about 3 n^3 flops
+ * for the vectors, O(n^2) for the values alone).
+ *
+ * @param a A symmetric matrix.
+ * @param vectors Whether to compute the eigenvectors.
+ * @return The eigenvalues in ascending order and their eigenvectors.
+ * @exception std::invalid_argument Thrown if the matrix is not square,
+ * symmetric and finite.
+ */
+S21EigenDecomposition S21Eigen::Symmetric(const S21Matrix& a, bool vectors) {
+  RequireSymmetric(a);
+  int n = a.get_rows();
+  std::vector<double> v(a.begin(), a.end());
+  std::vector<double> d;
+  std::vector<double> e;
+  Tridiagonalize(v, d, e, n, vectors);
+
+  S21EigenDecomposition result{S21Vector(n), S21Matrix(1, 1)};
+  if (vectors) {
+    // The QL rotations act on the rows of V^T.
+    std::vector<double> w(v.size());
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        w[static_cast<size_t>(j) * n + i] = v[static_cast<size_t>(i) * n + j];
+      }
+    }
+    TridiagonalQl(d, e, &w, n);
+    result.vectors = S21Matrix(n, n);
+    double* out = result.vectors.data();
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        out[static_cast<size_t>(i) * n + j] = w[static_cast<size_t>(j) * n + i];
+      }
+    }
+  } else {
+    TridiagonalQl(d, e, nullptr, n);
+  }
+  std::copy(d.begin(), d.end(), result.values.data());
+  return result;
+}
+
+/**
+ * @brief Computes k extreme eigenpairs of a symmetric matrix by the Lanczos
+ * method with full reorthogonalization.
+ *
+ * Each step costs one matrix-vector product and O(n * steps) for the
+ * reorthogonalization, so for k << n the cost is far below a full
+ * decomposition. The basis is extended (doubling the number of steps)
+ * until the k wanted Ritz pairs have converged. If the Krylov space becomes
+ * invariant early, the iteration continues from a fresh random vector, so
+ * repeated eigenvalues are found too.
+ *
+ * @param a A symmetric matrix.
+ * @param k Number of eigenpairs, 1 <= k <= n.
+ * @param options The spectrum end, tolerance, step limit and seed.
+ * @return The eigenvalues, ordered from the wanted end inwards, and their
+ * eigenvectors (n x k).
+ * @exception std::invalid_argument Thrown if the matrix is not symmetric or
+ * k is out of range.
+ */
+S21EigenDecomposition S21Eigen::Lanczos(const S21Matrix& a, int k,
+                                       const S21LanczosOptions& options) {
+  RequireSymmetric(a);
+  int n = a.get_rows();
+  if (k < 1 || k > n) {
+    throw std::invalid_argument("Number of eigenpairs is out of range.");
+  }
+  int limit = options.max_steps > 0 ? std::min(options.max_steps, n) : n;
+  limit = std::max(limit, k);
+
+  std::mt19937_64 engine(options.seed);
+  std::vector<double> basis(static_cast<size_t>(n));
+  FillGaussian(basis.data(), n, engine);
+  Orthonormalize(basis.data(), nullptr, 0, n);
+  std::vector<double> alpha;
+  std::vector<double> beta;
+  S21Vector x(n);
+
+  int target = std::min(limit, std::max(2 * k, k + 20));
+  while (true) {
+    // Extend the Lanczos recurrence to target steps.
+    for (int j = static_cast<int>(alpha.size()); j < target; ++j) {
+      const double* q = basis.data() + static_cast<size_t>(j) * n;
+      std::copy_n(q, n, x.data());
+      S21Vector w = a.MulVector(x);
+      alpha.push_back(s21_internal::DotKernel(q, w.data(), n));
+      basis.resize(static_cast<size_t>(j + 2) * n);
+      double* next = basis.data() + static_cast<size_t>(j + 1) * n;
+      std::copy_n(w.data(), n, next);
+      double b = Orthonormalize(next, basis.data(), j + 1, n);
+      while (b == 0.0 && j + 1 < n) {
+        // Invariant subspace: restart from a random orthogonal direction.
+        FillGaussian(next, n, engine);
+        if (Orthonormalize(next, basis.data(), j + 1, n) != 0.0) break;
+      }
+      beta.push_back(b);
+    }
+
+    int m = static_cast<int>(alpha.size());
+    std::vector<double> d(alpha);
+    std::vector<double> e(m, 0.0);
+    for (int i = 1; i < m; ++i) e[i] = beta[i - 1];
+    std::vector<double> w(static_cast<size_t>(m) * m, 0.0);
+    for (int i = 0; i < m; ++i) w[static_cast<size_t>(i) * m + i] = 1.0;
+    TridiagonalQl(d, e, &w, m);
+
+    std::vector<int> order(m);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int p, int q) {
+      switch (options.end) {
+        case S21SpectrumEnd::kSmallest:
+          return d[p] < d[q];
+        case S21SpectrumEnd::kLargestMagnitude:
+          return std::fabs(d[p]) > std::fabs(d[q]);
+        default:
+          return d[p] > d[q];
+      }
+    });
+    double scale = std::max(std::fabs(d.front()), std::fabs(d.back()));
+    bool converged = true;
+    for (int i = 0; i < k; ++i) {
+      double last = w[static_cast<size_t>(order[i]) * m + m - 1];
+      double residual = std::fabs(beta[m - 1] * last);
+      if (residual > options.tolerance * scale) converged = false;
+    }
+
+    if (converged || m >= limit) {
+      S21EigenDecomposition result{S21Vector(k), S21Matrix(n, k)};
+      std::vector<double> ritz(n);
+      double* out = result.vectors.data();
+      for (int i = 0; i < k; ++i) {
+        const double* s = w.data() + static_cast<size_t>(order[i]) * m;
+        std::fill(ritz.begin(), ritz.end(), 0.0);
+        for (int j = 0; j < m; ++j) {
+          s21_internal::AxpyKernel(
+              s[j], basis.data() + static_cast<size_t>(j) * n, ritz.data(), n);
+        }
+        for (int r = 0; r < n; ++r) {
+          out[static_cast<size_t>(r) * k + i] = ritz[r];
+        }
+        result.values(i) = d[order[i]];
+      }
+      return result;
+    }
+    target = std::min(limit, 2 * m);
+  }
+}
+
+/**
+ * @brief Computes the k largest singular values and vectors of a matrix by
+ * randomized range finding (Halko, Martinsson and Tropp).
+ *
+ * The range of A is sampled with l = k + oversampling Gaussian vectors and
+ * refined by power iterations; every pass is a product of A or A^T with a
+ * thin l-column matrix through Gemm, O(m n l) in total. The small l x n
+ * projection B = Q^T A is then decomposed by one-sided Jacobi rotations,
+ * which keeps full relative accuracy in the singular values.
+ *
+ * @param a The matrix, m x n.
+ * @param k Number of singular triplets, 1 <= k <= min(m, n).
+ * @param options Oversampling, power iterations and seed.
+ * @return The singular values in descending order with their left (m x k)
+ * and right (n x k) singular vectors.
+ * @exception std::invalid_argument Thrown if k is out of range or the
+ * options are negative.
+ */
+S21SingularValueDecomposition S21Eigen::RandomizedSvd(
+    const S21Matrix& a, int k, const S21RandomizedSvdOptions& options) {
+  int m = a.get_rows();
+  int n = a.get_cols();
+  if (k < 1 || k > std::min(m, n)) {
+    throw std::invalid_argument("Number of singular values is out of range.");
+  }
+  if (options.oversampling < 0 || options.power_iterations < 0) {
+    throw std::invalid_argument("Options must not be negative.");
+  }
+  int l = std::min(k + options.oversampling, std::min(m, n));
+  std::mt19937_64 engine(options.seed);
+
+  // Q^T (l x m) spans the sampled range of A; rows are contiguous.
+  S21Matrix omega_t(l, n);
+  FillGaussian(omega_t.data(), static_cast<size_t>(l) * n, engine);
+  S21Matrix q_t(l, m);
+  S21Matrix::Gemm(1.0, omega_t, a, 0.0, q_t, S21Transpose::kNone,
+                  S21Transpose::kTranspose);
+  OrthonormalizeRows(q_t, engine);
+  S21Matrix z_t(l, n);
+  for (int pass = 0; pass < options.power_iterations; ++pass) {
+    S21Matrix::Gemm(1.0, q_t, a, 0.0, z_t);
+    OrthonormalizeRows(z_t, engine);
+    S21Matrix::Gemm(1.0, z_t, a, 0.0, q_t, S21Transpose::kNone,
+                    S21Transpose::kTranspose);
+    OrthonormalizeRows(q_t, engine);
+  }
+
+  // B = Q^T A; rotate its rows until they are orthogonal: B = W B'.
+  S21Matrix b(l, n);
+  S21Matrix::Gemm(1.0, q_t, a, 0.0, b);
+  S21Matrix w(l, l);
+  double* rows = b.data();
+  double* rotations = w.data();
+  for (int i = 0; i < l; ++i) rotations[static_cast<size_t>(i) * l + i] = 1.0;
+  for (int sweep = 0; sweep < kMaxJacobiSweeps; ++sweep) {
+    bool rotated = false;
+    for (int p = 0; p < l; ++p) {
+      for (int q = p + 1; q < l; ++q) {
+        double* row_p = rows + static_cast<size_t>(p) * n;
+        double* row_q = rows + static_cast<size_t>(q) * n;
+        double alpha = s21_internal::DotKernel(row_p, row_p, n);
+        double beta = s21_internal::DotKernel(row_q, row_q, n);
+        double gamma = s21_internal::DotKernel(row_p, row_q, n);
+        if (std::fabs(gamma) <= DBL_EPSILON * std::sqrt(alpha * beta)) {
+          continue;
+        }
+        rotated = true;
+        double zeta = (beta - alpha) / (2.0 * gamma);
+        double t = (zeta >= 0 ? 1.0 : -1.0) /
+                   (std::fabs(zeta) + std::sqrt(1.0 + zeta * zeta));
+        double c = 1.0 / std::sqrt(1.0 + t * t);
+        double s = c * t;
+        for (int j = 0; j < n; ++j) {
+          double x = row_p[j];
+          row_p[j] = c * x - s * row_q[j];
+          row_q[j] = s * x + c * row_q[j];
+        }
+        for (int r = 0; r < l; ++r) {
+          double* row = rotations + static_cast<size_t>(r) * l;
+          double x = row[p];
+          row[p] = c * x - s * row[q];
+          row[q] = s * x + c * row[q];
+        }
+      }
+    }
+    if (!rotated) break;
+  }
+
+  // A ~ Q B = (Q W) B', and row i of B' is sigma_i v_i^T.
+  std::vector<double> sigma(l);
+  for (int i = 0; i < l; ++i) {
+    const double* row = rows + static_cast<size_t>(i) * n;
+    sigma[i] = std::sqrt(s21_internal::DotKernel(row, row, n));
+  }
+  std::vector<int> order(l);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](int x, int y) { return sigma[x] > sigma[y]; });
+  S21Matrix u(m, l);
+  S21Matrix::Gemm(1.0, q_t, w, 0.0, u, S21Transpose::kTranspose);
+
+  S21SingularValueDecomposition result{S21Vector(k), S21Matrix(m, k),
+                                       S21Matrix(n, k)};
+  const double* u_data = std::as_const(u).data();
+  double* left = result.left.data();
+  double* right = result.right.data();
+  for (int i = 0; i < k; ++i) {
+    int source = order[i];
+    result.values(i) = sigma[source];
+    for (int r = 0; r < m; ++r) {
+      left[static_cast<size_t>(r) * k + i] =
+          u_data[static_cast<size_t>(r) * l + source];
+    }
+    const double* row = rows + static_cast<size_t>(source) * n;
+    double inverse = sigma[source] > 0.0 ? 1.0 / sigma[source] : 0.0;
+    for (int r = 0; r < n; ++r) {
+      right[static_cast<size_t>(r) * k + i] = row[r] * inverse;
+    }
+  }
+  return result;
+}
@@ -0,0 +1,85 @@
+#ifndef S21_EIGEN_H
+#define S21_EIGEN_H
+
+#include <cstdint>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Eigenvalues and eigenvectors of a symmetric matrix.
+ *
+ * Column j of vectors is the unit eigenvector for values(j), so that
+ * A * vectors = vectors * diag(values). vectors is 1 x 1 when only the
+ * values were requested.
+ */
+struct S21EigenDecomposition {
+  S21Vector values;
+  S21Matrix vectors;
+};
+
+/**
+ * @brief Truncated singular value decomposition A ~ left * diag(values) *
+ * right^T.
+ *
+ * values are in descending order; the columns of left (m x k) and right
+ * (n x k) are orthonormal.
+ */
+struct S21SingularValueDecomposition {
+  S21Vector values;
+  S21Matrix left;
+  S21Matrix right;
+};
+
+/**
+ * @brief Which end of the spectrum Lanczos extracts.
+ */
+enum class S21SpectrumEnd { kLargest, kSmallest, kLargestMagnitude };
+
+/**
+ * @brief Options of S21Eigen::Lanczos.
+ *
+ * An eigenpair is converged when its residual ||A v - l v|| is at most
+ * tolerance times the largest Ritz value magnitude. The Krylov basis grows
+ * until all k pairs converge or it spans max_steps vectors (0 means the
+ * matrix order, where the result is exact up to rounding).
+ */
+struct S21LanczosOptions {
+  S21SpectrumEnd end = S21SpectrumEnd::kLargest;
+  double tolerance = 1e-10;
+  int max_steps = 0;
+  std::uint64_t seed = 1;
+};
+
+/**
+ * @brief Options of S21Eigen::RandomizedSvd.
+ *
+ * The range of A is sampled with k + oversampling random vectors and
+ * refined with power_iterations passes of A A^T, which sharpens the result
+ * when the singular values decay slowly.
+ */
+struct S21RandomizedSvdOptions {
+  int oversampling = 10;
+  int power_iterations = 2;
+  std::uint64_t seed = 1;
+};
+
+/**
+ * @brief Eigenvalue and singular value solvers.
+ *
+ * Symmetric computes the full spectrum in O(n^3) by Householder reduction
+ * to tridiagonal form followed by the implicit QL algorithm. Lanczos and
+ * RandomizedSvd compute only the k dominant pairs; they touch A only through
+ * products with vectors or thin matrices, so their cost grows with k rather
+ * than with n^3.
+ */
+class S21Eigen {
+ public:
+  static S21EigenDecomposition Symmetric(const S21Matrix& a,
+                                         bool vectors = true);
+  static S21EigenDecomposition Lanczos(const S21Matrix& a, int k,
+                                       const S21LanczosOptions& options = {});
+  static S21SingularValueDecomposition RandomizedSvd(
+      const S21Matrix& a, int k, const S21RandomizedSvdOptions& options = {});
+};
+
+#endif  // S21_EIGEN_H
@@ -0,0 +1,84 @@
+#include "s21_executor.h"
+
+#include <stdexcept>
+
+#include "s21_parallel.h"
+
+// --- Constructors ---
+
+/**
+ * @brief Starts a pool with the given number of worker threads.
+ *
+ * @param threads Number of workers.
+ * @exception std::invalid_argument Thrown if threads is less than 1.
+ */
+S21Executor::S21Executor(int threads) : stopping_(false) {
+  if (threads < 1) {
+    throw std::invalid_argument("Executor needs at least one thread.");
+  }
+  workers_.reserve(threads);
+  for (int i = 0; i < threads; ++i) {
+    workers_.emplace_back([this]() { WorkerLoop(); });
+  }
+}
+
+/**
+ * @brief Finishes the queued tasks and joins the workers.
+ */
+S21Executor::~S21Executor() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  ready_.notify_all();
+  for (auto& worker : workers_) worker.join();
+}
+
+// --- Accessors ---
+
+/**
+ * @brief Get the shared pool used by the asynchronous matrix operations.
+ *
+ * @return The process-wide executor.
+ */
+S21Executor& S21Executor::Instance() {
+  static S21Executor executor(s21_internal::HardwareThreads());
+  return executor;
+}
+
+/**
+ * @brief Get the number of worker threads.
+ */
+int S21Executor::get_threads() const {
+  return static_cast<int>(workers_.size());
+}
+
+// --- Helpers ---
+
+/**
+ * @brief Adds a job to the queue and wakes one worker.
+ */
+void S21Executor::Enqueue(std::function<void()> job) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push_back(std::move(job));
+  }
+  ready_.notify_one();
+}
+
+/**
+ * @brief Runs queued jobs until the pool is stopped and the queue is empty.
+ */
+void S21Executor::WorkerLoop() {
+  for (;;) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ready_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) return;
+      job = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    job();
+  }
+}
@@ -0,0 +1,67 @@
+#ifndef S21_EXECUTOR_H
+#define S21_EXECUTOR_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Fixed-size thread pool that runs the library's asynchronous
+ * operations.
+ *
+ * The shared instance is created on first use with one worker per hardware
+ * thread and joins its workers at program exit. Tasks run in submission order
+ * on whichever worker is free.
+ */
+class S21Executor {
+ private:
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> queue_;
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  bool stopping_;
+
+  void WorkerLoop();
+  void Enqueue(std::function<void()> job);
+
+ public:
+  // -- Constructors, destructor --
+
+  explicit S21Executor(int threads);
+  S21Executor(const S21Executor&) = delete;
+  S21Executor& operator=(const S21Executor&) = delete;
+  ~S21Executor();
+
+  // --- Getters ---
+
+  static S21Executor& Instance();
+  int get_threads() const;
+
+  // --- Public methods ---
+
+  template <typename Fn>
+  std::future<std::invoke_result_t<Fn>> Submit(Fn fn);
+};
+
+/**
+ * @brief Schedules fn on the pool.
+ *
+ * @param fn Callable without arguments.
+ * @return A future that receives fn's result or the exception it threw.
+ */
+template <typename Fn>
+std::future<std::invoke_result_t<Fn>> S21Executor::Submit(Fn fn) {
+  using Result = std::invoke_result_t<Fn>;
+  auto task = std::make_shared<std::packaged_task<Result()>>(std::move(fn));
+  std::future<Result> future = task->get_future();
+  Enqueue([task]() { (*task)(); });
+  return future;
+}
+
+#endif  // S21_EXECUTOR_H
@@ -0,0 +1,602 @@
+#include "s21_expression.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "s21_executor.h"
+#include "s21_parallel.h"
+
+namespace {
+// Elements per block of a fused elementwise pass: the per-node temporaries
+// of one block stay in L1.
+constexpr int kFuseBlock = 512;
+// Blocks per thread below which a fused pass stays on one thread.
+constexpr int kFuseParallelBlocks = 64;
+
+enum class Op { kLeaf, kAdd, kSub, kScale, kHadamard, kMul, kTranspose };
+
+bool IsElementwise(Op op) {
+  return op == Op::kAdd || op == Op::kSub || op == Op::kScale ||
+         op == Op::kHadamard;
+}
+
+/**
+ * @brief A node of the deduplicated graph. Steps are stored in topological
+ * order: inputs always precede their consumers.
+ */
+struct Step {
+  Op op = Op::kLeaf;
+  int rows = 0;
+  int cols = 0;
+  const S21Matrix* leaf = nullptr;
+  double scalar = 0.0;
+  int lhs = -1;
+  int rhs = -1;
+  bool trans_lhs = false;
+  bool trans_rhs = false;
+};
+
+/**
+ * @brief One instruction of a fused elementwise pass, in postfix order.
+ * kLeaf pushes the elements of step source.
+ */
+struct Instruction {
+  Op op = Op::kLeaf;
+  int source = -1;
+  double scalar = 0.0;
+};
+
+/**
+ * @brief A matrix Eval computes: a product, a transpose or a fused
+ * elementwise pass.
+ */
+struct Task {
+  int step = -1;
+  std::vector<Instruction> program;
+  int depth = 0;
+  // Distinct steps read by the task, leaves included.
+  std::vector<int> sources;
+};
+
+/**
+ * @brief Deduplicating builder of the step list.
+ */
+class StepTable {
+ public:
+  std::vector<Step> steps;
+
+  /**
+   * @brief Returns the index of an identical step, adding it if it is new.
+   * Operands of commutative operations are ordered, and the transpose of a
+   * transpose resolves to its operand.
+   */
+  int Intern(Step step) {
+    if (step.op == Op::kTranspose && steps[step.lhs].op == Op::kTranspose) {
+      return steps[step.lhs].lhs;
+    }
+    if ((step.op == Op::kAdd || step.op == Op::kHadamard) &&
+        step.lhs > step.rhs) {
+      std::swap(step.lhs, step.rhs);
+    }
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &step.scalar, sizeof(bits));
+    Key key{static_cast<int>(step.op), step.leaf, bits, step.lhs, step.rhs};
+    auto [it, inserted] = index_.emplace(key, static_cast<int>(steps.size()));
+    if (inserted) steps.push_back(step);
+    return it->second;
+  }
+
+ private:
+  using Key = std::tuple<int, const S21Matrix*, std::uint64_t, int, int>;
+  std::map<Key, int> index_;
+};
+
+/**
+ * @brief Appends the postfix program of the elementwise tree rooted at
+ * step; inlined steps are expanded, all others are loaded.
+ *
+ * @return The stack depth the program needs.
+ */
+int EmitProgram(const std::vector<Step>& steps,
+                const std::vector<bool>& inlined, int step, bool root,
+                std::vector<Instruction>& program) {
+  const Step& s = steps[step];
+  if (!root && !inlined[step]) {
+    program.push_back({Op::kLeaf, step, 0.0});
+    return 1;
+  }
+  int depth = EmitProgram(steps, inlined, s.lhs, false, program);
+  if (s.op != Op::kScale) {
+    depth = std::max(depth,
+                     1 + EmitProgram(steps, inlined, s.rhs, false, program));
+  }
+  program.push_back({s.op, -1, s.scalar});
+  return depth;
+}
+
+/**
+ * @brief Evaluates a fused program over elements [first, last) of the
+ * result, one block at a time.
+ *
+ * The stack holds pointers: loads point straight into their source, and
+ * each operation writes into the scratch block of its stack slot (or into
+ * out for the final operation), reading operands that may live in the same
+ * slot element by element.
+ */
+void RunProgram(const Task& task, const std::vector<const double*>& inputs,
+                std::size_t first, std::size_t last, double* out) {
+  std::vector<double> scratch(static_cast<std::size_t>(task.depth) *
+                              kFuseBlock);
+  std::vector<const double*> stack(task.depth);
+  for (std::size_t lo = first; lo < last; lo += kFuseBlock) {
+    int count = static_cast<int>(std::min<std::size_t>(kFuseBlock, last - lo));
+    int top = 0;
+    for (std::size_t p = 0; p < task.program.size(); ++p) {
+      const Instruction& ins = task.program[p];
+      if (ins.op == Op::kLeaf) {
+        stack[top++] = inputs[ins.source] + lo;
+        continue;
+      }
+      bool last_op = p + 1 == task.program.size();
+      if (ins.op == Op::kScale) {
+        const double* a = stack[top - 1];
+        double* dst =
+            last_op ? out + lo : scratch.data() + (top - 1) * kFuseBlock;
+        for (int k = 0; k < count; ++k) dst[k] = a[k] * ins.scalar;
+        stack[top - 1] = dst;
+        continue;
+      }
+      const double* a = stack[top - 2];
+      const double* b = stack[top - 1];
+      double* dst =
+          last_op ? out + lo : scratch.data() + (top - 2) * kFuseBlock;
+      if (ins.op == Op::kAdd) {
+        for (int k = 0; k < count; ++k) dst[k] = a[k] + b[k];
+      } else if (ins.op == Op::kSub) {
+        for (int k = 0; k < count; ++k) dst[k] = a[k] - b[k];
+      } else {
+        for (int k = 0; k < count; ++k) dst[k] = a[k] * b[k];
+      }
+      stack[top - 2] = dst;
+      --top;
+    }
+  }
+}
+}  // namespace
+
+/**
+ * @brief A recorded operation. Leaves point to their matrix; inner nodes
+ * own their operands.
+ */
+struct S21Expression::Node {
+  Op op = Op::kLeaf;
+  int rows = 0;
+  int cols = 0;
+  const S21Matrix* leaf = nullptr;
+  double scalar = 0.0;
+  std::shared_ptr<const Node> lhs;
+  std::shared_ptr<const Node> rhs;
+};
+
+// --- Constructors ---
+
+S21Expression::S21Expression(std::shared_ptr<const Node> node)
+    : node_(std::move(node)) {}
+
+/**
+ * @brief Creates an expression that stands for a matrix.
+ *
+ * @param leaf The matrix; must outlive the expression.
+ */
+S21Expression::S21Expression(const S21Matrix& leaf) {
+  auto node = std::make_shared<Node>();
+  node->rows = leaf.get_rows();
+  node->cols = leaf.get_cols();
+  node->leaf = &leaf;
+  node_ = std::move(node);
+}
+
+// --- Accessors ---
+
+/**
+ * @brief Get the number of rows of the result.
+ */
+int S21Expression::get_rows() const { return node_->rows; }
+
+/**
+ * @brief Get the number of columns of the result.
+ */
+int S21Expression::get_cols() const { return node_->cols; }
+
+// --- Operators ---
+
+/**
+ * @brief Records the sum of two expressions.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+S21Expression S21Expression::operator+(const S21Expression& other) const {
+  if (get_rows() != other.get_rows() || get_cols() != other.get_cols()) {
+    throw std::invalid_argument(
+        "Matrices have different dimensions for SumMatrix.");
+  }
+  return S21Expression(std::make_shared<Node>(Node{
+      Op::kAdd, get_rows(), get_cols(), nullptr, 0.0, node_, other.node_}));
+}
+
+/**
+ * @brief Records the difference of two expressions.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+S21Expression S21Expression::operator-(const S21Expression& other) const {
+  if (get_rows() != other.get_rows() || get_cols() != other.get_cols()) {
+    throw std::invalid_argument(
+        "Matrices have different dimensions for SubMatrix.");
+  }
+  return S21Expression(std::make_shared<Node>(Node{
+      Op::kSub, get_rows(), get_cols(), nullptr, 0.0, node_, other.node_}));
+}
+
+/**
+ * @brief Records the matrix product of two expressions.
+ *
+ * @exception std::invalid_argument Thrown if the number of columns of this
+ * expression differs from the number of rows of other.
+ */
+S21Expression S21Expression::operator*(const S21Expression& other) const {
+  if (get_cols() != other.get_rows()) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  return S21Expression(std::make_shared<Node>(Node{
+      Op::kMul, get_rows(), other.get_cols(), nullptr, 0.0, node_,
+      other.node_}));
+}
+
+/**
+ * @brief Records the product of the expression and a number.
+ */
+S21Expression S21Expression::operator*(double num) const {
+  return S21Expression(std::make_shared<Node>(
+      Node{Op::kScale, get_rows(), get_cols(), nullptr, num, node_, nullptr}));
+}
+
+// --- Public methods ---
+
+/**
+ * @brief Records the transpose of the expression.
+ */
+S21Expression S21Expression::Transpose() const {
+  return S21Expression(std::make_shared<Node>(Node{
+      Op::kTranspose, get_cols(), get_rows(), nullptr, 0.0, node_, nullptr}));
+}
+
+/**
+ * @brief Records the elementwise product of two expressions.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+S21Expression S21Expression::HadamardMul(const S21Expression& other) const {
+  if (get_rows() != other.get_rows() || get_cols() != other.get_cols()) {
+    throw std::invalid_argument(
+        "Matrices have different dimensions for HadamardMul.");
+  }
+  return S21Expression(std::make_shared<Node>(Node{
+      Op::kHadamard, get_rows(), get_cols(), nullptr, 0.0, node_,
+      other.node_}));
+}
+
+/**
+ * @brief Computes the expression on the shared executor.
+ *
+ * @param report Optional; receives what the evaluation did.
+ * @return The value of the expression.
+ */
+S21Matrix S21Expression::Eval(S21EvaluationReport* report) const {
+  return Eval(S21Executor::Instance(), report);
+}
+
+/**
+ * @brief Computes the expression, running independent kernels on executor.
+ *
+ * @param executor The pool for independent kernels.
+ * @param report Optional; receives what the evaluation did.
+ * @return The value of the expression.
+ */
+S21Matrix S21Expression::Eval(S21Executor& executor,
+                              S21EvaluationReport* report) const {
+  return std::move(
+      Eval(std::vector<S21Expression>{*this}, executor, report).front());
+}
+
+/**
+ * @brief Computes several expressions together on the shared executor.
+ *
+ * @param outputs The expressions to compute.
+ * @param report Optional; receives what the evaluation did.
+ * @return The values, in the order of outputs.
+ */
+std::vector<S21Matrix> S21Expression::Eval(
+    const std::vector<S21Expression>& outputs, S21EvaluationReport* report) {
+  return Eval(outputs, S21Executor::Instance(), report);
+}
+
+/**
+ * @brief Computes several expressions together, sharing their common
+ * subexpressions.
+ *
+ * The graph is deduplicated bottom-up: two nodes are the same when they
+ * apply the same operation (and number) to the same operands, where leaves
+ * are the same when they refer to the same matrix. Sums and elementwise
+ * products match with their operands in either order. A transpose that
+ * feeds a product becomes a Gemm flag, so A^T * A reads A in place.
+ * Elementwise operations whose result is used only by another elementwise
+ * operation are not materialized: each maximal such tree is evaluated in
+ * one pass, block by block, with block-sized temporaries.
+ *
+ * The remaining kernels run as soon as their inputs are ready; with more
+ * than one executor thread, independent kernels run at the same time, each
+ * limited to its share of the hardware threads (ThreadLimit) so the
+ * kernels' own threads do not multiply with the executor's. Such tasks use
+ * the builtin kernels even under the OpenBLAS backend, whose own thread
+ * team would ignore the share. An intermediate result is released when
+ * the last kernel reading it has finished, and results are moved, not
+ * copied, into the returned values.
+ * Must not be called from a task running on executor.
+ *
+ * @param outputs The expressions to compute.
+ * @param executor The pool for independent kernels.
+ * @param report Optional; receives what the evaluation did.
+ * @return The values, in the order of outputs.
+ * @exception std::invalid_argument Thrown if a leaf matrix changed shape
+ * since it was recorded.
+ * @exception Rethrows the first exception thrown by a kernel, after the
+ * kernels already running have finished.
+ */
+std::vector<S21Matrix> S21Expression::Eval(
+    const std::vector<S21Expression>& outputs, S21Executor& executor,
+    S21EvaluationReport* report) {
+  // Deduplicate in post-order without recursion.
+  StepTable table;
+  std::unordered_map<const Node*, int> interned;
+  std::vector<std::pair<const Node*, bool>> pending;
+  for (const S21Expression& output : outputs) {
+    pending.emplace_back(output.node_.get(), false);
+  }
+  while (!pending.empty()) {
+    auto [node, expanded] = pending.back();
+    pending.pop_back();
+    if (interned.count(node)) continue;
+    if (!expanded) {
+      pending.emplace_back(node, true);
+      if (node->rhs) pending.emplace_back(node->rhs.get(), false);
+      if (node->lhs) pending.emplace_back(node->lhs.get(), false);
+      continue;
+    }
+    Step step;
+    step.op = node->op;
+    step.rows = node->rows;
+    step.cols = node->cols;
+    step.leaf = node->leaf;
+    step.scalar = node->scalar;
+    if (node->lhs) step.lhs = interned.at(node->lhs.get());
+    if (node->rhs) step.rhs = interned.at(node->rhs.get());
+    interned[node] = table.Intern(step);
+  }
+  std::vector<Step>& steps = table.steps;
+  int count = static_cast<int>(steps.size());
+  std::vector<int> roots;
+  for (const S21Expression& output : outputs) {
+    roots.push_back(interned.at(output.node_.get()));
+  }
+
+  S21EvaluationReport stats;
+  stats.recorded = interned.size();
+  stats.unique = steps.size();
+
+  // Fold transposes into the products that read them.
+  for (Step& step : steps) {
+    if (step.op != Op::kMul) continue;
+    if (steps[step.lhs].op == Op::kTranspose) {
+      step.lhs = steps[step.lhs].lhs;
+      step.trans_lhs = true;
+      ++stats.folded_transposes;
+    }
+    if (steps[step.rhs].op == Op::kTranspose) {
+      step.rhs = steps[step.rhs].lhs;
+      step.trans_rhs = true;
+      ++stats.folded_transposes;
+    }
+  }
+
+  // Find the live steps and how many live steps read each of them.
+  std::vector<bool> is_output(count, false);
+  std::vector<bool> live(count, false);
+  for (int root : roots) is_output[root] = live[root] = true;
+  std::vector<int> readers(count, 0);
+  std::vector<int> reader(count, -1);
+  for (int i = count - 1; i >= 0; --i) {
+    if (!live[i]) continue;
+    for (int input : {steps[i].lhs, steps[i].rhs}) {
+      if (input < 0) continue;
+      live[input] = true;
+      ++readers[input];
+      reader[input] = i;
+    }
+  }
+
+  // An elementwise step read once, by another elementwise step, is inlined
+  // into its reader's pass.
+  std::vector<bool> inlined(count, false);
+  for (int i = 0; i < count; ++i) {
+    inlined[i] = live[i] && IsElementwise(steps[i].op) && !is_output[i] &&
+                 readers[i] == 1 && IsElementwise(steps[reader[i]].op);
+    if (inlined[i]) ++stats.fused;
+  }
+
+  std::vector<Task> tasks;
+  std::vector<int> task_of(count, -1);
+  for (int i = 0; i < count; ++i) {
+    if (!live[i] || inlined[i] || steps[i].op == Op::kLeaf) continue;
+    Task task;
+    task.step = i;
+    if (IsElementwise(steps[i].op)) {
+      task.depth = EmitProgram(steps, inlined, i, true, task.program);
+      for (const Instruction& ins : task.program) {
+        if (ins.op == Op::kLeaf) task.sources.push_back(ins.source);
+      }
+    } else {
+      task.sources.push_back(steps[i].lhs);
+      if (steps[i].rhs >= 0) task.sources.push_back(steps[i].rhs);
+    }
+    std::sort(task.sources.begin(), task.sources.end());
+    task.sources.erase(std::unique(task.sources.begin(), task.sources.end()),
+                       task.sources.end());
+    task_of[i] = static_cast<int>(tasks.size());
+    tasks.push_back(std::move(task));
+  }
+  stats.kernels = tasks.size();
+
+  // Dependencies between tasks and reference counts of their results.
+  std::vector<int> waiting(tasks.size(), 0);
+  std::vector<std::vector<int>> dependents(tasks.size());
+  std::vector<int> references(count, 0);
+  for (std::size_t t = 0; t < tasks.size(); ++t) {
+    for (int source : tasks[t].sources) {
+      if (task_of[source] < 0) continue;
+      ++waiting[t];
+      dependents[task_of[source]].push_back(static_cast<int>(t));
+      ++references[source];
+    }
+  }
+  for (int root : roots) ++references[root];
+
+  std::vector<std::unique_ptr<S21Matrix>> results(count);
+  auto input = [&](int step) -> const S21Matrix& {
+    const S21Matrix& value =
+        steps[step].leaf ? *steps[step].leaf : *results[step];
+    if (value.get_rows() != steps[step].rows ||
+        value.get_cols() != steps[step].cols) {
+      throw std::invalid_argument(
+          "Matrix changed shape after it was recorded in an expression.");
+    }
+    return value;
+  };
+  auto run = [&](const Task& task) {
+    const Step& step = steps[task.step];
+    auto result = std::make_unique<S21Matrix>(step.rows, step.cols);
+    if (step.op == Op::kMul) {
+      S21Matrix::Gemm(1.0, input(step.lhs), input(step.rhs), 0.0, *result,
+                      step.trans_lhs ? S21Transpose::kTranspose
+                                     : S21Transpose::kNone,
+                      step.trans_rhs ? S21Transpose::kTranspose
+                                     : S21Transpose::kNone);
+    } else if (step.op == Op::kTranspose) {
+      *result = input(step.lhs).Transpose();
+    } else {
+      std::vector<const double*> inputs(count, nullptr);
+      for (int source : task.sources) inputs[source] = input(source).data();
+      double* out = result->data();
+      std::size_t size = static_cast<std::size_t>(step.rows) * step.cols;
+      int blocks = static_cast<int>((size + kFuseBlock - 1) / kFuseBlock);
+      s21_internal::ParallelFor(
+          0, blocks, kFuseParallelBlocks, [&](int lo, int hi) {
+            std::size_t first = static_cast<std::size_t>(lo) * kFuseBlock;
+            std::size_t last = static_cast<std::size_t>(hi) * kFuseBlock;
+            RunProgram(task, inputs, first, std::min(size, last), out);
+          });
+    }
+    return result;
+  };
+
+  std::mutex mutex;
+  std::size_t live_results = 0;
+  // Stores a finished result and drops the inputs nobody needs any more;
+  // the caller holds the mutex.
+  auto finish = [&](const Task& task, std::unique_ptr<S21Matrix> result) {
+    results[task.step] = std::move(result);
+    stats.peak_live = std::max(stats.peak_live, ++live_results);
+    for (int source : task.sources) {
+      if (task_of[source] >= 0 && --references[source] == 0) {
+        results[source].reset();
+        --live_results;
+      }
+    }
+  };
+
+  if (executor.get_threads() < 2 || tasks.size() < 2) {
+    // Task order is a topological order.
+    for (const Task& task : tasks) finish(task, run(task));
+  } else {
+    std::condition_variable changed;
+    std::deque<int> ready;
+    int running = 0;
+    std::size_t finished = 0;
+    std::exception_ptr error;
+    int share = std::max(
+        1, s21_internal::HardwareThreads() / executor.get_threads());
+    for (std::size_t t = 0; t < tasks.size(); ++t) {
+      if (waiting[t] == 0) ready.push_back(static_cast<int>(t));
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    while (finished < tasks.size() && !(error && running == 0)) {
+      while (!ready.empty() && !error) {
+        int t = ready.front();
+        ready.pop_front();
+        ++running;
+        executor.Submit([&, t, share]() {
+          s21_internal::ScopedThreadLimit limit(share);
+          std::unique_ptr<S21Matrix> result;
+          std::exception_ptr failure;
+          try {
+            result = run(tasks[t]);
+          } catch (...) {
+            failure = std::current_exception();
+          }
+          std::lock_guard<std::mutex> guard(mutex);
+          if (failure) {
+            if (!error) error = failure;
+          } else {
+            finish(tasks[t], std::move(result));
+            for (int next : dependents[t]) {
+              if (--waiting[next] == 0) ready.push_back(next);
+            }
+            ++finished;
+          }
+          --running;
+          changed.notify_one();
+        });
+      }
+      changed.wait(lock, [&]() {
+        return (!ready.empty() && !error) || running == 0 ||
+               finished == tasks.size();
+      });
+    }
+    if (error) std::rethrow_exception(error);
+  }
+
+  if (report) *report = stats;
+  // Each root holds one reference per occurrence in outputs; all but the
+  // last occurrence copy, the last one takes the result.
+  std::vector<S21Matrix> values;
+  values.reserve(roots.size());
+  for (int root : roots) {
+    if (steps[root].leaf || --references[root] > 0) {
+      values.push_back(input(root));
+    } else {
+      values.push_back(std::move(*results[root]));
+    }
+  }
+  return values;
+}
@@ -0,0 +1,90 @@
+#ifndef S21_EXPRESSION_H
+#define S21_EXPRESSION_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+class S21Executor;
+
+/**
+ * @brief What S21Expression::Eval did with the recorded graph.
+ *
+ * recorded counts distinct node objects reachable from the outputs and
+ * unique the nodes left after merging identical subexpressions. kernels is
+ * the number of matrices actually computed: products, transposes and fused
+ * elementwise passes; fused counts elementwise nodes that were folded into
+ * another pass instead of being materialized, and folded_transposes the
+ * transposes absorbed as Gemm flags. peak_live is the largest number of
+ * intermediate results held at the same time.
+ */
+struct S21EvaluationReport {
+  std::size_t recorded = 0;
+  std::size_t unique = 0;
+  std::size_t kernels = 0;
+  std::size_t fused = 0;
+  std::size_t folded_transposes = 0;
+  std::size_t peak_live = 0;
+};
+
+/**
+ * @brief Deferred matrix expression.
+ *
+ * Operators on expressions record a node of a directed acyclic graph and
+ * check the shapes, but compute nothing. Eval() first merges structurally
+ * identical subexpressions (A^T * A written twice is computed once), folds
+ * transposes feeding a product into Gemm flags and fuses chains of
+ * elementwise operations into single passes over memory. It then runs the
+ * remaining kernels in dependency order, independent branches concurrently
+ * on an S21Executor (the shared one unless another is passed), and frees
+ * every intermediate as soon as its last consumer has run.
+ *
+ * Leaves refer to their matrices, which must outlive the expression and are
+ * read when Eval() runs; temporaries are rejected at compile time.
+ * Expressions are cheap to copy and share nodes.
+ *
+ * Usage: S21Expression a(m), b(n);
+ *        S21Matrix r = (a.Transpose() * a + b * 2.0).Eval();
+ */
+class S21Expression {
+ private:
+  struct Node;
+  std::shared_ptr<const Node> node_;
+
+  explicit S21Expression(std::shared_ptr<const Node> node);
+
+ public:
+  // -- Constructors --
+
+  explicit S21Expression(const S21Matrix& leaf);
+  explicit S21Expression(S21Matrix&& leaf) = delete;
+
+  // --- Getters ---
+
+  int get_rows() const;
+  int get_cols() const;
+
+  // --- Overload operators ---
+
+  S21Expression operator+(const S21Expression& other) const;
+  S21Expression operator-(const S21Expression& other) const;
+  S21Expression operator*(const S21Expression& other) const;
+  S21Expression operator*(double num) const;
+
+  // --- Public methods ---
+
+  S21Expression Transpose() const;
+  S21Expression HadamardMul(const S21Expression& other) const;
+  S21Matrix Eval(S21EvaluationReport* report = nullptr) const;
+  S21Matrix Eval(S21Executor& executor,
+                 S21EvaluationReport* report = nullptr) const;
+  static std::vector<S21Matrix> Eval(const std::vector<S21Expression>& outputs,
+                                     S21EvaluationReport* report = nullptr);
+  static std::vector<S21Matrix> Eval(const std::vector<S21Expression>& outputs,
+                                     S21Executor& executor,
+                                     S21EvaluationReport* report = nullptr);
+};
+
+#endif  // S21_EXPRESSION_H
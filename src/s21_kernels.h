@@ -0,0 +1,87 @@
+#ifndef S21_KERNELS_H
+#define S21_KERNELS_H
+
+#include <cmath>
+
+// Internal contiguous-memory kernels shared by S21Vector and S21Matrix.
+// Every loop keeps several independent accumulators so the compiler can keep
+// them in separate SIMD lanes and the loads stay streaming.
+namespace s21_internal {
+
+/**
+ * @brief Dot product of two contiguous arrays.
+ */
+inline double DotKernel(const double* __restrict x, const double* __restrict y,
+                        int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += x[i] * y[i];
+    s1 += x[i + 1] * y[i + 1];
+    s2 += x[i + 2] * y[i + 2];
+    s3 += x[i + 3] * y[i + 3];
+  }
+  for (; i < n; ++i) s0 += x[i] * y[i];
+  return (s0 + s1) + (s2 + s3);
+}
+
+/**
+ * @brief Computes y += alpha * x over contiguous arrays.
+ */
+inline void AxpyKernel(double alpha, const double* __restrict x,
+                       double* __restrict y, int n) {
+  for (int i = 0; i < n; ++i) y[i] += alpha * x[i];
+}
+
+/**
+ * @brief Sum of a contiguous array.
+ */
+inline double SumKernel(const double* x, int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += x[i];
+    s1 += x[i + 1];
+    s2 += x[i + 2];
+    s3 += x[i + 3];
+  }
+  for (; i < n; ++i) s0 += x[i];
+  return (s0 + s1) + (s2 + s3);
+}
+
+/**
+ * @brief Sum of absolute values of a contiguous array.
+ */
+inline double AbsSumKernel(const double* x, int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += std::fabs(x[i]);
+    s1 += std::fabs(x[i + 1]);
+    s2 += std::fabs(x[i + 2]);
+    s3 += std::fabs(x[i + 3]);
+  }
+  for (; i < n; ++i) s0 += std::fabs(x[i]);
+  return (s0 + s1) + (s2 + s3);
+}
+
+/**
+ * @brief The larger of a and b, NaN if either is NaN (std::fmax drops NaN).
+ */
+inline double NanMax(double a, double b) {
+  return (std::isnan(a) || a > b) ? a : b;
+}
+
+/**
+ * @brief Largest absolute value of a contiguous array; NaN if any element is
+ * NaN, so norms built on it do not hide invalid data.
+ */
+inline double AbsMaxKernel(const double* x, int n) {
+  double m = 0.0;
+  for (int i = 0; i < n; ++i) m = NanMax(m, std::fabs(x[i]));
+  return m;
+}
+
+}  // namespace s21_internal
+
+#endif  // S21_KERNELS_H
@@ -0,0 +1,132 @@
+#include "s21_layout.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "s21_parallel.h"
+
+namespace {
+// Tile edge for copies and elementwise operations between different
+// layouts: a 32 x 32 tile of each operand fits into L1.
+constexpr int kTile = 32;
+// Elements per thread below which a pass stays on one thread.
+constexpr long long kParallelElements = 1LL << 16;
+
+/**
+ * @brief Minimal number of lines of the given length worth handing to a
+ * thread.
+ */
+int MinLines(int length) {
+  return static_cast<int>(
+      std::max(1LL, kParallelElements / std::max(length, 1)));
+}
+
+/**
+ * @brief Applies out(r, c) = fn(a(r, c), b(r, c)) with a row-major output.
+ *
+ * When both inputs are row-major too every row is a contiguous run;
+ * otherwise the matrix is walked in kTile x kTile tiles so that the
+ * column-major inputs are read from a few cache lines per tile.
+ */
+template <typename Fn>
+void ZipRowMajor(int rows, int cols, s21_internal::StridedMatrix a,
+                 s21_internal::StridedMatrix b, double* out,
+                 std::ptrdiff_t out_stride, Fn fn) {
+  if (a.col_step == 1 && b.col_step == 1) {
+    s21_internal::ParallelFor(0, rows, MinLines(cols), [&](int lo, int hi) {
+      for (int r = lo; r < hi; ++r) {
+        const double* x = a.data + r * a.row_step;
+        const double* y = b.data + r * b.row_step;
+        double* z = out + r * out_stride;
+        for (int c = 0; c < cols; ++c) z[c] = fn(x[c], y[c]);
+      }
+    });
+    return;
+  }
+  int tiles = (rows + kTile - 1) / kTile;
+  s21_internal::ParallelFor(
+      0, tiles, MinLines(cols * kTile), [&](int lo, int hi) {
+        for (int r0 = lo * kTile; r0 < std::min(rows, hi * kTile);
+             r0 += kTile) {
+          int r1 = std::min(rows, r0 + kTile);
+          for (int c0 = 0; c0 < cols; c0 += kTile) {
+            int c1 = std::min(cols, c0 + kTile);
+            for (int r = r0; r < r1; ++r) {
+              double* z = out + r * out_stride;
+              for (int c = c0; c < c1; ++c) {
+                z[c] = fn(a.data[r * a.row_step + c * a.col_step],
+                          b.data[r * b.row_step + c * b.col_step]);
+              }
+            }
+          }
+        }
+      });
+}
+
+/**
+ * @brief Swaps the roles of rows and columns, so that a kernel written for
+ * row-major outputs also serves column-major ones.
+ */
+s21_internal::StridedMatrix Transposed(s21_internal::StridedMatrix m) {
+  return {m.data, m.col_step, m.row_step};
+}
+}  // namespace
+
+/**
+ * @brief Copies a strided matrix into a strided destination.
+ *
+ * Equal layouts copy whole contiguous lines; different layouts (a
+ * transposition) go through kTile x kTile tiles written line by line into
+ * the destination.
+ */
+void s21_internal::StridedCopy(int rows, int cols, StridedMatrix src,
+                               double* dst, std::ptrdiff_t dst_row_step,
+                               std::ptrdiff_t dst_col_step) {
+  if (dst_col_step != 1) {
+    src = Transposed(src);
+    std::swap(rows, cols);
+    std::swap(dst_row_step, dst_col_step);
+  }
+  if (src.col_step == 1) {
+    ParallelFor(0, rows, MinLines(cols), [&](int lo, int hi) {
+      for (int r = lo; r < hi; ++r) {
+        std::memmove(dst + r * dst_row_step, src.data + r * src.row_step,
+                     static_cast<std::size_t>(cols) * sizeof(double));
+      }
+    });
+    return;
+  }
+  StridedMatrix zero{src.data, 0, 0};
+  ZipRowMajor(rows, cols, src, zero, dst, dst_row_step,
+              [](double x, double) { return x; });
+}
+
+/**
+ * @brief out = a op b elementwise over strided matrices of any layouts.
+ */
+void s21_internal::StridedZip(ZipOp op, int rows, int cols, StridedMatrix a,
+                              StridedMatrix b, double* out,
+                              std::ptrdiff_t out_row_step,
+                              std::ptrdiff_t out_col_step) {
+  if (out_col_step != 1) {
+    a = Transposed(a);
+    b = Transposed(b);
+    std::swap(rows, cols);
+    std::swap(out_row_step, out_col_step);
+  }
+  switch (op) {
+    case ZipOp::kAdd:
+      ZipRowMajor(rows, cols, a, b, out, out_row_step,
+                  [](double x, double y) { return x + y; });
+      break;
+    case ZipOp::kSub:
+      ZipRowMajor(rows, cols, a, b, out, out_row_step,
+                  [](double x, double y) { return x - y; });
+      break;
+    case ZipOp::kMul:
+      ZipRowMajor(rows, cols, a, b, out, out_row_step,
+                  [](double x, double y) { return x * y; });
+      break;
+  }
+}
@@ -0,0 +1,428 @@
+#ifndef S21_LAYOUT_H
+#define S21_LAYOUT_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Storage order of a matrix view.
+ *
+ * kRowMajor stores each row contiguously (the order of S21Matrix);
+ * kColMajor stores each column contiguously (the order of Fortran, BLAS and
+ * LAPACK).
+ */
+enum class S21Layout { kRowMajor, kColMajor };
+
+/**
+ * @brief The opposite storage order.
+ */
+constexpr S21Layout S21OtherLayout(S21Layout layout) {
+  return layout == S21Layout::kRowMajor ? S21Layout::kColMajor
+                                        : S21Layout::kRowMajor;
+}
+
+namespace s21_internal {
+/**
+ * @brief C = alpha * op(A) * op(B) + beta * C on row-major arrays with
+ * row strides lda, ldb and ldc; C is m x n, k is the inner dimension.
+ */
+void GemmStrided(bool ta, bool tb, int m, int n, int k, double alpha,
+                 const double* a, int lda, const double* b, int ldb,
+                 double beta, double* c, int ldc);
+
+/**
+ * @brief Element (r, c) of a strided matrix is data[r * row_step +
+ * c * col_step]; one of the steps is 1.
+ */
+struct StridedMatrix {
+  const double* data;
+  std::ptrdiff_t row_step;
+  std::ptrdiff_t col_step;
+};
+
+enum class ZipOp { kAdd, kSub, kMul };
+
+void StridedCopy(int rows, int cols, StridedMatrix src, double* dst,
+                 std::ptrdiff_t dst_row_step, std::ptrdiff_t dst_col_step);
+void StridedZip(ZipOp op, int rows, int cols, StridedMatrix a,
+                StridedMatrix b, double* out, std::ptrdiff_t out_row_step,
+                std::ptrdiff_t out_col_step);
+}  // namespace s21_internal
+
+/**
+ * @brief Non-owning view of a rows x cols matrix stored in an external
+ * buffer in the given layout.
+ *
+ * stride is the distance between consecutive rows (kRowMajor) or columns
+ * (kColMajor), at least cols or rows respectively, so a view can also
+ * describe a block of a larger matrix. T is double or const double. The
+ * buffer must outlive the view. A view of an S21Matrix is row-major and
+ * zero-copy. A mutable one keeps a pointer to the matrix and reaches the
+ * elements through S21Matrix::data() on every access, so each write bumps
+ * the version (dropping the cached LU factorization) and detaches the
+ * matrix from copy-on-write copies, like S21Matrix::operator(). A read-only
+ * view holds the buffer itself and must not outlive changes to the matrix
+ * made through other paths. Views of temporary matrices are rejected at
+ * compile time.
+ */
+template <S21Layout L, typename T = double>
+class S21MatrixView {
+  static_assert(std::is_same_v<std::remove_const_t<T>, double>,
+                "S21MatrixView holds double or const double elements.");
+
+ private:
+  T* data_;
+  int rows_;
+  int cols_;
+  int stride_;
+  // Matrix of a mutable view taken from an S21Matrix and the offset of the
+  // first element in it; null for external buffers and read-only views.
+  S21Matrix* owner_ = nullptr;
+  std::ptrdiff_t offset_ = 0;
+
+  template <S21Layout, typename>
+  friend class S21MatrixView;
+
+ public:
+  static constexpr S21Layout kLayout = L;
+
+  // -- Constructors --
+
+  S21MatrixView(T* data, int rows, int cols, int stride = 0);
+  explicit S21MatrixView(S21Matrix& matrix)
+    requires(L == S21Layout::kRowMajor && !std::is_const_v<T>);
+  explicit S21MatrixView(const S21Matrix& matrix)
+    requires(L == S21Layout::kRowMajor && std::is_const_v<T>);
+  explicit S21MatrixView(const S21Matrix&& matrix) = delete;
+  template <typename U>
+  S21MatrixView(const S21MatrixView<L, U>& other)
+    requires(std::is_const_v<T> && !std::is_const_v<U>);
+
+  // --- Getters ---
+
+  int get_rows() const { return rows_; }
+  int get_cols() const { return cols_; }
+  int get_stride() const { return stride_; }
+  T* data() const;
+
+  // --- Overload operators ---
+
+  T& operator()(int row, int col) const;
+
+  // --- Public methods ---
+
+  S21MatrixView<S21OtherLayout(L), T> Transpose() const;
+  S21MatrixView Block(int row, int col, int rows, int cols) const;
+  s21_internal::StridedMatrix Strided() const;
+};
+
+template <S21Layout L>
+using S21ConstMatrixView = S21MatrixView<L, const double>;
+
+/**
+ * @brief Kernels on matrix views of any combination of layouts.
+ *
+ * Every combination maps to one storage-order-aware kernel instead of
+ * converting its operands: a column-major matrix is the row-major buffer of
+ * its transpose, so Gemm folds layouts into transpose flags of the
+ * row-major product, and elementwise operations walk contiguous lines when
+ * all layouts agree and cache-sized tiles when they do not. Outputs must
+ * not overlap the inputs, except that elementwise operations may write into
+ * an input of the same view.
+ */
+class S21LayoutOps {
+ public:
+  template <S21Layout LA, typename TA, S21Layout LB, typename TB,
+            S21Layout LC>
+  static void Gemm(double alpha, const S21MatrixView<LA, TA>& a,
+                   const S21MatrixView<LB, TB>& b, double beta,
+                   const S21MatrixView<LC>& c);
+  template <S21Layout LA, typename TA, S21Layout LB, typename TB>
+  static S21Matrix Multiply(const S21MatrixView<LA, TA>& a,
+                            const S21MatrixView<LB, TB>& b);
+  template <S21Layout LS, typename TS, S21Layout LD>
+  static void Copy(const S21MatrixView<LS, TS>& src,
+                   const S21MatrixView<LD>& dst);
+  template <S21Layout L, typename T>
+  static S21Matrix ToMatrix(const S21MatrixView<L, T>& src);
+  template <S21Layout LA, typename TA, S21Layout LB, typename TB,
+            S21Layout LO>
+  static void Add(const S21MatrixView<LA, TA>& a,
+                  const S21MatrixView<LB, TB>& b,
+                  const S21MatrixView<LO>& out);
+  template <S21Layout LA, typename TA, S21Layout LB, typename TB,
+            S21Layout LO>
+  static void Sub(const S21MatrixView<LA, TA>& a,
+                  const S21MatrixView<LB, TB>& b,
+                  const S21MatrixView<LO>& out);
+  template <S21Layout LA, typename TA, S21Layout LB, typename TB,
+            S21Layout LO>
+  static void HadamardMul(const S21MatrixView<LA, TA>& a,
+                          const S21MatrixView<LB, TB>& b,
+                          const S21MatrixView<LO>& out);
+
+ private:
+  template <S21Layout LA, typename TA, S21Layout LB, typename TB,
+            S21Layout LO>
+  static void Zip(s21_internal::ZipOp op, const S21MatrixView<LA, TA>& a,
+                  const S21MatrixView<LB, TB>& b,
+                  const S21MatrixView<LO>& out);
+};
+
+// --- S21MatrixView ---
+
+/**
+ * @brief Creates a view of an external buffer.
+ *
+ * @param data The first element.
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param stride Distance between rows (kRowMajor) or columns (kColMajor);
+ * 0 means packed.
+ * @exception std::invalid_argument Thrown if a dimension is not positive or
+ * the stride is smaller than a row or column.
+ */
+template <S21Layout L, typename T>
+S21MatrixView<L, T>::S21MatrixView(T* data, int rows, int cols, int stride)
+    : data_(data), rows_(rows), cols_(cols), stride_(stride) {
+  if (rows < 1 || cols < 1) {
+    throw std::invalid_argument("Incorrect matrix dimensions");
+  }
+  int line = L == S21Layout::kRowMajor ? cols : rows;
+  if (stride_ == 0) stride_ = line;
+  if (stride_ < line) {
+    throw std::invalid_argument("Stride is smaller than the matrix line.");
+  }
+}
+
+/**
+ * @brief Creates a mutable row-major view of a matrix.
+ */
+template <S21Layout L, typename T>
+S21MatrixView<L, T>::S21MatrixView(S21Matrix& matrix)
+  requires(L == S21Layout::kRowMajor && !std::is_const_v<T>)
+    : S21MatrixView(matrix.data(), matrix.get_rows(), matrix.get_cols()) {
+  owner_ = &matrix;
+}
+
+/**
+ * @brief Creates a read-only row-major view of a matrix.
+ */
+template <S21Layout L, typename T>
+S21MatrixView<L, T>::S21MatrixView(const S21Matrix& matrix)
+  requires(L == S21Layout::kRowMajor && std::is_const_v<T>)
+    : S21MatrixView(matrix.data(), matrix.get_rows(), matrix.get_cols()) {}
+
+/**
+ * @brief Converts a mutable view to a read-only one.
+ */
+template <S21Layout L, typename T>
+template <typename U>
+S21MatrixView<L, T>::S21MatrixView(const S21MatrixView<L, U>& other)
+  requires(std::is_const_v<T> && !std::is_const_v<U>)
+    : S21MatrixView(other.data(), other.get_rows(), other.get_cols(),
+                    other.get_stride()) {}
+
+/**
+ * @brief The first element; for a mutable view of an S21Matrix this goes
+ * through S21Matrix::data(), which marks the matrix as modified.
+ */
+template <S21Layout L, typename T>
+T* S21MatrixView<L, T>::data() const {
+  if (owner_) return owner_->data() + offset_;
+  return data_;
+}
+
+/**
+ * @brief Bounds-checked element access.
+ *
+ * @exception std::out_of_range Thrown if the index is out of range.
+ */
+template <S21Layout L, typename T>
+T& S21MatrixView<L, T>::operator()(int row, int col) const {
+  if (row >= rows_ || col >= cols_ || row < 0 || col < 0) {
+    throw std::out_of_range("Index out of range.");
+  }
+  std::size_t offset = L == S21Layout::kRowMajor
+                           ? static_cast<std::size_t>(row) * stride_ + col
+                           : static_cast<std::size_t>(col) * stride_ + row;
+  return data()[offset];
+}
+
+/**
+ * @brief The transpose as a view of the same buffer in the other layout;
+ * nothing is copied.
+ */
+template <S21Layout L, typename T>
+S21MatrixView<S21OtherLayout(L), T> S21MatrixView<L, T>::Transpose() const {
+  S21MatrixView<S21OtherLayout(L), T> view(data_, cols_, rows_, stride_);
+  view.owner_ = owner_;
+  view.offset_ = offset_;
+  return view;
+}
+
+/**
+ * @brief View of the rows x cols block whose top-left element is (row,
+ * col).
+ *
+ * @exception std::out_of_range Thrown if the block does not fit.
+ */
+template <S21Layout L, typename T>
+S21MatrixView<L, T> S21MatrixView<L, T>::Block(int row, int col, int rows,
+                                               int cols) const {
+  if (row < 0 || col < 0 || rows < 1 || cols < 1 || row + rows > rows_ ||
+      col + cols > cols_) {
+    throw std::out_of_range("Block is out of range.");
+  }
+  std::ptrdiff_t offset =
+      L == S21Layout::kRowMajor
+          ? static_cast<std::ptrdiff_t>(row) * stride_ + col
+          : static_cast<std::ptrdiff_t>(col) * stride_ + row;
+  S21MatrixView view(data_ + offset, rows, cols, stride_);
+  view.owner_ = owner_;
+  view.offset_ = offset_ + offset;
+  return view;
+}
+
+/**
+ * @brief Layout-independent description for the internal kernels.
+ */
+template <S21Layout L, typename T>
+s21_internal::StridedMatrix S21MatrixView<L, T>::Strided() const {
+  if (L == S21Layout::kRowMajor) return {data(), stride_, 1};
+  return {data(), 1, stride_};
+}
+
+// --- S21LayoutOps ---
+
+/**
+ * @brief C = alpha * A * B + beta * C for views of any layouts.
+ *
+ * A row-major C is computed directly, with a column-major operand read as
+ * the transpose of its row-major buffer. A column-major C is computed as
+ * the row-major C^T = B^T * A^T. Either way the product runs in the
+ * row-major Gemm kernel (or the system BLAS) without copying an operand.
+ *
+ * @exception std::invalid_argument Thrown if the shapes do not match.
+ */
+template <S21Layout LA, typename TA, S21Layout LB, typename TB, S21Layout LC>
+void S21LayoutOps::Gemm(double alpha, const S21MatrixView<LA, TA>& a,
+                        const S21MatrixView<LB, TB>& b, double beta,
+                        const S21MatrixView<LC>& c) {
+  if (a.get_cols() != b.get_rows() || c.get_rows() != a.get_rows() ||
+      c.get_cols() != b.get_cols()) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for Gemm.");
+  }
+  constexpr bool kColA = LA == S21Layout::kColMajor;
+  constexpr bool kColB = LB == S21Layout::kColMajor;
+  if constexpr (LC == S21Layout::kRowMajor) {
+    s21_internal::GemmStrided(kColA, kColB, a.get_rows(), b.get_cols(),
+                              a.get_cols(), alpha, a.data(), a.get_stride(),
+                              b.data(), b.get_stride(), beta, c.data(),
+                              c.get_stride());
+  } else {
+    s21_internal::GemmStrided(!kColB, !kColA, b.get_cols(), a.get_rows(),
+                              a.get_cols(), alpha, b.data(), b.get_stride(),
+                              a.data(), a.get_stride(), beta, c.data(),
+                              c.get_stride());
+  }
+}
+
+/**
+ * @brief The product A * B as a new row-major matrix.
+ *
+ * @exception std::invalid_argument Thrown if the shapes do not match.
+ */
+template <S21Layout LA, typename TA, S21Layout LB, typename TB>
+S21Matrix S21LayoutOps::Multiply(const S21MatrixView<LA, TA>& a,
+                                 const S21MatrixView<LB, TB>& b) {
+  if (a.get_cols() != b.get_rows()) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  S21Matrix result(a.get_rows(), b.get_cols());
+  Gemm(1.0, a, b, 0.0, S21MatrixView<S21Layout::kRowMajor>(result));
+  return result;
+}
+
+/**
+ * @brief Copies src into dst, converting the layout if they differ.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+template <S21Layout LS, typename TS, S21Layout LD>
+void S21LayoutOps::Copy(const S21MatrixView<LS, TS>& src,
+                        const S21MatrixView<LD>& dst) {
+  if (src.get_rows() != dst.get_rows() || src.get_cols() != dst.get_cols()) {
+    throw std::invalid_argument("Matrices have different dimensions.");
+  }
+  s21_internal::StridedMatrix out = dst.Strided();
+  s21_internal::StridedCopy(src.get_rows(), src.get_cols(), src.Strided(),
+                            dst.data(), out.row_step, out.col_step);
+}
+
+/**
+ * @brief Copies a view into a new row-major matrix.
+ */
+template <S21Layout L, typename T>
+S21Matrix S21LayoutOps::ToMatrix(const S21MatrixView<L, T>& src) {
+  S21Matrix result(src.get_rows(), src.get_cols());
+  Copy(src, S21MatrixView<S21Layout::kRowMajor>(result));
+  return result;
+}
+
+/**
+ * @brief out = a + b elementwise.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+template <S21Layout LA, typename TA, S21Layout LB, typename TB, S21Layout LO>
+void S21LayoutOps::Add(const S21MatrixView<LA, TA>& a,
+                       const S21MatrixView<LB, TB>& b,
+                       const S21MatrixView<LO>& out) {
+  Zip(s21_internal::ZipOp::kAdd, a, b, out);
+}
+
+/**
+ * @brief out = a - b elementwise.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+template <S21Layout LA, typename TA, S21Layout LB, typename TB, S21Layout LO>
+void S21LayoutOps::Sub(const S21MatrixView<LA, TA>& a,
+                       const S21MatrixView<LB, TB>& b,
+                       const S21MatrixView<LO>& out) {
+  Zip(s21_internal::ZipOp::kSub, a, b, out);
+}
+
+/**
+ * @brief out = a * b elementwise.
+ *
+ * @exception std::invalid_argument Thrown if the shapes differ.
+ */
+template <S21Layout LA, typename TA, S21Layout LB, typename TB, S21Layout LO>
+void S21LayoutOps::HadamardMul(const S21MatrixView<LA, TA>& a,
+                               const S21MatrixView<LB, TB>& b,
+                               const S21MatrixView<LO>& out) {
+  Zip(s21_internal::ZipOp::kMul, a, b, out);
+}
+
+template <S21Layout LA, typename TA, S21Layout LB, typename TB, S21Layout LO>
+void S21LayoutOps::Zip(s21_internal::ZipOp op, const S21MatrixView<LA, TA>& a,
+                       const S21MatrixView<LB, TB>& b,
+                       const S21MatrixView<LO>& out) {
+  if (a.get_rows() != b.get_rows() || a.get_cols() != b.get_cols() ||
+      a.get_rows() != out.get_rows() || a.get_cols() != out.get_cols()) {
+    throw std::invalid_argument("Matrices have different dimensions.");
+  }
+  s21_internal::StridedMatrix target = out.Strided();
+  s21_internal::StridedZip(op, a.get_rows(), a.get_cols(), a.Strided(),
+                           b.Strided(), out.data(), target.row_step,
+                           target.col_step);
+}
+
+#endif  // S21_LAYOUT_H
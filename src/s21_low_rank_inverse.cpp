@@ -0,0 +1,324 @@
+#include "s21_low_rank_inverse.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "s21_kernels.h"
+
+namespace {
+/**
+ * @brief Wraps a vector into a single-column matrix.
+ */
+S21Matrix ColumnOf(const S21Vector& vec) {
+  S21Matrix column(vec.get_size(), 1);
+  std::copy(vec.data(), vec.data() + vec.get_size(), column.data());
+  return column;
+}
+}  // namespace
+
+// --- Constructors ---
+
+/**
+ * @brief Starts tracking a matrix: computes its inverse and determinant once.
+ *
+ * @param matrix The initial square, non-singular matrix.
+ * @param refactor_interval Number of updates after which the inverse is
+ * always recomputed from scratch.
+ * @param drift_tolerance Accepted entry of the probed column of
+ * A * A^-1 - I beyond n * eps * ||A|| * ||A^-1|| before a refactorization
+ * is forced; a negative value refactorizes after every update.
+ * @exception std::invalid_argument Thrown if the matrix is not square, is
+ * singular, or refactor_interval is less than 1.
+ */
+S21LowRankInverse::S21LowRankInverse(const S21Matrix& matrix,
+                                     int refactor_interval,
+                                     double drift_tolerance)
+    : matrix_(matrix),
+      inverse_(1, 1),
+      determinant_(0.0),
+      refactor_interval_(refactor_interval),
+      drift_tolerance_(drift_tolerance),
+      updates_since_refactor_(0),
+      refactor_count_(0),
+      probe_column_(0) {
+  if (matrix.get_rows() != matrix.get_cols()) {
+    throw std::invalid_argument(
+        "Inverse can only be tracked for a square matrix.");
+  }
+  if (refactor_interval < 1) {
+    throw std::invalid_argument("Refactor interval must be at least 1.");
+  }
+  Refactorize();
+  refactor_count_ = 0;
+}
+
+/**
+ * @brief Starts tracking a matrix whose inverse and determinant are already
+ * known, for example from an earlier factorization; nothing is factorized.
+ *
+ * The inverse is not verified beyond its shape: a wrong one shows up in
+ * the drift probes of the following updates.
+ *
+ * @param matrix The initial square, non-singular matrix.
+ * @param inverse Its inverse.
+ * @param determinant Its determinant.
+ * @param refactor_interval Number of updates after which the inverse is
+ * always recomputed from scratch.
+ * @param drift_tolerance As for the other constructor.
+ * @exception std::invalid_argument Thrown if the matrix is not square, the
+ * inverse has another shape, or refactor_interval is less than 1.
+ */
+S21LowRankInverse::S21LowRankInverse(const S21Matrix& matrix,
+                                     const S21Matrix& inverse,
+                                     double determinant,
+                                     int refactor_interval,
+                                     double drift_tolerance)
+    : matrix_(matrix),
+      inverse_(inverse),
+      determinant_(determinant),
+      refactor_interval_(refactor_interval),
+      drift_tolerance_(drift_tolerance),
+      updates_since_refactor_(0),
+      refactor_count_(0),
+      probe_column_(0) {
+  if (matrix.get_rows() != matrix.get_cols()) {
+    throw std::invalid_argument(
+        "Inverse can only be tracked for a square matrix.");
+  }
+  if (inverse.get_rows() != matrix.get_rows() ||
+      inverse.get_cols() != matrix.get_cols()) {
+    throw std::invalid_argument("Inverse must have the shape of the matrix.");
+  }
+  if (refactor_interval < 1) {
+    throw std::invalid_argument("Refactor interval must be at least 1.");
+  }
+}
+
+// --- Accessors ---
+
+/**
+ * @brief Get the current matrix, with all updates applied.
+ */
+const S21Matrix& S21LowRankInverse::get_matrix() const { return matrix_; }
+
+/**
+ * @brief Get the inverse of the current matrix.
+ */
+const S21Matrix& S21LowRankInverse::get_inverse() const { return inverse_; }
+
+/**
+ * @brief Get the determinant of the current matrix.
+ */
+double S21LowRankInverse::get_determinant() const { return determinant_; }
+
+/**
+ * @brief Get the number of updates applied since the last refactorization.
+ */
+int S21LowRankInverse::get_updates_since_refactor() const {
+  return updates_since_refactor_;
+}
+
+/**
+ * @brief Get the number of refactorizations triggered by the drift check or
+ * the refactor interval, including explicit Refactorize() calls.
+ */
+int S21LowRankInverse::get_refactor_count() const { return refactor_count_; }
+
+// --- Updates ---
+
+/**
+ * @brief Applies the rank-1 update A += u * v^T (Sherman-Morrison).
+ *
+ * @param u Column vector of size n.
+ * @param v Row vector of size n.
+ * @exception std::invalid_argument Thrown if the sizes do not match or the
+ * update makes the matrix singular; the state is left unchanged.
+ */
+void S21LowRankInverse::UpdateRank1(const S21Vector& u, const S21Vector& v) {
+  Update(ColumnOf(u), ColumnOf(v));
+}
+
+/**
+ * @brief Applies the rank-k update A += U * V^T (Sherman-Morrison-Woodbury).
+ *
+ * @param u An n x k matrix.
+ * @param v An n x k matrix.
+ * @exception std::invalid_argument Thrown if the shapes do not match or the
+ * update makes the matrix singular; the state is left unchanged.
+ */
+void S21LowRankInverse::Update(const S21Matrix& u, const S21Matrix& v) {
+  int n = matrix_.get_rows();
+  if (u.get_rows() != n || v.get_rows() != n ||
+      u.get_cols() != v.get_cols()) {
+    throw std::invalid_argument(
+        "Update factors must both be n x k matrices.");
+  }
+  ApplyUpdate(u, v);
+  if (++updates_since_refactor_ >= refactor_interval_) {
+    Refactorize();
+  } else {
+    CheckDrift();
+  }
+}
+
+/**
+ * @brief Replaces one row of the matrix, as a rank-1 update.
+ *
+ * @param row The row index.
+ * @param values The new row, n elements.
+ * @exception std::out_of_range Thrown if the row index is out of range.
+ * @exception std::invalid_argument Thrown if the size does not match or the
+ * new matrix is singular.
+ */
+void S21LowRankInverse::ReplaceRow(int row, const S21Vector& values) {
+  int n = matrix_.get_rows();
+  if (row < 0 || row >= n) {
+    throw std::out_of_range("Index out of range.");
+  }
+  if (values.get_size() != n) {
+    throw std::invalid_argument("Row size does not match the matrix.");
+  }
+  S21Vector unit(n);
+  unit(row) = 1.0;
+  S21Vector delta(values);
+  const S21Matrix& current = matrix_;
+  for (int j = 0; j < n; ++j) delta(j) -= current(row, j);
+  UpdateRank1(unit, delta);
+}
+
+/**
+ * @brief Replaces one column of the matrix, as a rank-1 update.
+ *
+ * @param col The column index.
+ * @param values The new column, n elements.
+ * @exception std::out_of_range Thrown if the column index is out of range.
+ * @exception std::invalid_argument Thrown if the size does not match or the
+ * new matrix is singular.
+ */
+void S21LowRankInverse::ReplaceColumn(int col, const S21Vector& values) {
+  int n = matrix_.get_rows();
+  if (col < 0 || col >= n) {
+    throw std::out_of_range("Index out of range.");
+  }
+  if (values.get_size() != n) {
+    throw std::invalid_argument("Column size does not match the matrix.");
+  }
+  S21Vector unit(n);
+  unit(col) = 1.0;
+  S21Vector delta(values);
+  const S21Matrix& current = matrix_;
+  for (int i = 0; i < n; ++i) delta(i) -= current(i, col);
+  UpdateRank1(delta, unit);
+}
+
+/**
+ * @brief Measures the accumulated error: the largest entry of
+ * A * A^-1 - I. This is an O(n^3) diagnostic.
+ *
+ * @return The max-norm of the residual.
+ */
+double S21LowRankInverse::Drift() const {
+  S21Matrix residual = matrix_ * inverse_;
+  double drift = 0.0;
+  for (int i = 0; i < residual.get_rows(); ++i) {
+    for (int j = 0; j < residual.get_cols(); ++j) {
+      double expected = (i == j) ? 1.0 : 0.0;
+      drift = std::fmax(drift, std::fabs(residual(i, j) - expected));
+    }
+  }
+  return drift;
+}
+
+/**
+ * @brief Recomputes the inverse and determinant from the current matrix.
+ *
+ * @exception std::invalid_argument Thrown if the matrix is singular.
+ */
+void S21LowRankInverse::Refactorize() {
+  inverse_ = matrix_.InverseMatrix();
+  determinant_ = matrix_.Determinant();
+  updates_since_refactor_ = 0;
+  ++refactor_count_;
+}
+
+// --- Helpers ---
+
+/**
+ * @brief Updates matrix, inverse and determinant for A += U * V^T.
+ *
+ * With W = A^-1 U, Z = V^T A^-1 and the k x k capacitance matrix
+ * C = I + V^T W:
+ *   (A + U V^T)^-1 = A^-1 - W C^-1 Z,   det(A + U V^T) = det(A) det(C).
+ * All products involve one n x k factor, so the cost is O(n^2 k). Nothing is
+ * modified if C is singular by the pivot rule of the LU factorization,
+ * which is relative to the scale of the rows of C rather than a fixed bound
+ * on det(C).
+ */
+void S21LowRankInverse::ApplyUpdate(const S21Matrix& u, const S21Matrix& v) {
+  int n = matrix_.get_rows();
+  int k = u.get_cols();
+
+  S21Matrix vt = v.Transpose();
+  S21Matrix w = inverse_ * u;
+  S21Matrix z = vt * inverse_;
+  S21Matrix capacitance = vt * w;
+  for (int i = 0; i < k; ++i) capacitance(i, i) += 1.0;
+
+  S21Matrix identity(k, k);
+  for (int i = 0; i < k; ++i) identity(i, i) = 1.0;
+  S21Matrix capacitance_inverse;
+  try {
+    capacitance_inverse = capacitance.Solve(identity);
+  } catch (const std::invalid_argument&) {
+    throw std::invalid_argument(
+        "Update makes the matrix singular, cannot update inverse.");
+  }
+  double capacitance_det = capacitance.Determinant();
+  S21Matrix correction = w * capacitance_inverse;
+
+  const double* z_data = std::as_const(z).data();
+  const double* vt_data = std::as_const(vt).data();
+  const double* correction_data = std::as_const(correction).data();
+  double* inverse_data = inverse_.data();
+  double* matrix_data = matrix_.data();
+  for (int i = 0; i < n; ++i) {
+    for (int m = 0; m < k; ++m) {
+      s21_internal::AxpyKernel(-correction_data[i * k + m], z_data + m * n,
+                               inverse_data + i * n, n);
+      s21_internal::AxpyKernel(u(i, m), vt_data + m * n,
+                               matrix_data + i * n, n);
+    }
+  }
+  determinant_ *= capacitance_det;
+}
+
+/**
+ * @brief Probes one column of A * A^-1 - I (round-robin) and refactorizes
+ * when its largest entry exceeds n * eps * ||A|| * ||A^-1|| plus the drift
+ * tolerance.
+ *
+ * An absolute bound would refactorize ill-conditioned matrices after every
+ * update: a fresh inverse of the 8 x 8 Hilbert matrix already leaves a
+ * residual near 1e-7. The norms cost O(n^2), like the probe.
+ */
+void S21LowRankInverse::CheckDrift() {
+  int n = matrix_.get_rows();
+  int j = probe_column_;
+  probe_column_ = (probe_column_ + 1) % n;
+
+  const double* a = std::as_const(matrix_).data();
+  const double* inv = std::as_const(inverse_).data();
+  std::vector<double> column(n);
+  for (int i = 0; i < n; ++i) column[i] = inv[i * n + j];
+
+  double drift = 0.0;
+  for (int i = 0; i < n; ++i) {
+    double value = s21_internal::DotKernel(a + i * n, column.data(), n);
+    drift = std::fmax(drift, std::fabs(value - (i == j ? 1.0 : 0.0)));
+  }
+  double inherent = n * DBL_EPSILON * matrix_.NormInf() * inverse_.NormInf();
+  if (!(drift <= inherent + drift_tolerance_)) Refactorize();
+}
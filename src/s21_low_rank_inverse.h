@@ -0,0 +1,62 @@
+#ifndef S21_LOW_RANK_INVERSE_H
+#define S21_LOW_RANK_INVERSE_H
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Keeps the inverse and determinant of a square matrix up to date
+ * under low-rank modifications.
+ *
+ * Every update A += U * V^T of rank k costs O(n^2 k) through the
+ * Sherman-Morrison-Woodbury identity and the matrix determinant lemma instead
+ * of the O(n^3) of a new inversion. Rounding errors accumulate, so after
+ * every update one column of A * A^-1 - I is probed (round-robin, O(n^2));
+ * when its largest entry exceeds n * eps * ||A|| * ||A^-1|| (in the
+ * infinity norm, the residual a backward-stable inversion leaves anyway)
+ * plus the drift tolerance, or after refactor_interval updates, the inverse
+ * is recomputed from scratch. Tracking can also start from an inverse and
+ * determinant the caller already has, without an O(n^3) factorization.
+ */
+class S21LowRankInverse {
+ private:
+  S21Matrix matrix_;
+  S21Matrix inverse_;
+  double determinant_;
+  int refactor_interval_;
+  double drift_tolerance_;
+  int updates_since_refactor_;
+  int refactor_count_;
+  int probe_column_;
+
+  void ApplyUpdate(const S21Matrix& u, const S21Matrix& v);
+  void CheckDrift();
+
+ public:
+  // -- Constructors --
+
+  explicit S21LowRankInverse(const S21Matrix& matrix,
+                             int refactor_interval = 64,
+                             double drift_tolerance = 1e-9);
+  S21LowRankInverse(const S21Matrix& matrix, const S21Matrix& inverse,
+                    double determinant, int refactor_interval = 64,
+                    double drift_tolerance = 1e-9);
+
+  // --- Getters ---
+
+  const S21Matrix& get_matrix() const;
+  const S21Matrix& get_inverse() const;
+  double get_determinant() const;
+  int get_updates_since_refactor() const;
+  int get_refactor_count() const;
+
+  // --- Public methods ---
+
+  void UpdateRank1(const S21Vector& u, const S21Vector& v);
+  void Update(const S21Matrix& u, const S21Matrix& v);
+  void ReplaceRow(int row, const S21Vector& values);
+  void ReplaceColumn(int col, const S21Vector& values);
+  double Drift() const;
+  void Refactorize();
+};
+
+#endif  // S21_LOW_RANK_INVERSE_H
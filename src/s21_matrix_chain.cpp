@@ -0,0 +1,206 @@
+#include "s21_matrix_chain.h"
+
+#include <limits>
+
+// --- Constructors ---
+
+/**
+ * @brief Creates an empty chain.
+ */
+S21MatrixChain::S21MatrixChain() {}
+
+/**
+ * @brief Creates a chain that starts with the given matrix.
+ *
+ * @param first The leftmost operand.
+ */
+S21MatrixChain::S21MatrixChain(const S21Matrix& first) {
+  Append(first);
+}
+
+/**
+ * @brief Creates a chain from a list of operands, left to right.
+ *
+ * @param list The operands of the product.
+ * @exception std::invalid_argument Thrown if neighbouring shapes do not match.
+ */
+S21MatrixChain::S21MatrixChain(
+    std::initializer_list<std::reference_wrapper<const S21Matrix>> list) {
+  for (const S21Matrix& m : list) Append(m);
+}
+
+// --- Accessors ---
+
+/**
+ * @brief Get the number of operands in the chain.
+ *
+ * @return Number of operands.
+ */
+int S21MatrixChain::get_size() const {
+  return static_cast<int>(operands_.size());
+}
+
+// --- Operators ---
+
+/**
+ * @brief Appends a matrix to the right end of the chain.
+ *
+ * @param next The matrix to append.
+ * @return The current chain.
+ */
+S21MatrixChain& S21MatrixChain::operator*=(const S21Matrix& next) {
+  Append(next);
+  return *this;
+}
+
+/**
+ * @brief Returns a new chain extended by a matrix on the right.
+ *
+ * Nothing is multiplied here; this only records the operand.
+ *
+ * @param next The matrix to append.
+ * @return The extended chain.
+ */
+S21MatrixChain S21MatrixChain::operator*(const S21Matrix& next) const {
+  S21MatrixChain result(*this);
+  result.Append(next);
+  return result;
+}
+
+// --- Public methods ---
+
+/**
+ * @brief Appends a matrix to the right end of the chain.
+ *
+ * @param next The matrix to append.
+ * @exception std::invalid_argument Thrown if the number of columns of the
+ * current last operand differs from the number of rows of next.
+ */
+void S21MatrixChain::Append(const S21Matrix& next) {
+  if (!operands_.empty() && operands_.back()->get_cols() != next.get_rows()) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  operands_.push_back(&next);
+  Extend();
+}
+
+/**
+ * @brief Number of scalar multiplications of the optimal parenthesization.
+ *
+ * @return The flop count of Evaluate(), or 0 for chains of fewer than two
+ * operands.
+ */
+double S21MatrixChain::OptimalCost() const {
+  return operands_.empty() ? 0.0 : cost_[0][get_size() - 1];
+}
+
+/**
+ * @brief Number of scalar multiplications of plain left-to-right evaluation,
+ * as performed by chained operator*.
+ *
+ * @return The flop count of ((A0 * A1) * A2) * ...
+ */
+double S21MatrixChain::SequentialCost() const {
+  double cost = 0.0;
+  for (size_t i = 1; i < operands_.size(); ++i) {
+    cost += static_cast<double>(operands_[0]->get_rows()) *
+            operands_[i]->get_rows() * operands_[i]->get_cols();
+  }
+  return cost;
+}
+
+/**
+ * @brief Describes the chosen evaluation order, e.g. "((A0 A1) A2)".
+ *
+ * @return The parenthesized operand list.
+ * @exception std::logic_error Thrown if the chain is empty.
+ */
+std::string S21MatrixChain::Parenthesization() const {
+  if (operands_.empty()) {
+    throw std::logic_error("Matrix chain is empty.");
+  }
+  return DescribeRange(0, get_size() - 1);
+}
+
+/**
+ * @brief Computes the product of the chain in the optimal order.
+ *
+ * Intermediate products are released as soon as they have been consumed, so
+ * at most one temporary per recursion level is alive at any time.
+ *
+ * @return The product of all operands.
+ * @exception std::logic_error Thrown if the chain is empty.
+ */
+S21Matrix S21MatrixChain::Evaluate() const {
+  if (operands_.empty()) {
+    throw std::logic_error("Matrix chain is empty.");
+  }
+  return EvaluateRange(0, get_size() - 1);
+}
+
+// --- Helpers ---
+
+/**
+ * @brief Extends the classic matrix-chain dynamic programme by the operand
+ * just appended: only the sub-chains ending at it are new, so building a
+ * chain of n operands costs O(n^3) in total, as one full run would.
+ *
+ * Costs are kept in double: products of three int dimensions can overflow
+ * 64-bit integers.
+ */
+void S21MatrixChain::Extend() {
+  int n = get_size();
+  int j = n - 1;
+  for (int i = 0; i < j; ++i) {
+    cost_[i].push_back(0.0);
+    split_[i].push_back(0);
+  }
+  cost_.emplace_back(n, 0.0);
+  split_.emplace_back(n, 0);
+
+  auto rows = [this](int i) {
+    return static_cast<double>(operands_[i]->get_rows());
+  };
+  double cols = operands_[j]->get_cols();
+  for (int i = j - 1; i >= 0; --i) {
+    cost_[i][j] = std::numeric_limits<double>::infinity();
+    for (int k = i; k < j; ++k) {
+      double c = cost_[i][k] + cost_[k + 1][j] + rows(i) * rows(k + 1) * cols;
+      if (c < cost_[i][j]) {
+        cost_[i][j] = c;
+        split_[i][j] = k;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Recursively multiplies the operands first..last.
+ *
+ * A leaf on the left side is copied once because MulMatrix works in place;
+ * a computed left product is reused directly.
+ */
+S21Matrix S21MatrixChain::EvaluateRange(int first, int last) const {
+  if (first == last) return *operands_[first];
+
+  int k = split_[first][last];
+  S21Matrix left =
+      (k == first) ? *operands_[first] : EvaluateRange(first, k);
+  if (k + 1 == last) {
+    left.MulMatrix(*operands_[last]);
+  } else {
+    left.MulMatrix(EvaluateRange(k + 1, last));
+  }
+  return left;
+}
+
+/**
+ * @brief Builds the textual form of the optimal order for first..last.
+ */
+std::string S21MatrixChain::DescribeRange(int first, int last) const {
+  if (first == last) return "A" + std::to_string(first);
+  int k = split_[first][last];
+  return "(" + DescribeRange(first, k) + " " + DescribeRange(k + 1, last) +
+         ")";
+}
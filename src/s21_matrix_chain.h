@@ -0,0 +1,63 @@
+#ifndef S21_MATRIX_CHAIN_H
+#define S21_MATRIX_CHAIN_H
+
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Deferred product of several matrices.
+ *
+ * The chain only records references to its operands; the product is computed
+ * by Evaluate() using the parenthesization with the fewest scalar
+ * multiplications, found by dynamic programming on the operand shapes.
+ * Operands must outlive the chain, so temporaries are rejected at compile
+ * time. The dynamic programme is extended on every Append(), which keeps the
+ * const methods free of hidden writes and safe to call concurrently.
+ *
+ * Usage: S21Matrix r = (S21MatrixChain(a) * b * c * d).Evaluate();
+ */
+class S21MatrixChain {
+ private:
+  std::vector<const S21Matrix*> operands_;
+  std::vector<std::vector<double>> cost_;
+  std::vector<std::vector<int>> split_;
+
+  void Extend();
+  S21Matrix EvaluateRange(int first, int last) const;
+  std::string DescribeRange(int first, int last) const;
+
+ public:
+  // -- Constructors --
+
+  S21MatrixChain();
+  explicit S21MatrixChain(const S21Matrix& first);
+  explicit S21MatrixChain(S21Matrix&& first) = delete;
+  S21MatrixChain(
+      std::initializer_list<std::reference_wrapper<const S21Matrix>> list);
+
+  // --- Getters ---
+
+  int get_size() const;
+
+  // --- Overload operators ---
+
+  S21MatrixChain& operator*=(const S21Matrix& next);
+  S21MatrixChain& operator*=(S21Matrix&& next) = delete;
+  S21MatrixChain operator*(const S21Matrix& next) const;
+  S21MatrixChain operator*(S21Matrix&& next) const = delete;
+
+  // --- Public methods ---
+
+  void Append(const S21Matrix& next);
+  void Append(S21Matrix&& next) = delete;
+  double OptimalCost() const;
+  double SequentialCost() const;
+  std::string Parenthesization() const;
+  S21Matrix Evaluate() const;
+};
+
+#endif  // S21_MATRIX_CHAIN_H
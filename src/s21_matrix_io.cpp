@@ -0,0 +1,626 @@
+#include "s21_matrix_io.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "s21_parallel.h"
+
+namespace {
+constexpr std::size_t kWriteBufferBytes = std::size_t{1} << 20;
+
+/**
+ * @brief Reads a file in blocks that end on a line boundary.
+ *
+ * A block never splits a line: the incomplete tail of one read is carried
+ * over to the next block, and the buffer grows when a single line does not
+ * fit into it.
+ */
+class LineChunks {
+ public:
+  LineChunks(const std::string& path, std::size_t chunk_bytes)
+      : file_(std::fopen(path.c_str(), "rb")),
+        buffer_(std::max<std::size_t>(chunk_bytes, 64)) {
+    if (!file_) throw std::runtime_error("Cannot open file: " + path);
+  }
+  LineChunks(const LineChunks&) = delete;
+  LineChunks& operator=(const LineChunks&) = delete;
+  ~LineChunks() { std::fclose(file_); }
+
+  // Stores the next block of complete lines in [*begin, *end); returns false
+  // at the end of the file.
+  bool Next(const char** begin, const char** end) {
+    std::memmove(buffer_.data(), buffer_.data() + consumed_,
+                 size_ - consumed_);
+    size_ -= consumed_;
+    consumed_ = 0;
+    std::size_t block = 0;
+    for (;;) {
+      while (!eof_ && size_ < buffer_.size()) {
+        std::size_t read = std::fread(buffer_.data() + size_, 1,
+                                      buffer_.size() - size_, file_);
+        if (read == 0) eof_ = true;
+        size_ += read;
+      }
+      if (eof_) {
+        block = size_;
+        break;
+      }
+      const char* data = buffer_.data();
+      const char* p = data + size_;
+      while (p != data && p[-1] != '\n') --p;
+      if (p != data) {
+        block = p - data;
+        break;
+      }
+      buffer_.resize(buffer_.size() * 2);
+    }
+    if (block == 0) return false;
+    consumed_ = block;
+    *begin = buffer_.data();
+    *end = buffer_.data() + block;
+    return true;
+  }
+
+ private:
+  std::FILE* file_;
+  std::vector<char> buffer_;
+  std::size_t size_ = 0;
+  std::size_t consumed_ = 0;
+  bool eof_ = false;
+};
+
+/**
+ * @brief Numbers of a range of lines, with the number of values per line.
+ */
+struct ParsedLines {
+  std::vector<double> values;
+  std::vector<int> counts;
+  bool ok = true;
+};
+
+bool IsBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+/**
+ * @brief Parses one number that must span the whole of [begin, end).
+ */
+bool ParseNumber(const char* begin, const char* end, double* value) {
+  if (begin != end && *begin == '+') ++begin;
+  if (begin == end) return false;
+  auto [ptr, ec] = std::from_chars(begin, end, *value);
+  return ec == std::errc() && ptr == end;
+}
+
+/**
+ * @brief Parses the values of one line. delimiter 0 separates values by
+ * blanks; any other delimiter separates fields, which may be padded with
+ * blanks.
+ *
+ * @return The number of values, or -1 if a field is not a number.
+ */
+int ParseLine(const char* p, const char* end, char delimiter,
+              std::vector<double>& values) {
+  int count = 0;
+  double value = 0.0;
+  if (delimiter == 0) {
+    for (;;) {
+      while (p != end && IsBlank(*p)) ++p;
+      if (p == end) return count;
+      const char* token = p;
+      while (p != end && !IsBlank(*p)) ++p;
+      if (!ParseNumber(token, p, &value)) return -1;
+      values.push_back(value);
+      ++count;
+    }
+  }
+  for (;;) {
+    const char* field_end = std::find(p, end, delimiter);
+    const char* first = p;
+    const char* last = field_end;
+    while (first != last && IsBlank(*first)) ++first;
+    while (last != first && IsBlank(last[-1])) --last;
+    if (!ParseNumber(first, last, &value)) return -1;
+    values.push_back(value);
+    ++count;
+    if (field_end == end) return count;
+    p = field_end + 1;
+  }
+}
+
+/**
+ * @brief Parses every line of [begin, end), skipping blank lines and, if
+ * comment is not 0, lines that start with it.
+ */
+void ParseRange(const char* begin, const char* end, char delimiter,
+                char comment, ParsedLines& out) {
+  while (begin != end && out.ok) {
+    const char* line_end = std::find(begin, end, '\n');
+    const char* first = begin;
+    while (first != line_end && IsBlank(*first)) ++first;
+    if (first != line_end && (comment == 0 || *first != comment)) {
+      int count = ParseLine(begin, line_end, delimiter, out.values);
+      if (count < 0) out.ok = false;
+      out.counts.push_back(count);
+    }
+    begin = line_end == end ? end : line_end + 1;
+  }
+}
+
+/**
+ * @brief Parses a block of complete lines, in parallel pieces split at line
+ * boundaries when the block is large enough. Pieces are returned in order.
+ *
+ * @exception std::invalid_argument Thrown if a value is not a number.
+ */
+std::vector<ParsedLines> ParseBlock(const char* begin, const char* end,
+                                    const S21TextIoOptions& options,
+                                    char delimiter, char comment) {
+  std::size_t bytes = end - begin;
+  int pieces = 1;
+  if (options.parallel && bytes >= options.parallel_min_bytes) {
+    pieces = s21_internal::HardwareThreads();
+  }
+  std::vector<const char*> bounds(pieces + 1, end);
+  bounds[0] = begin;
+  for (int p = 1; p < pieces; ++p) {
+    const char* guess = std::max(bounds[p - 1], begin + bytes * p / pieces);
+    const char* newline = std::find(guess, end, '\n');
+    bounds[p] = newline == end ? end : newline + 1;
+  }
+
+  std::vector<ParsedLines> parsed(pieces);
+  s21_internal::ParallelFor(0, pieces, 1, [&](int lo, int hi) {
+    for (int p = lo; p < hi; ++p) {
+      ParseRange(bounds[p], bounds[p + 1], delimiter, comment, parsed[p]);
+    }
+  });
+  for (const ParsedLines& piece : parsed) {
+    if (!piece.ok) {
+      throw std::invalid_argument("Invalid number in matrix file.");
+    }
+  }
+  return parsed;
+}
+
+/**
+ * @brief Lower-case words of a header line.
+ */
+std::vector<std::string> Words(std::string_view line) {
+  std::vector<std::string> words;
+  std::size_t i = 0;
+  while (i < line.size()) {
+    while (i < line.size() &&
+           std::isspace(static_cast<unsigned char>(line[i]))) {
+      ++i;
+    }
+    std::size_t start = i;
+    while (i < line.size() &&
+           !std::isspace(static_cast<unsigned char>(line[i]))) {
+      ++i;
+    }
+    if (i > start) {
+      std::string word(line.substr(start, i - start));
+      for (char& c : word) c = std::tolower(static_cast<unsigned char>(c));
+      words.push_back(word);
+    }
+  }
+  return words;
+}
+
+/**
+ * @brief Whether a line after the banner is the size line: not blank and,
+ * once leading blanks are skipped, not a comment.
+ */
+bool IsSizeLine(std::string_view line) {
+  std::size_t first = 0;
+  while (first < line.size() &&
+         std::isspace(static_cast<unsigned char>(line[first]))) {
+    ++first;
+  }
+  return first < line.size() && line[first] != '%';
+}
+
+/**
+ * @brief Matrix Market banner and size line.
+ */
+struct MarketHeader {
+  bool coordinate = false;
+  bool pattern = false;
+  bool symmetric = false;
+  bool skew = false;
+  int rows = 0;
+  int cols = 0;
+  long long entries = 0;
+};
+
+/**
+ * @brief Parses the banner line.
+ *
+ * @exception std::invalid_argument Thrown if the banner is missing or
+ * describes an unsupported matrix.
+ */
+MarketHeader ParseBanner(std::string_view line) {
+  std::vector<std::string> words = Words(line);
+  if (words.size() != 5 || words[0] != "%%matrixmarket" ||
+      words[1] != "matrix") {
+    throw std::invalid_argument("Missing Matrix Market banner.");
+  }
+  MarketHeader header;
+  if (words[2] == "coordinate") {
+    header.coordinate = true;
+  } else if (words[2] != "array") {
+    throw std::invalid_argument("Unsupported Matrix Market format.");
+  }
+  if (words[3] == "pattern" && header.coordinate) {
+    header.pattern = true;
+  } else if (words[3] != "real" && words[3] != "integer") {
+    throw std::invalid_argument("Unsupported Matrix Market field.");
+  }
+  if (words[4] == "symmetric") {
+    header.symmetric = true;
+  } else if (words[4] == "skew-symmetric") {
+    header.symmetric = true;
+    header.skew = true;
+  } else if (words[4] != "general") {
+    throw std::invalid_argument("Unsupported Matrix Market symmetry.");
+  }
+  return header;
+}
+
+/**
+ * @brief Whether value is a whole number in [low, high]; NaN is not.
+ *
+ * Checked before every conversion of a parsed size or index to an integer,
+ * which is undefined for values out of range.
+ */
+bool IsWholeIn(double value, double low, double high) {
+  return value >= low && value <= high && value == std::floor(value);
+}
+
+/**
+ * @brief Parses the size line into the header.
+ *
+ * @exception std::invalid_argument Thrown if the sizes are malformed: not
+ * whole numbers, dimensions outside [1, INT_MAX], or more entries than the
+ * matrix has elements.
+ */
+void ParseSize(const char* begin, const char* end, MarketHeader& header) {
+  std::vector<double> sizes;
+  int count = ParseLine(begin, end, 0, sizes);
+  if (count != (header.coordinate ? 3 : 2) ||
+      !IsWholeIn(sizes[0], 1, INT_MAX) || !IsWholeIn(sizes[1], 1, INT_MAX) ||
+      (header.coordinate && !IsWholeIn(sizes[2], 0, sizes[0] * sizes[1])) ||
+      (header.symmetric && sizes[0] != sizes[1])) {
+    throw std::invalid_argument("Invalid Matrix Market size line.");
+  }
+  header.rows = static_cast<int>(sizes[0]);
+  header.cols = static_cast<int>(sizes[1]);
+  header.entries = header.coordinate
+                       ? static_cast<long long>(sizes[2])
+                       : (header.symmetric
+                              ? static_cast<long long>(header.rows) *
+                                    (header.rows + (header.skew ? -1 : 1)) / 2
+                              : static_cast<long long>(header.rows) *
+                                    header.cols);
+}
+
+/**
+ * @brief Places the values of an array-format file, column by column.
+ */
+class ArrayFiller {
+ public:
+  ArrayFiller(S21Matrix& matrix, const MarketHeader& header)
+      : out_(matrix.data()), header_(header) {
+    row_ = header.skew ? 1 : 0;
+    if (row_ >= header_.rows) col_ = header_.cols;
+  }
+
+  void Add(const std::vector<double>& values) {
+    for (double value : values) {
+      if (col_ >= header_.cols) {
+        throw std::invalid_argument("Too many values in Matrix Market file.");
+      }
+      out_[Index(row_, col_)] = value;
+      if (header_.symmetric && row_ != col_) {
+        out_[Index(col_, row_)] = header_.skew ? -value : value;
+      }
+      ++added_;
+      if (++row_ == header_.rows) {
+        ++col_;
+        row_ = header_.symmetric ? col_ + (header_.skew ? 1 : 0) : 0;
+        if (row_ >= header_.rows) col_ = header_.cols;
+      }
+    }
+  }
+
+  long long get_added() const { return added_; }
+
+ private:
+  std::size_t Index(int row, int col) const {
+    return static_cast<std::size_t>(row) * header_.cols + col;
+  }
+
+  double* out_;
+  const MarketHeader& header_;
+  int row_ = 0;
+  int col_ = 0;
+  long long added_ = 0;
+};
+
+/**
+ * @brief Buffered writer that formats numbers with std::to_chars.
+ */
+class TextWriter {
+ public:
+  explicit TextWriter(const std::string& path)
+      : path_(path), file_(std::fopen(path.c_str(), "wb")) {
+    if (!file_) throw std::runtime_error("Cannot open file: " + path);
+    buffer_.resize(kWriteBufferBytes);
+  }
+  TextWriter(const TextWriter&) = delete;
+  TextWriter& operator=(const TextWriter&) = delete;
+  ~TextWriter() {
+    if (file_) std::fclose(file_);
+  }
+
+  void Put(double value) {
+    Reserve(32);
+    used_ = std::to_chars(buffer_.data() + used_,
+                          buffer_.data() + buffer_.size(), value)
+                .ptr -
+            buffer_.data();
+  }
+  void Put(long long value) {
+    Reserve(24);
+    used_ = std::to_chars(buffer_.data() + used_,
+                          buffer_.data() + buffer_.size(), value)
+                .ptr -
+            buffer_.data();
+  }
+  void Put(char c) {
+    Reserve(1);
+    buffer_[used_++] = c;
+  }
+  void Put(std::string_view text) {
+    for (char c : text) Put(c);
+  }
+
+  // Writes the rest of the buffer and closes the file.
+  void Close() {
+    Flush();
+    std::FILE* file = file_;
+    file_ = nullptr;
+    if (std::fclose(file) != 0) {
+      throw std::runtime_error("Cannot write file: " + path_);
+    }
+  }
+
+ private:
+  void Reserve(std::size_t bytes) {
+    if (used_ + bytes > buffer_.size()) Flush();
+  }
+  void Flush() {
+    if (used_ && std::fwrite(buffer_.data(), 1, used_, file_) != used_) {
+      throw std::runtime_error("Cannot write file: " + path_);
+    }
+    used_ = 0;
+  }
+
+  std::string path_;
+  std::FILE* file_;
+  std::vector<char> buffer_;
+  std::size_t used_ = 0;
+};
+}  // namespace
+
+// --- Readers ---
+
+/**
+ * @brief Reads a matrix from a CSV file: one row per line, values separated
+ * by options.delimiter. Blank lines are skipped and fields may be padded
+ * with blanks.
+ *
+ * @param path The file to read.
+ * @param options Delimiter, chunk size and parallel parsing.
+ * @return The matrix.
+ * @exception std::runtime_error Thrown if the file cannot be opened.
+ * @exception std::invalid_argument Thrown if the file is empty, a field is
+ * not a number, or the rows have different lengths.
+ */
+S21Matrix S21MatrixIo::ReadCsv(const std::string& path,
+                               const S21TextIoOptions& options) {
+  LineChunks chunks(path, options.chunk_bytes);
+  std::vector<double> values;
+  int rows = 0;
+  int cols = 0;
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  while (chunks.Next(&begin, &end)) {
+    for (ParsedLines& piece :
+         ParseBlock(begin, end, options, options.delimiter, 0)) {
+      for (int count : piece.counts) {
+        if (rows == 0) cols = count;
+        if (count != cols) {
+          throw std::invalid_argument("CSV rows have different lengths.");
+        }
+        ++rows;
+      }
+      values.insert(values.end(), piece.values.begin(), piece.values.end());
+    }
+  }
+  if (rows == 0) throw std::invalid_argument("CSV file has no rows.");
+  S21Matrix result(rows, cols);
+  std::copy(values.begin(), values.end(), result.data());
+  return result;
+}
+
+/**
+ * @brief Reads a matrix from a Matrix Market file.
+ *
+ * Array files list the values column by column (only the lower triangle
+ * for symmetric matrices); coordinate files list 1-based (row, col, value)
+ * entries, and entries that are not listed are zero. Symmetric and
+ * skew-symmetric entries are mirrored.
+ *
+ * @param path The file to read.
+ * @param options Chunk size and parallel parsing; the delimiter is ignored.
+ * @return The matrix.
+ * @exception std::runtime_error Thrown if the file cannot be opened.
+ * @exception std::invalid_argument Thrown if the header is missing or
+ * unsupported, or the data is malformed or does not match the header.
+ */
+S21Matrix S21MatrixIo::ReadMatrixMarket(const std::string& path,
+                                        const S21TextIoOptions& options) {
+  LineChunks chunks(path, options.chunk_bytes);
+  MarketHeader header;
+  bool banner = false;
+  bool sized = false;
+  S21Matrix result(1, 1);
+  std::unique_ptr<ArrayFiller> filler;
+  long long entries = 0;
+  int width = 3;
+
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  while (chunks.Next(&begin, &end)) {
+    while (!sized && begin != end) {
+      const char* line_end = std::find(begin, end, '\n');
+      std::string_view line(begin, line_end - begin);
+      const char* next = line_end == end ? end : line_end + 1;
+      if (!banner) {
+        header = ParseBanner(line);
+        banner = true;
+      } else if (IsSizeLine(line)) {
+        ParseSize(begin, line_end, header);
+        sized = true;
+        result = S21Matrix(header.rows, header.cols);
+        if (!header.coordinate) {
+          filler = std::make_unique<ArrayFiller>(result, header);
+        }
+        width = header.pattern ? 2 : 3;
+      }
+      begin = next;
+    }
+    if (!sized) continue;
+
+    for (ParsedLines& piece : ParseBlock(begin, end, options, 0, '%')) {
+      if (filler) {
+        filler->Add(piece.values);
+        continue;
+      }
+      double* out = result.data();
+      std::size_t at = 0;
+      for (int count : piece.counts) {
+        if (count != width) {
+          throw std::invalid_argument("Invalid Matrix Market entry.");
+        }
+        double row = piece.values[at];
+        double col = piece.values[at + 1];
+        double value = header.pattern ? 1.0 : piece.values[at + 2];
+        at += width;
+        if (!IsWholeIn(row, 1, header.rows) ||
+            !IsWholeIn(col, 1, header.cols)) {
+          throw std::invalid_argument("Matrix Market entry out of range.");
+        }
+        int i = static_cast<int>(row) - 1;
+        int j = static_cast<int>(col) - 1;
+        out[static_cast<std::size_t>(i) * header.cols + j] = value;
+        if (header.symmetric && i != j) {
+          out[static_cast<std::size_t>(j) * header.cols + i] =
+              header.skew ? -value : value;
+        }
+        ++entries;
+      }
+    }
+  }
+  if (!sized) throw std::invalid_argument("Missing Matrix Market size line.");
+  if ((filler ? filler->get_added() : entries) != header.entries) {
+    throw std::invalid_argument(
+        "Matrix Market entry count does not match the header.");
+  }
+  return result;
+}
+
+// --- Writers ---
+
+/**
+ * @brief Writes a matrix as CSV, one row per line.
+ *
+ * @param matrix The matrix to write.
+ * @param path The file to create or overwrite.
+ * @param options The delimiter.
+ * @exception std::runtime_error Thrown if the file cannot be written.
+ */
+void S21MatrixIo::WriteCsv(const S21Matrix& matrix, const std::string& path,
+                           const S21TextIoOptions& options) {
+  TextWriter writer(path);
+  for (int i = 0; i < matrix.get_rows(); ++i) {
+    std::span<const double> row = matrix.row(i);
+    for (std::size_t j = 0; j < row.size(); ++j) {
+      if (j) writer.Put(options.delimiter);
+      writer.Put(row[j]);
+    }
+    writer.Put('\n');
+  }
+  writer.Close();
+}
+
+/**
+ * @brief Writes a matrix as a general real Matrix Market file.
+ *
+ * @param matrix The matrix to write.
+ * @param path The file to create or overwrite.
+ * @param coordinate Write only the non-zero entries (coordinate format)
+ * instead of all values column by column (array format).
+ * @exception std::runtime_error Thrown if the file cannot be written.
+ */
+void S21MatrixIo::WriteMatrixMarket(const S21Matrix& matrix,
+                                    const std::string& path,
+                                    bool coordinate) {
+  int rows = matrix.get_rows();
+  int cols = matrix.get_cols();
+  const double* data = matrix.data();
+  TextWriter writer(path);
+  writer.Put(coordinate ? "%%MatrixMarket matrix coordinate real general\n"
+                        : "%%MatrixMarket matrix array real general\n");
+  writer.Put(static_cast<long long>(rows));
+  writer.Put(' ');
+  writer.Put(static_cast<long long>(cols));
+  if (coordinate) {
+    long long nonzeros = std::count_if(
+        data, data + static_cast<std::size_t>(rows) * cols,
+        [](double value) { return value != 0.0; });
+    writer.Put(' ');
+    writer.Put(nonzeros);
+    writer.Put('\n');
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j) {
+        double value = data[static_cast<std::size_t>(i) * cols + j];
+        if (value == 0.0) continue;
+        writer.Put(static_cast<long long>(i) + 1);
+        writer.Put(' ');
+        writer.Put(static_cast<long long>(j) + 1);
+        writer.Put(' ');
+        writer.Put(value);
+        writer.Put('\n');
+      }
+    }
+  } else {
+    writer.Put('\n');
+    for (int j = 0; j < cols; ++j) {
+      for (int i = 0; i < rows; ++i) {
+        writer.Put(data[static_cast<std::size_t>(i) * cols + j]);
+        writer.Put('\n');
+      }
+    }
+  }
+  writer.Close();
+}
@@ -0,0 +1,52 @@
+#ifndef S21_MATRIX_IO_H
+#define S21_MATRIX_IO_H
+
+#include <cstddef>
+#include <string>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Options of the text readers and writers.
+ *
+ * Files are processed in chunks of chunk_bytes that always end on a line
+ * boundary. With parallel set, a chunk of at least parallel_min_bytes is
+ * split at line boundaries and its pieces are parsed on several threads;
+ * the pieces are merged in file order, so the result does not depend on
+ * the thread count.
+ */
+struct S21TextIoOptions {
+  char delimiter = ',';
+  bool parallel = true;
+  std::size_t chunk_bytes = std::size_t{16} << 20;
+  std::size_t parallel_min_bytes = std::size_t{1} << 20;
+};
+
+/**
+ * @brief Reads and writes matrices as CSV and Matrix Market text.
+ *
+ * Numbers are parsed with std::from_chars and printed with std::to_chars in
+ * the shortest form that reads back to the same double, so a write followed
+ * by a read reproduces the matrix exactly. Matrix Market input accepts the
+ * array and coordinate formats with real, integer or pattern fields and
+ * general, symmetric or skew-symmetric structure.
+ */
+class S21MatrixIo {
+ public:
+  // --- Readers ---
+
+  static S21Matrix ReadCsv(const std::string& path,
+                           const S21TextIoOptions& options = {});
+  static S21Matrix ReadMatrixMarket(const std::string& path,
+                                    const S21TextIoOptions& options = {});
+
+  // --- Writers ---
+
+  static void WriteCsv(const S21Matrix& matrix, const std::string& path,
+                       const S21TextIoOptions& options = {});
+  static void WriteMatrixMarket(const S21Matrix& matrix,
+                                const std::string& path,
+                                bool coordinate = false);
+};
+
+#endif  // S21_MATRIX_IO_H
@@ -0,0 +1,33 @@
+#ifndef S21_MATRIX_LU_H
+#define S21_MATRIX_LU_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief LU factorization with partial pivoting, PA = LU.
+ *
+ * Internal to the library. L (unit diagonal) and U are packed into one
+ * row-major n x n array; row i of PA is row permutation[i] of A. A
+ * factorization is immutable once built and tagged with the matrix version
+ * it was computed from. Compute() can report its progress through on_step,
+ * called with the number of eliminated columns every 32 columns; the
+ * callback may throw to abandon the factorization.
+ */
+struct S21Matrix::LuFactorization {
+  int n = 0;
+  std::uint64_t version = 0;
+  std::vector<double> lu;
+  std::vector<int> permutation;
+  double determinant = 0.0;
+  bool singular = false;
+
+  void Compute(const double* a, int order,
+               const std::function<void(int)>& on_step = {});
+  void Solve(const double* b, double* x) const;
+};
+
+#endif  // S21_MATRIX_LU_H
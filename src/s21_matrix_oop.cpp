@@ -1,5 +1,20 @@
 #include "s21_matrix_oop.h"
 
+#include <vector>
+
+#include "s21_backend.h"
+#include "s21_kernels.h"
+#include "s21_layout.h"
+#include "s21_matrix_lu.h"
+#include "s21_parallel.h"
+#include "s21_result_cache.h"
+#include "s21_small_kernels.h"
+
+namespace {
+// Largest product, in elements (8 MiB), formed in the per-thread workspace.
+constexpr std::size_t kWorkspaceElements = std::size_t{1} << 20;
+}  // namespace
+
 // --- Base methods ---
 
 /**
@@ -19,7 +34,8 @@ bool S21Matrix::EqMatrix(const S21Matrix& other) const {
   }
   for (int i = 0; i < rows_; ++i) {
     for (int j = 0; j < cols_; ++j) {
-      if (std::fabs(matrix_[i][j] - other.matrix_[i][j]) > 1e-7) {
+      if (std::fabs(matrix_[Index(i, j)] - other.matrix_[Index(i, j)]) >
+          1e-7) {
         return false;
       }
     }
@@ -43,9 +59,10 @@ void S21Matrix::SumMatrix(const S21Matrix& other) {
     throw std::invalid_argument(
         "Matrices have different dimensions for SumMatrix.");
   }
+  Touch();
   for (int i = 0; i < rows_; ++i) {
     for (int j = 0; j < cols_; ++j) {
-      matrix_[i][j] += other.matrix_[i][j];
+      matrix_[Index(i, j)] += other.matrix_[Index(i, j)];
     }
   }
 }
@@ -66,9 +83,10 @@ void S21Matrix::SubMatrix(const S21Matrix& other) {
     throw std::invalid_argument(
         "Matrices have different dimensions for SubMatrix.");
   }
+  Touch();
   for (int i = 0; i < rows_; ++i) {
     for (int j = 0; j < cols_; ++j) {
-      matrix_[i][j] -= other.matrix_[i][j];
+      matrix_[Index(i, j)] -= other.matrix_[Index(i, j)];
     }
   }
 }
@@ -81,9 +99,10 @@ void S21Matrix::SubMatrix(const S21Matrix& other) {
  * @param num The number to multiply the elements of the matrix by.
  */
 void S21Matrix::MulNumber(const double num) {
+  Touch();
   for (int i = 0; i < rows_; ++i) {
     for (int j = 0; j < cols_; ++j) {
-      matrix_[i][j] *= num;
+      matrix_[Index(i, j)] *= num;
     }
   }
 }
@@ -96,6 +115,13 @@ void S21Matrix::MulNumber(const double num) {
  * result in the current matrix. If the dimensions differ, it throws an
  * exception.
  *
+ * A product of up to kWorkspaceElements elements (8 MiB) is written into a
+ * per-thread workspace whose storage is then exchanged with this matrix, so
+ * repeated products of the same shape (as in a loop of operator*=) reuse the
+ * previous buffer instead of allocating. Larger products are allocated and
+ * moved in, and a buffer above that size is never kept, so each thread
+ * retains at most 8 MiB; ReleaseWorkspace() frees it.
+ *
  * @param other The matrix to multiply the current matrix by.
  * @exception std::invalid_argument Thrown if the matrices have different
  * dimensions.
@@ -105,15 +131,194 @@ void S21Matrix::MulMatrix(const S21Matrix& other) {
     throw std::invalid_argument(
         "Matrix dimensions are not suitable for multiplication.");
   }
-  S21Matrix result(rows_, other.cols_);
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < other.cols_; ++j) {
-      for (int k = 0; k < cols_; ++k) {
-        result.matrix_[i][j] += matrix_[i][k] * other.matrix_[k][j];
+  if (static_cast<std::size_t>(rows_) * other.cols_ > kWorkspaceElements) {
+    S21Matrix result(rows_, other.cols_);
+    MultiplyInto(*this, other, result);
+    result.copy_on_write_ = copy_on_write_;
+    *this = std::move(result);
+    return;
+  }
+  S21Matrix& result = Workspace(rows_, other.cols_);
+  MultiplyInto(*this, other, result);
+  result.copy_on_write_ = copy_on_write_;
+  std::swap(*this, result);
+  // A buffer this matrix shared copy-on-write cannot be reused, and the
+  // former buffer of a large left operand is not kept.
+  if (result.shared_count_ || result.Size() > kWorkspaceElements) {
+    result = S21Matrix(1, 1);
+  }
+}
+
+namespace {
+/**
+ * @brief Computes rows [lo, hi) of C = alpha * op(A) * op(B) + beta * C.
+ *
+ * A is stored with row stride lda, B with row stride ldb and C with row
+ * stride ldc; ta and tb select op(X) = X^T. C has n columns and k is the
+ * inner dimension. With op(B) = B each row of C is built from axpy updates over
+ * contiguous rows of B; with op(B) = B^T each element is a dot product of a
+ * row of op(A) and a contiguous row of B. beta == 0 overwrites C, ignoring
+ * its previous contents.
+ */
+void GemmRows(int lo, int hi, int n, int k, double alpha, const double* a,
+              int lda, bool ta, const double* b, int ldb, bool tb,
+              double beta, double* c, int ldc) {
+  for (int i = lo; i < hi; ++i) {
+    double* c_row = c + static_cast<size_t>(i) * ldc;
+    if (beta == 0.0) {
+      std::fill(c_row, c_row + n, 0.0);
+    } else if (beta != 1.0) {
+      for (int j = 0; j < n; ++j) c_row[j] *= beta;
+    }
+    if (alpha == 0.0) continue;
+    if (!tb) {
+      for (int p = 0; p < k; ++p) {
+        double a_ip = ta ? a[static_cast<size_t>(p) * lda + i]
+                         : a[static_cast<size_t>(i) * lda + p];
+        s21_internal::AxpyKernel(alpha * a_ip,
+                                 b + static_cast<size_t>(p) * ldb, c_row, n);
+      }
+    } else {
+      for (int j = 0; j < n; ++j) {
+        const double* b_row = b + static_cast<size_t>(j) * ldb;
+        double dot = 0.0;
+        if (ta) {
+          for (int p = 0; p < k; ++p) {
+            dot += a[static_cast<size_t>(p) * lda + i] * b_row[p];
+          }
+        } else {
+          dot = s21_internal::DotKernel(a + static_cast<size_t>(i) * lda,
+                                        b_row, k);
+        }
+        c_row[j] += alpha * dot;
       }
     }
   }
-  *this = std::move(result);
+}
+}  // namespace
+
+/**
+ * @brief C = alpha * op(A) * op(B) + beta * C on row-major arrays with
+ * arbitrary row strides; C is m x n.
+ *
+ * Large products go to the system BLAS when that backend is selected;
+ * otherwise the rows of C are split across threads.
+ */
+void s21_internal::GemmStrided(bool ta, bool tb, int m, int n, int k,
+                               double alpha, const double* a, int lda,
+                               const double* b, int ldb, double beta,
+                               double* c, int ldc) {
+  if (s21_internal::SystemGemm(ta, tb, m, n, k, alpha, a, lda, b, ldb, beta,
+                               c, ldc)) {
+    return;
+  }
+  s21_internal::ParallelFor(0, m, GemmMinRows(n, k), [&](int lo, int hi) {
+    GemmRows(lo, hi, n, k, alpha, a, lda, ta, b, ldb, tb, beta, c, ldc);
+  });
+}
+
+/**
+ * @brief Writes the product lhs * rhs into an already allocated matrix.
+ *
+ * The destination must have the shape of the product and must not alias
+ * either operand. The loops run in i-k-j order so the innermost loop streams
+ * over contiguous rows of rhs and out. Large products split the rows of out
+ * across threads. No memory is allocated. Large products go to the system
+ * BLAS when that backend is selected.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @param out The destination, overwritten with the product.
+ */
+void S21Matrix::MultiplyInto(const S21Matrix& lhs, const S21Matrix& rhs,
+                             S21Matrix& out) {
+  out.Touch();
+  s21_internal::GemmStrided(false, false, lhs.rows_, rhs.cols_, lhs.cols_, 1.0,
+                            lhs.matrix_, lhs.cols_, rhs.matrix_, rhs.cols_,
+                            0.0, out.matrix_, out.cols_);
+}
+
+namespace {
+// Scratch matrix of the calling thread, see S21Matrix::Workspace.
+thread_local S21Matrix workspace(1, 1);
+}  // namespace
+
+/**
+ * @brief Returns this thread's scratch matrix, reshaped to rows x cols.
+ *
+ * The buffer is reallocated only when the shape changes. Its contents are
+ * unspecified. Callers use it only for shapes of up to kWorkspaceElements
+ * elements, so a thread never retains more than that.
+ */
+S21Matrix& S21Matrix::Workspace(int rows, int cols) {
+  if (workspace.rows_ != rows || workspace.cols_ != cols) {
+    workspace = S21Matrix(rows, cols);
+  }
+  return workspace;
+}
+
+/**
+ * @brief Frees the calling thread's scratch buffer.
+ *
+ * MulMatrix and Gemm with an aliased accumulator keep one buffer of up to
+ * 8 MiB per thread that has called them, to avoid allocating on repeated
+ * products of the same shape. Call this on a thread that will not multiply
+ * again (or before a long idle period) to return that memory; the next
+ * product simply allocates again.
+ */
+void S21Matrix::ReleaseWorkspace() { workspace = S21Matrix(1, 1); }
+
+/**
+ * @brief General matrix multiply-accumulate,
+ * C = alpha * op(A) * op(B) + beta * C, with op(X) = X or X^T.
+ *
+ * The result is accumulated directly into C in one pass: there is no
+ * temporary for the product, no separate scaling pass and no allocation.
+ * With beta == 0 the previous contents of C are ignored (NaN or infinity in
+ * C does not propagate), as in BLAS. Large products split the rows of C
+ * across threads, or go to cblas_dgemm under the system backend. If C is
+ * the same object as A or B, the product is first formed in the per-thread
+ * workspace (or, above 8 MiB, in a temporary; see MulMatrix).
+ *
+ * @param alpha Scale of the product.
+ * @param a The left operand A.
+ * @param b The right operand B.
+ * @param beta Scale of the previous contents of C.
+ * @param c The accumulator C; must have the shape of op(A) * op(B).
+ * @param trans_a Whether to use A^T instead of A.
+ * @param trans_b Whether to use B^T instead of B.
+ * @exception std::invalid_argument Thrown if the inner dimensions of op(A)
+ * and op(B) differ or C does not have the shape of the product.
+ */
+void S21Matrix::Gemm(double alpha, const S21Matrix& a, const S21Matrix& b,
+                     double beta, S21Matrix& c, S21Transpose trans_a,
+                     S21Transpose trans_b) {
+  bool ta = trans_a == S21Transpose::kTranspose;
+  bool tb = trans_b == S21Transpose::kTranspose;
+  int m = ta ? a.cols_ : a.rows_;
+  int k = ta ? a.rows_ : a.cols_;
+  int n = tb ? b.rows_ : b.cols_;
+  if ((tb ? b.cols_ : b.rows_) != k || c.rows_ != m || c.cols_ != n) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for Gemm.");
+  }
+  if (&c == &a || &c == &b) {
+    bool large = static_cast<std::size_t>(m) * n > kWorkspaceElements;
+    S21Matrix owned = large ? S21Matrix(m, n) : S21Matrix(1, 1);
+    S21Matrix& product = large ? owned : Workspace(m, n);
+    Gemm(alpha, a, b, 0.0, product, trans_a, trans_b);
+    c.Touch();
+    double* out = c.matrix_;
+    const double* in = product.matrix_;
+    for (size_t p = 0; p < c.Size(); ++p) {
+      out[p] = (beta == 0.0 ? 0.0 : beta * out[p]) + in[p];
+    }
+    return;
+  }
+
+  c.Touch();
+  s21_internal::GemmStrided(ta, tb, m, n, k, alpha, a.matrix_, a.cols_,
+                            b.matrix_, b.cols_, beta, c.matrix_, c.cols_);
 }
 
 namespace {
@@ -150,17 +355,16 @@ S21Matrix GetMinor(const S21Matrix& m, int skip_row, int skip_col) {
  * @brief Calculates the transpose of a matrix.
  *
  * The transpose of a matrix is a matrix with the elements of the rows of the
- * original matrix as the columns of the new matrix.
+ * original matrix as the columns of the new matrix. The copy runs in 32 x 32
+ * tiles, so both the reads and the writes stay within a few cache lines.
  *
  * @return The transpose of the matrix.
  */
 S21Matrix S21Matrix::Transpose() const {
   S21Matrix result(cols_, rows_);
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      result(j, i) = matrix_[i][j];
-    }
-  }
+  // A^T read through the column-major view of this buffer.
+  s21_internal::StridedCopy(cols_, rows_, {matrix_, 1, cols_}, result.matrix_,
+                            rows_, 1);
   return result;
 }
 
@@ -174,8 +378,12 @@ S21Matrix S21Matrix::Transpose() const {
  *  det(A) = a11 * [a22*a33 - a23*a32] - a12 * [a21*a33 - a23*a31] +
  *  a13 * [a21*a32 - a22*a31]
  *
- * This function calculates the determinant of the matrix using the recursive
- * formula above.
+ * Matrices up to 4x4 use closed-form, allocation-free expansions (for 3x3
+ * exactly the formula above). Larger matrices use the LU factorization,
+ * det(A) = sign(P) * u11 * ... * unn, which is O(n^3) and is cached until
+ * the matrix is modified. When S21ResultCache is enabled and no current
+ * factorization is cached, the result is also shared with other matrices
+ * of the same contents.
  *
  * @exception std::invalid_argument Thrown if the matrix is not square.
  * @return The determinant of the matrix.
@@ -185,21 +393,28 @@ double S21Matrix::Determinant() const {
     throw std::invalid_argument(
         "Determinant can only be calculated for a square matrix.");
   }
+  if (rows_ <= 4) return s21_internal::SmallDeterminant(matrix_, rows_);
+  if (auto lu = CurrentFactorization()) return lu->determinant;
+  s21_internal::CacheLookup cache(s21_internal::CachedOperation::kDeterminant,
+                                  *this);
+  double det;
+  if (cache.Find(&det)) return det;
+  det = Factorize()->determinant;
+  cache.Store(det);
+  return det;
+}
 
-  double result = 0.0;
-
-  if (rows_ == 1) return matrix_[0][0];
-  if (rows_ == 2)
-    return matrix_[0][0] * matrix_[1][1] - matrix_[0][1] * matrix_[1][0];
-
-  for (int i = 0; i < cols_; ++i) {
-    S21Matrix minor = GetMinor(*this, 0, i);
-    double minor_det = minor.Determinant();
-    double sign = (i % 2 == 0) ? 1.0 : -1.0;
-    result += sign * matrix_[0][i] * minor_det;
-  }
-
-  return result;
+/**
+ * @brief The determinant of a square matrix without consulting or filling
+ * S21ResultCache.
+ *
+ * Used for the minors of singular matrices in CalcComplements(): each minor
+ * is a distinct temporary, so hashing it and storing its determinant only
+ * evicts useful entries.
+ */
+double S21Matrix::UncachedDeterminant() const {
+  if (rows_ <= 4) return s21_internal::SmallDeterminant(matrix_, rows_);
+  return Factorize()->determinant;
 }
 
 /**
@@ -210,6 +425,13 @@ double S21Matrix::Determinant() const {
  * element is the determinant of the minor of that element, multiplied by -1 to
  * the power of the sum of the row and column indices of the element.
  *
+ * Matrices up to 4x4 use closed-form expressions without temporaries. For
+ * larger non-singular matrices the complements are obtained from the cached
+ * LU factorization as det(A) * (A^-1)^T instead of n^2 minors. Results for
+ * larger matrices are memoized by S21ResultCache when it is enabled, unless
+ * a current factorization is already cached; the inverse used on the way
+ * and the minors of singular matrices are neither looked up nor stored.
+ *
  * @return The matrix of algebraic complements.
  * @exception std::invalid_argument Thrown if the matrix is not square.
  */
@@ -220,19 +442,43 @@ S21Matrix S21Matrix::CalcComplements() const {
   }
   S21Matrix result(rows_, cols_);
 
-  if (rows_ == 1) {
-    result(0, 0) = 1;
+  if (rows_ <= 4) {
+    double adjugate[16];
+    s21_internal::SmallAdjugate(matrix_, rows_, adjugate);
+    for (int i = 0; i < rows_; ++i) {
+      for (int j = 0; j < cols_; ++j) {
+        result.matrix_[Index(i, j)] = adjugate[Index(j, i)];
+      }
+    }
+    return result;
+  }
+
+  std::shared_ptr<const LuFactorization> lu = CurrentFactorization();
+  s21_internal::CacheLookup cache(s21_internal::CachedOperation::kComplements,
+                                  *this, !lu);
+  if (cache.Find(&result)) return result;
+  if (!lu) lu = Factorize();
+  if (!lu->singular) {
+    S21Matrix inverse = InverseFromLu(*lu);
+    for (int i = 0; i < rows_; ++i) {
+      for (int j = 0; j < cols_; ++j) {
+        result.matrix_[Index(i, j)] =
+            lu->determinant * inverse.matrix_[Index(j, i)];
+      }
+    }
+    cache.Store(result);
     return result;
   }
 
   for (int i = 0; i < rows_; ++i) {
     for (int j = 0; j < cols_; ++j) {
       S21Matrix minor = GetMinor(*this, i, j);
-      double minor_det = minor.Determinant();
+      double minor_det = minor.UncachedDeterminant();
       double sign = ((i + j) % 2 == 0) ? 1.0 : -1.0;
       result(i, j) = sign * minor_det;
     }
   }
+  cache.Store(result);
   return result;
 }
 
@@ -242,24 +488,139 @@ S21Matrix S21Matrix::CalcComplements() const {
  * The inverse matrix is the matrix that, when multiplied by the original
  * matrix, results in the identity matrix. The inverse matrix is calculated
  * using the formula A^-1 = 1/|A| \* adj(A), where adj(A) is the adjugate of A,
- * and |A| is the determinant of A.
+ * and |A| is the determinant of A, evaluated in closed form for matrices up
+ * to 4x4. Larger matrices are inverted by solving A * X = I with the cached
+ * LU factorization instead, or by LAPACK dgetri from the same factors under
+ * the system backend. When S21ResultCache is enabled, inverses of larger
+ * matrices without a current cached factorization are looked up by content
+ * before anything is computed.
+ *
+ * Singularity is decided by the same rule for every order: partial-pivoting
+ * elimination meets a pivot not larger than n * DBL_EPSILON times the
+ * largest element of its original row. The rule is invariant under scaling,
+ * so 0.01 * I is invertible at any size.
  *
  * @return The inverse matrix.
- * @exception std::invalid_argument Thrown if the matrix is singular (i.e. its
- * determinant is zero).
+ * @exception std::invalid_argument Thrown if the matrix is singular by the
+ * rule above.
  */
 S21Matrix S21Matrix::InverseMatrix() const {
+  if (rows_ > 4 && rows_ == cols_) {
+    std::shared_ptr<const LuFactorization> lu = CurrentFactorization();
+    s21_internal::CacheLookup cache(s21_internal::CachedOperation::kInverse,
+                                    *this, !lu);
+    S21Matrix cached;
+    if (cache.Find(&cached)) return cached;
+    if (!lu) lu = Factorize();
+    S21Matrix result = InverseFromLu(*lu);
+    cache.Store(result);
+    return result;
+  }
+
   double det = Determinant();
-  if (std::fabs(det) < 1e-7) {
+  if (s21_internal::SmallIsSingular(matrix_, rows_)) {
+    throw std::invalid_argument(
+        "Matrix is singular (determinant is zero), cannot find inverse.");
+  }
+
+  S21Matrix result(rows_, cols_);
+  s21_internal::SmallAdjugate(matrix_, rows_, result.matrix_);
+  double inverse_det = 1.0 / det;
+  for (size_t i = 0; i < Size(); ++i) result.matrix_[i] *= inverse_det;
+  return result;
+}
+
+/**
+ * @brief The inverse from an LU factorization of the matrix, with LAPACK
+ * dgetri under the system backend or column by column otherwise.
+ *
+ * @exception std::invalid_argument Thrown if the factorization is singular.
+ */
+S21Matrix S21Matrix::InverseFromLu(const LuFactorization& lu) const {
+  if (lu.singular) {
     throw std::invalid_argument(
         "Matrix is singular (determinant is zero), cannot find inverse.");
   }
+  S21Matrix result(rows_, cols_);
+  if (s21_internal::SystemInverse(lu.lu.data(), lu.permutation.data(), rows_,
+                                  result.matrix_)) {
+    return result;
+  }
+  std::vector<double> unit(rows_, 0.0);
+  std::vector<double> column(rows_);
+  for (int j = 0; j < cols_; ++j) {
+    unit[j] = 1.0;
+    lu.Solve(unit.data(), column.data());
+    unit[j] = 0.0;
+    for (int i = 0; i < rows_; ++i) {
+      result.matrix_[Index(i, j)] = column[i];
+    }
+  }
+  return result;
+}
 
-  S21Matrix complements = CalcComplements();
+// --- Matrix-vector products ---
 
-  S21Matrix adjugate = complements.Transpose();
+namespace {
+// Matrices with fewer elements than this are multiplied on one thread.
+constexpr int kGemvParallelElements = 1 << 16;
+}  // namespace
 
-  adjugate.MulNumber(1.0 / det);
+/**
+ * @brief Multiplies the matrix by a column vector (GEMV, y = A * x).
+ *
+ * Each output element is a dot product of one contiguous matrix row with the
+ * vector. Rows are distributed across threads for large matrices; every
+ * thread writes a disjoint slice of the result.
+ *
+ * @param vec The vector to multiply by; its size must equal the number of
+ * columns.
+ * @return The product vector with one element per matrix row.
+ * @exception std::invalid_argument Thrown if the sizes do not match.
+ */
+S21Vector S21Matrix::MulVector(const S21Vector& vec) const {
+  if (cols_ != vec.get_size()) {
+    throw std::invalid_argument(
+        "Matrix and vector dimensions are not suitable for multiplication.");
+  }
+  S21Vector result(rows_);
+  double* y = result.data();
+  const double* x = vec.data();
+  int min_rows = std::max(1, kGemvParallelElements / cols_);
+  s21_internal::ParallelFor(0, rows_, min_rows, [&](int lo, int hi) {
+    for (int i = lo; i < hi; ++i) {
+      y[i] = s21_internal::DotKernel(matrix_ + Index(i, 0), x, cols_);
+    }
+  });
+  return result;
+}
 
-  return adjugate;
+/**
+ * @brief Multiplies the transposed matrix by a column vector (y = A^T * x).
+ *
+ * The transpose is never formed: the result is accumulated as a sum of
+ * contiguous rows scaled by the vector elements. For large matrices each
+ * thread owns a slice of the output columns and walks all rows, so no
+ * reduction between threads is needed.
+ *
+ * @param vec The vector to multiply by; its size must equal the number of
+ * rows.
+ * @return The product vector with one element per matrix column.
+ * @exception std::invalid_argument Thrown if the sizes do not match.
+ */
+S21Vector S21Matrix::MulTransposedVector(const S21Vector& vec) const {
+  if (rows_ != vec.get_size()) {
+    throw std::invalid_argument(
+        "Matrix and vector dimensions are not suitable for multiplication.");
+  }
+  S21Vector result(cols_);
+  double* y = result.data();
+  const double* x = vec.data();
+  int min_cols = std::max(1, kGemvParallelElements / rows_);
+  s21_internal::ParallelFor(0, cols_, min_cols, [&](int lo, int hi) {
+    for (int i = 0; i < rows_; ++i) {
+      s21_internal::AxpyKernel(x[i], matrix_ + Index(i, lo), y + lo, hi - lo);
+    }
+  });
+  return result;
 }
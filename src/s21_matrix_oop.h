@@ -1,16 +1,118 @@
 #ifndef S21_MATRIX_OOP_H
 #define S21_MATRIX_OOP_H
 
+#include <atomic>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <stdexcept>
 #include <utility>
 
+#include "s21_async.h"
+#include "s21_bigint.h"
+#include "s21_parallel.h"
+#include "s21_vector.h"
+
+// --- Element access policies for S21Matrix::At ---
+
+/**
+ * @brief Bounds-checked access: throws std::out_of_range, like operator().
+ */
+struct S21CheckedAccess {
+  static void Check(int row, int col, int rows, int cols) {
+    if (row >= rows || col >= cols || row < 0 || col < 0) {
+      throw std::out_of_range("Index out of range.");
+    }
+  }
+};
+
+/**
+ * @brief Unchecked access for hot loops whose indices are known to be valid.
+ */
+struct S21UncheckedAccess {
+  static void Check(int, int, int, int) noexcept {}
+};
+
+/**
+ * @brief Selects whether S21Matrix::Gemm uses an operand as stored or
+ * transposed.
+ */
+enum class S21Transpose { kNone, kTranspose };
+
+/**
+ * @brief Outcome of a mixed-precision solve.
+ *
+ * iterations is the number of refinement steps (the largest over all
+ * right-hand sides); backward_error is the normwise backward error
+ * ||b - A x|| / (||A|| ||x|| + ||b||) of the returned solution (the largest
+ * over all right-hand sides); used_fallback is true if refinement did not
+ * converge and the system was solved again in double precision.
+ */
+struct S21RefinementReport {
+  int iterations = 0;
+  double backward_error = 0.0;
+  bool used_fallback = false;
+};
+
+class S21Permutation;
+
 class S21Matrix {
  private:
+  struct LuFactorization;
+
+  // Matrices with at most this many elements keep them in inline_ and never
+  // touch the heap; matrix_ then points into the object itself.
+  static constexpr std::size_t kInlineCapacity = 16;
+  // Elementwise operations hand at least this many elements to a thread.
+  static constexpr int kElementwiseParallel = 1 << 16;
+  // Reductions sum fixed blocks of this many elements, then combine the
+  // block results pairwise.
+  static constexpr std::size_t kReduceBlock = 1 << 12;
+  static constexpr int kReduceParallelBlocks =
+      kElementwiseParallel / static_cast<int>(kReduceBlock);
+
   int rows_, cols_;
-  double** matrix_;
+  double* matrix_;
+  double inline_[kInlineCapacity];
+  // Reference count of a heap buffer shared by copy-on-write copies; null
+  // while the buffer is owned exclusively.
+  mutable std::atomic<long>* shared_count_;
+  bool copy_on_write_;
+  std::uint64_t version_;
+  mutable std::mutex cache_mutex_;
+  mutable std::shared_ptr<const LuFactorization> lu_cache_;
+
   void AllocateMatrix();
+  void ReleaseMatrix() noexcept;
+  void StealMatrix(S21Matrix& other) noexcept;
+  bool IsInline() const { return matrix_ == inline_; }
+  void Detach();
+  void Touch() {
+    ++version_;
+    if (shared_count_) Detach();
+  }
+  std::shared_ptr<const LuFactorization> Factorize() const;
+  std::shared_ptr<const LuFactorization> CurrentFactorization() const;
+  S21Matrix InverseFromLu(const LuFactorization& lu) const;
+  double UncachedDeterminant() const;
+  std::size_t Index(int row, int col) const {
+    return static_cast<std::size_t>(row) * cols_ + col;
+  }
+  std::size_t Size() const { return static_cast<std::size_t>(rows_) * cols_; }
+  template <typename Fn>
+  void ForEachRange(bool parallel, Fn&& fn) const;
+  static void MultiplyInto(const S21Matrix& lhs, const S21Matrix& rhs,
+                           S21Matrix& out);
+  static S21Matrix& Workspace(int rows, int cols);
+  static S21Matrix InverseTiled(const S21Matrix& m,
+                                const S21AsyncOptions& options,
+                                double* determinant);
 
  public:
   // -- Constructors, destructor --
@@ -25,16 +127,42 @@ class S21Matrix {
 
   int get_rows() const;
   int get_cols() const;
+  std::uint64_t get_version() const;
+  bool get_copy_on_write() const;
 
   // --- Setters ---
   void set_rows(int new_rows);
   void set_cols(int new_cols);
+  void set_copy_on_write(bool enabled);
 
   // --- Accessors, mutatators ---
 
   double& operator()(int row, int col);
   const double& operator()(int row, int col) const;
 
+  template <typename AccessPolicy = S21CheckedAccess>
+  double& At(int row, int col);
+  template <typename AccessPolicy = S21CheckedAccess>
+  const double& At(int row, int col) const;
+
+  // --- Raw storage, iterators ---
+
+  using iterator = double*;
+  using const_iterator = const double*;
+
+  double* data();
+  const double* data() const;
+  int stride() const;
+  std::span<double> row(int row);
+  std::span<const double> row(int row) const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
   // --- Assignment operators ---
 
   S21Matrix& operator=(const S21Matrix& other);
@@ -46,6 +174,7 @@ class S21Matrix {
   S21Matrix operator-(const S21Matrix& other) const;
   S21Matrix operator*(const S21Matrix& other) const;
   S21Matrix operator*(const double num) const;
+  S21Vector operator*(const S21Vector& vec) const;
   bool operator==(const S21Matrix& other) const;
 
   S21Matrix& operator+=(const S21Matrix& other);
@@ -60,14 +189,218 @@ class S21Matrix {
   void SubMatrix(const S21Matrix& other);
   void MulNumber(const double num);
   void MulMatrix(const S21Matrix& other);
+  static void Gemm(double alpha, const S21Matrix& a, const S21Matrix& b,
+                   double beta, S21Matrix& c,
+                   S21Transpose trans_a = S21Transpose::kNone,
+                   S21Transpose trans_b = S21Transpose::kNone);
+  static void ReleaseWorkspace();
   S21Matrix Transpose() const;
+  void PermuteRows(const S21Permutation& order);
+  void PermuteCols(const S21Permutation& order);
   S21Matrix CalcComplements() const;
   double Determinant() const;
+  S21BigInt DeterminantExact() const;
+  int Rank() const;
   S21Matrix InverseMatrix() const;
+  S21Matrix Solve(const S21Matrix& rhs) const;
+  S21Vector Solve(const S21Vector& rhs) const;
+  S21Matrix SolveMixed(const S21Matrix& rhs,
+                       S21RefinementReport* report = nullptr) const;
+  S21Vector SolveMixed(const S21Vector& rhs,
+                       S21RefinementReport* report = nullptr) const;
+  S21Matrix InverseMatrixMixed(S21RefinementReport* report = nullptr) const;
+  S21Matrix Pow(int power) const;
+  S21Matrix PowSymmetric(int power) const;
+  S21Vector MulVector(const S21Vector& vec) const;
+  S21Vector MulTransposedVector(const S21Vector& vec) const;
+
+  // --- Elementwise operations, reductions ---
+
+  template <typename Fn>
+  S21Matrix Map(Fn fn, bool parallel = true) const;
+  template <typename Fn>
+  S21Matrix ZipMap(const S21Matrix& other, Fn fn, bool parallel = true) const;
+  template <typename Fn>
+  void Apply(Fn fn, bool parallel = true);
+  template <typename T, typename Combine, typename Transform = std::identity>
+  T Reduce(T init, Combine combine, Transform transform = {},
+           bool parallel = true) const;
+
+  double Sum() const;
+  double Trace() const;
+  double Min() const;
+  double Max() const;
+  double Norm1() const;
+  double NormInf() const;
+  double NormFrobenius() const;
+  double NormMax() const;
+  void HadamardMul(const S21Matrix& other);
+  void HadamardDiv(const S21Matrix& other);
+  void Clamp(double lo, double hi);
+
+  // --- Asynchronous methods ---
+
+  std::future<S21Matrix> MulMatrixAsync(const S21Matrix& other,
+                                        S21AsyncOptions options = {}) const;
+  std::future<S21Matrix> InverseMatrixAsync(
+      S21AsyncOptions options = {}) const;
+  std::future<S21Matrix> CalcComplementsAsync(
+      S21AsyncOptions options = {}) const;
 
   // --- Other methods ---
 
   void printMatrix() const;
 };
 
+/**
+ * @brief Element access with a bounds-checking policy chosen at compile time.
+ *
+ * At<S21CheckedAccess> behaves like operator(). At<S21UncheckedAccess>
+ * only drops the bounds check: like every non-const access path it still
+ * calls Touch(), which bumps the version and may detach a shared
+ * copy-on-write buffer, so it is not a bare load. Tight write loops should
+ * take data() once and index it; read-only loops should use the const
+ * overload.
+ *
+ * @tparam AccessPolicy S21CheckedAccess (default) or S21UncheckedAccess.
+ * @param row The row index of the element.
+ * @param col The column index of the element.
+ * @return A reference to the element.
+ */
+template <typename AccessPolicy>
+double& S21Matrix::At(int row, int col) {
+  AccessPolicy::Check(row, col, rows_, cols_);
+  Touch();
+  return matrix_[Index(row, col)];
+}
+
+/**
+ * @brief Read-only element access with a compile-time bounds policy.
+ *
+ * Leaves the version alone; with S21UncheckedAccess it is a single load
+ * that the compiler can vectorize in tight loops.
+ *
+ * @tparam AccessPolicy S21CheckedAccess (default) or S21UncheckedAccess.
+ * @param row The row index of the element.
+ * @param col The column index of the element.
+ * @return A constant reference to the element.
+ */
+template <typename AccessPolicy>
+const double& S21Matrix::At(int row, int col) const {
+  AccessPolicy::Check(row, col, rows_, cols_);
+  return matrix_[Index(row, col)];
+}
+
+/**
+ * @brief Runs fn(first, last) over consecutive ranges of whole rows of the
+ * flat element storage, on several threads if parallel is set and the matrix
+ * is large enough. The first exception thrown by fn is rethrown.
+ */
+template <typename Fn>
+void S21Matrix::ForEachRange(bool parallel, Fn&& fn) const {
+  int min_rows = parallel ? std::max(1, kElementwiseParallel / cols_) : rows_;
+  s21_internal::ParallelForRethrow(0, rows_, min_rows, [&](int lo, int hi) {
+    fn(Index(lo, 0), Index(hi, 0));
+  });
+}
+
+/**
+ * @brief Applies fn to every element and returns the results.
+ *
+ * With parallel set, large matrices are split into row ranges that are
+ * processed on several threads, so fn may be called concurrently and must
+ * not depend on the order of the calls.
+ *
+ * @param fn Callable invoked as fn(double) -> double.
+ * @param parallel Whether large matrices may be processed on several threads.
+ * @return The matrix of fn(a(i, j)).
+ */
+template <typename Fn>
+S21Matrix S21Matrix::Map(Fn fn, bool parallel) const {
+  S21Matrix result(rows_, cols_);
+  double* out = result.matrix_;
+  const double* in = matrix_;
+  ForEachRange(parallel, [&](std::size_t first, std::size_t last) {
+    for (std::size_t k = first; k < last; ++k) out[k] = fn(in[k]);
+  });
+  return result;
+}
+
+/**
+ * @brief Applies fn to every pair of corresponding elements of this matrix
+ * and other and returns the results.
+ *
+ * @param other A matrix of the same dimensions.
+ * @param fn Callable invoked as fn(double, double) -> double.
+ * @param parallel Whether large matrices may be processed on several threads.
+ * @return The matrix of fn(a(i, j), other(i, j)).
+ * @exception std::invalid_argument Thrown if the dimensions differ.
+ */
+template <typename Fn>
+S21Matrix S21Matrix::ZipMap(const S21Matrix& other, Fn fn,
+                            bool parallel) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    throw std::invalid_argument(
+        "Matrices have different dimensions for ZipMap.");
+  }
+  S21Matrix result(rows_, cols_);
+  double* out = result.matrix_;
+  const double* lhs = matrix_;
+  const double* rhs = other.matrix_;
+  ForEachRange(parallel, [&](std::size_t first, std::size_t last) {
+    for (std::size_t k = first; k < last; ++k) out[k] = fn(lhs[k], rhs[k]);
+  });
+  return result;
+}
+
+/**
+ * @brief Replaces every element a(i, j) with fn(a(i, j)).
+ *
+ * @param fn Callable invoked as fn(double) -> double.
+ * @param parallel Whether large matrices may be processed on several threads.
+ */
+template <typename Fn>
+void S21Matrix::Apply(Fn fn, bool parallel) {
+  Touch();
+  double* data = matrix_;
+  ForEachRange(parallel, [&](std::size_t first, std::size_t last) {
+    for (std::size_t k = first; k < last; ++k) data[k] = fn(data[k]);
+  });
+}
+
+/**
+ * @brief Folds transform(a(i, j)) over all elements with combine.
+ *
+ * The elements are taken in row-major order in fixed blocks of kReduceBlock;
+ * each block is folded left to right and the block results are combined
+ * pairwise. The grouping depends only on the matrix size, so floating-point
+ * results are reproducible for any number of threads, and sums accumulate
+ * O(log n) rather than O(n) rounding error. combine must be associative.
+ *
+ * @tparam T The result type; must be default-constructible.
+ * @param init Value combined with the result of all elements, as the left
+ * operand.
+ * @param combine Callable invoked as combine(T, T) -> T.
+ * @param transform Callable invoked as transform(double) -> T; identity by
+ * default.
+ * @param parallel Whether large matrices may be processed on several threads.
+ * @return combine(init, fold of all transformed elements).
+ */
+template <typename T, typename Combine, typename Transform>
+T S21Matrix::Reduce(T init, Combine combine, Transform transform,
+                    bool parallel) const {
+  const double* in = matrix_;
+  T total = s21_internal::BlockedReduce<T>(
+      Size(), kReduceBlock, parallel ? kReduceParallelBlocks : 0,
+      [&](std::size_t first, std::size_t last) {
+        T value = transform(in[first]);
+        for (std::size_t k = first + 1; k < last; ++k) {
+          value = combine(std::move(value), transform(in[k]));
+        }
+        return value;
+      },
+      combine);
+  return combine(std::move(init), std::move(total));
+}
+
 #endif  // S21_MATRIX_OOP_H
\ No newline at end of file
@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <vector>
+
+#include "s21_executor.h"
+#include "s21_layout.h"
+#include "s21_matrix_lu.h"
+
+namespace {
+// Rows (or columns) processed between two cancellation checks.
+constexpr int kTileSize = 32;
+
+/**
+ * @brief Tile boundary: throws if cancellation was requested, otherwise
+ * reports the completed fraction.
+ */
+void Checkpoint(const S21AsyncOptions& options, double fraction) {
+  if (options.stop_token.stop_requested()) {
+    throw S21OperationCancelled();
+  }
+  if (options.progress) options.progress(fraction);
+}
+}  // namespace
+
+/**
+ * @brief Multiplies the matrix by another matrix on the shared executor.
+ *
+ * Both operands are copied when the call is made, so the caller may modify
+ * or destroy them immediately. The product is computed in tiles of rows,
+ * each one a GemmStrided call (threaded, or the system BLAS under that
+ * backend), as MulMatrix does for the whole product; cancellation is checked
+ * and progress reported between tiles.
+ *
+ * @param other The right operand.
+ * @param options Stop token and progress callback.
+ * @return A future holding the product, or S21OperationCancelled.
+ * @exception std::invalid_argument Thrown immediately if the matrix
+ * dimensions are not suitable for multiplication.
+ */
+std::future<S21Matrix> S21Matrix::MulMatrixAsync(
+    const S21Matrix& other, S21AsyncOptions options) const {
+  if (cols_ != other.rows_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  return S21Executor::Instance().Submit(
+      [lhs = *this, rhs = other, options = std::move(options)]() {
+        S21Matrix result(lhs.rows_, rhs.cols_);
+        for (int lo = 0; lo < lhs.rows_; lo += kTileSize) {
+          Checkpoint(options, static_cast<double>(lo) / lhs.rows_);
+          int rows = std::min(kTileSize, lhs.rows_ - lo);
+          s21_internal::GemmStrided(
+              false, false, rows, rhs.cols_, lhs.cols_, 1.0,
+              lhs.matrix_ + lhs.Index(lo, 0), lhs.cols_, rhs.matrix_,
+              rhs.cols_, 0.0, result.matrix_ + result.Index(lo, 0),
+              result.cols_);
+        }
+        if (options.progress) options.progress(1.0);
+        return result;
+      });
+}
+
+/**
+ * @brief Calculates the inverse matrix on the shared executor.
+ *
+ * The matrix is copied when the call is made. Cancellation is checked during
+ * the LU factorization and between tiles of solved columns.
+ *
+ * @param options Stop token and progress callback.
+ * @return A future holding the inverse, std::invalid_argument for a singular
+ * matrix, or S21OperationCancelled.
+ * @exception std::invalid_argument Thrown immediately if the matrix is not
+ * square.
+ */
+std::future<S21Matrix> S21Matrix::InverseMatrixAsync(
+    S21AsyncOptions options) const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Inverse can only be calculated for a square matrix.");
+  }
+  return S21Executor::Instance().Submit(
+      [m = *this, options = std::move(options)]() {
+        S21Matrix result = InverseTiled(m, options, nullptr);
+        if (options.progress) options.progress(1.0);
+        return result;
+      });
+}
+
+/**
+ * @brief Calculates the matrix of algebraic complements on the shared
+ * executor.
+ *
+ * For non-singular matrices larger than 4x4 the complements are
+ * det(A) * (A^-1)^T, computed with the same cancellable tiles as
+ * InverseMatrixAsync. Singular matrices fall back to CalcComplements(),
+ * which is only checked for cancellation before it starts.
+ *
+ * @param options Stop token and progress callback.
+ * @return A future holding the complements, or S21OperationCancelled.
+ * @exception std::invalid_argument Thrown immediately if the matrix is not
+ * square.
+ */
+std::future<S21Matrix> S21Matrix::CalcComplementsAsync(
+    S21AsyncOptions options) const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Complements can only be calculated for a square matrix.");
+  }
+  return S21Executor::Instance().Submit(
+      [m = *this, options = std::move(options)]() {
+        S21Matrix result(m.rows_, m.cols_);
+        if (m.rows_ <= 4) {
+          Checkpoint(options, 0.0);
+          result = m.CalcComplements();
+        } else {
+          double det = 0.0;
+          try {
+            S21Matrix inverse = InverseTiled(m, options, &det);
+            for (int i = 0; i < m.rows_; ++i) {
+              for (int j = 0; j < m.cols_; ++j) {
+                result.matrix_[result.Index(i, j)] =
+                    det * inverse.matrix_[inverse.Index(j, i)];
+              }
+            }
+          } catch (const std::invalid_argument&) {
+            Checkpoint(options, 0.5);
+            result = m.CalcComplements();
+          }
+        }
+        if (options.progress) options.progress(1.0);
+        return result;
+      });
+}
+
+/**
+ * @brief Cancellable inversion shared by the asynchronous methods.
+ *
+ * Matrices up to 4x4 are inverted directly. Larger ones are factorized with
+ * progress reported in [0, 0.5], then the columns of the inverse are solved
+ * in tiles with progress in [0.5, 1).
+ *
+ * @param m The square matrix.
+ * @param options Stop token and progress callback.
+ * @param determinant If not null, receives det(m) for matrices larger than
+ * 4x4.
+ * @return The inverse of m.
+ * @exception std::invalid_argument Thrown if m is singular.
+ * @exception S21OperationCancelled Thrown if stop was requested.
+ */
+S21Matrix S21Matrix::InverseTiled(const S21Matrix& m,
+                                  const S21AsyncOptions& options,
+                                  double* determinant) {
+  int n = m.rows_;
+  Checkpoint(options, 0.0);
+  if (n <= 4) return m.InverseMatrix();
+
+  LuFactorization lu;
+  lu.Compute(m.matrix_, n, [&options, n](int done) {
+    Checkpoint(options, 0.5 * done / n);
+  });
+  if (lu.singular) {
+    throw std::invalid_argument(
+        "Matrix is singular (determinant is zero), cannot find inverse.");
+  }
+  if (determinant) *determinant = lu.determinant;
+
+  S21Matrix result(n, n);
+  std::vector<double> unit(n, 0.0);
+  std::vector<double> column(n);
+  for (int j = 0; j < n; ++j) {
+    if (j % kTileSize == 0) Checkpoint(options, 0.5 + 0.5 * j / n);
+    unit[j] = 1.0;
+    lu.Solve(unit.data(), column.data());
+    unit[j] = 0.0;
+    for (int i = 0; i < n; ++i) result.matrix_[result.Index(i, j)] = column[i];
+  }
+  return result;
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "s21_matrix_oop.h"
 
 // --- Constructors ---
@@ -7,7 +9,14 @@
  *
  * Initializes a 3x3 matrix with all elements set to zero.
  */
-S21Matrix::S21Matrix() : rows_(3), cols_(3) { AllocateMatrix(); }
+S21Matrix::S21Matrix()
+    : rows_(3),
+      cols_(3),
+      shared_count_(nullptr),
+      copy_on_write_(false),
+      version_(0) {
+  AllocateMatrix();
+}
 
 /**
  * @brief Parameterized constructor for S21Matrix.
@@ -19,7 +28,12 @@ S21Matrix::S21Matrix() : rows_(3), cols_(3) { AllocateMatrix(); }
  * @param cols Number of columns in the matrix.
  * @exception std::invalid_argument Thrown if rows or cols are less than 1.
  */
-S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
+S21Matrix::S21Matrix(int rows, int cols)
+    : rows_(rows),
+      cols_(cols),
+      shared_count_(nullptr),
+      copy_on_write_(false),
+      version_(0) {
   if (rows < 1 || cols < 1) {
     throw std::invalid_argument("Incorrect matrix dimensions");
   }
@@ -29,49 +43,60 @@ S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
 /**
  * @brief Copy constructor for S21Matrix.
  *
- * Creates a deep copy of the specified matrix.
+ * Creates a deep copy of the specified matrix. If the source has
+ * copy-on-write enabled, its heap buffer is shared instead and copied on the
+ * first write to either matrix. The cached factorization of the source, if
+ * any, is immutable and is shared with the copy.
  *
  * @param other The matrix to copy from.
  */
 S21Matrix::S21Matrix(const S21Matrix& other)
-    : rows_(other.rows_), cols_(other.cols_) {
-  AllocateMatrix();
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      matrix_[i][j] = other.matrix_[i][j];
-    }
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      shared_count_(nullptr),
+      copy_on_write_(other.copy_on_write_),
+      version_(other.version_) {
+  std::lock_guard<std::mutex> lock(other.cache_mutex_);
+  if (other.copy_on_write_ && !other.IsInline()) {
+    if (!other.shared_count_) other.shared_count_ = new std::atomic<long>(1);
+    other.shared_count_->fetch_add(1, std::memory_order_relaxed);
+    shared_count_ = other.shared_count_;
+    matrix_ = other.matrix_;
+  } else {
+    AllocateMatrix();
+    std::copy(other.matrix_, other.matrix_ + other.Size(), matrix_);
   }
+  lu_cache_ = other.lu_cache_;
 }
 
 /**
  * @brief Move constructor for S21Matrix.
  *
  * Creates a new matrix by transferring ownership of the memory from the
- * specified matrix. The original matrix is left in a valid but unspecified
- * state.
+ * specified matrix; small matrices stored inline are copied instead. The
+ * original matrix is left in a valid but unspecified state.
  *
  * @param other The matrix from which to transfer ownership.
  */
 S21Matrix::S21Matrix(S21Matrix&& other) noexcept
-    : rows_(other.rows_), cols_(other.cols_), matrix_(other.matrix_) {
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      matrix_(nullptr),
+      shared_count_(nullptr),
+      copy_on_write_(other.copy_on_write_),
+      version_(other.version_),
+      lu_cache_(std::move(other.lu_cache_)) {
+  StealMatrix(other);
+  other.Touch();
   other.rows_ = 0;
   other.cols_ = 0;
-  other.matrix_ = nullptr;
 }
 
 /**
  * @brief Destructor for the S21Matrix class.
  *
- * This destructor deallocates the memory allocated for the matrix.
- * It iterates over each row to delete the allocated memory for columns
- * and then deletes the memory allocated for row pointers.
+ * This destructor deallocates the contiguous element storage of the matrix.
  * It ensures that no memory leaks occur by setting the matrix pointer
  * to nullptr after deallocation.
  */
-S21Matrix::~S21Matrix() {
-  for (int i = 0; i < rows_; ++i) {
-    delete[] matrix_[i];
-  }
-  delete[] matrix_;
-  matrix_ = nullptr;
-}
\ No newline at end of file
+S21Matrix::~S21Matrix() { ReleaseMatrix(); }
\ No newline at end of file
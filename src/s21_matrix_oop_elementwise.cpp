@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "s21_kernels.h"
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+
+// --- Reductions ---
+
+/**
+ * @brief Calculates the sum of all elements.
+ *
+ * Fixed blocks of elements are summed with several accumulators and the
+ * block sums are added pairwise, so the result is the same for any number
+ * of threads.
+ *
+ * @return The sum of the elements.
+ */
+double S21Matrix::Sum() const {
+  const double* in = matrix_;
+  return s21_internal::BlockedReduce<double>(
+      Size(), kReduceBlock, kReduceParallelBlocks,
+      [in](std::size_t first, std::size_t last) {
+        return s21_internal::SumKernel(in + first,
+                                       static_cast<int>(last - first));
+      },
+      std::plus<double>());
+}
+
+/**
+ * @brief Calculates the trace (sum of the diagonal elements).
+ *
+ * @exception std::invalid_argument Thrown if the matrix is not square.
+ * @return The trace of the matrix.
+ */
+double S21Matrix::Trace() const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Trace can only be calculated for a square matrix.");
+  }
+  double trace = 0.0;
+  for (int i = 0; i < rows_; ++i) trace += matrix_[Index(i, i)];
+  return trace;
+}
+
+/**
+ * @brief Finds the smallest element. NaN elements are ignored unless all
+ * elements are NaN.
+ *
+ * @return The smallest element.
+ */
+double S21Matrix::Min() const {
+  const double* in = matrix_;
+  return s21_internal::BlockedReduce<double>(
+      Size(), kReduceBlock, kReduceParallelBlocks,
+      [in](std::size_t first, std::size_t last) {
+        double m = in[first];
+        for (std::size_t k = first + 1; k < last; ++k) m = std::fmin(m, in[k]);
+        return m;
+      },
+      [](double a, double b) { return std::fmin(a, b); });
+}
+
+/**
+ * @brief Finds the largest element. NaN elements are ignored unless all
+ * elements are NaN.
+ *
+ * @return The largest element.
+ */
+double S21Matrix::Max() const {
+  const double* in = matrix_;
+  return s21_internal::BlockedReduce<double>(
+      Size(), kReduceBlock, kReduceParallelBlocks,
+      [in](std::size_t first, std::size_t last) {
+        double m = in[first];
+        for (std::size_t k = first + 1; k < last; ++k) m = std::fmax(m, in[k]);
+        return m;
+      },
+      [](double a, double b) { return std::fmax(a, b); });
+}
+
+/**
+ * @brief Calculates the 1-norm (largest column sum of absolute values).
+ *
+ * Threads own disjoint column ranges and add the rows in order, so every
+ * column sum is computed the same way for any number of threads.
+ *
+ * @return The 1-norm of the matrix.
+ */
+double S21Matrix::Norm1() const {
+  std::vector<double> column_sums(cols_, 0.0);
+  int min_cols = std::max(1, kElementwiseParallel / rows_);
+  s21_internal::ParallelFor(0, cols_, min_cols, [&](int lo, int hi) {
+    for (int i = 0; i < rows_; ++i) {
+      const double* row = matrix_ + Index(i, 0);
+      for (int j = lo; j < hi; ++j) column_sums[j] += std::fabs(row[j]);
+    }
+  });
+  return s21_internal::AbsMaxKernel(column_sums.data(), cols_);
+}
+
+/**
+ * @brief Calculates the infinity norm (largest row sum of absolute values).
+ *
+ * @return The infinity norm of the matrix.
+ */
+double S21Matrix::NormInf() const {
+  std::vector<double> row_sums(rows_, 0.0);
+  int min_rows = std::max(1, kElementwiseParallel / cols_);
+  s21_internal::ParallelFor(0, rows_, min_rows, [&](int lo, int hi) {
+    for (int i = lo; i < hi; ++i) {
+      row_sums[i] = s21_internal::AbsSumKernel(matrix_ + Index(i, 0), cols_);
+    }
+  });
+  return s21_internal::AbsMaxKernel(row_sums.data(), rows_);
+}
+
+/**
+ * @brief Calculates the Frobenius norm (square root of the sum of squares).
+ *
+ * The sum of squares is accumulated directly; if it overflows or underflows,
+ * the computation is repeated on values scaled by the largest magnitude.
+ *
+ * @return The Frobenius norm of the matrix.
+ */
+double S21Matrix::NormFrobenius() const {
+  const double* in = matrix_;
+  double sum = s21_internal::BlockedReduce<double>(
+      Size(), kReduceBlock, kReduceParallelBlocks,
+      [in](std::size_t first, std::size_t last) {
+        int n = static_cast<int>(last - first);
+        return s21_internal::DotKernel(in + first, in + first, n);
+      },
+      std::plus<double>());
+  if (std::isfinite(sum) && sum > 1e-280) return std::sqrt(sum);
+
+  double scale = NormMax();
+  if (scale == 0.0 || !std::isfinite(scale)) return scale;
+  double scaled = Reduce(0.0, std::plus<double>(), [scale](double x) {
+    double v = x / scale;
+    return v * v;
+  });
+  return scale * std::sqrt(scaled);
+}
+
+/**
+ * @brief Calculates the max norm (largest absolute value of an element).
+ *
+ * @return The max norm of the matrix.
+ */
+double S21Matrix::NormMax() const {
+  const double* in = matrix_;
+  return s21_internal::BlockedReduce<double>(
+      Size(), kReduceBlock, kReduceParallelBlocks,
+      [in](std::size_t first, std::size_t last) {
+        return s21_internal::AbsMaxKernel(in + first,
+                                          static_cast<int>(last - first));
+      },
+      s21_internal::NanMax);
+}
+
+// --- Elementwise operations ---
+
+/**
+ * @brief Multiplies every element by the corresponding element of another
+ * matrix (Hadamard product), storing the result in this matrix.
+ *
+ * @param other A matrix of the same dimensions.
+ * @exception std::invalid_argument Thrown if the dimensions differ.
+ */
+void S21Matrix::HadamardMul(const S21Matrix& other) {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    throw std::invalid_argument(
+        "Matrices have different dimensions for HadamardMul.");
+  }
+  Touch();
+  double* out = matrix_;
+  const double* in = other.matrix_;
+  ForEachRange(true, [&](std::size_t first, std::size_t last) {
+    for (std::size_t k = first; k < last; ++k) out[k] *= in[k];
+  });
+}
+
+/**
+ * @brief Divides every element by the corresponding element of another
+ * matrix, storing the result in this matrix. Division by zero follows IEEE
+ * arithmetic and yields an infinity or NaN.
+ *
+ * @param other A matrix of the same dimensions.
+ * @exception std::invalid_argument Thrown if the dimensions differ.
+ */
+void S21Matrix::HadamardDiv(const S21Matrix& other) {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    throw std::invalid_argument(
+        "Matrices have different dimensions for HadamardDiv.");
+  }
+  Touch();
+  double* out = matrix_;
+  const double* in = other.matrix_;
+  ForEachRange(true, [&](std::size_t first, std::size_t last) {
+    for (std::size_t k = first; k < last; ++k) out[k] /= in[k];
+  });
+}
+
+/**
+ * @brief Limits every element to the range [lo, hi]. NaN elements are kept.
+ *
+ * @param lo The lower bound.
+ * @param hi The upper bound.
+ * @exception std::invalid_argument Thrown if lo > hi or a bound is NaN.
+ */
+void S21Matrix::Clamp(double lo, double hi) {
+  if (!(lo <= hi)) {
+    throw std::invalid_argument("Clamp bounds must satisfy lo <= hi.");
+  }
+  Apply([lo, hi](double x) { return x < lo ? lo : (hi < x ? hi : x); });
+}
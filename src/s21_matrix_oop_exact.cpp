@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "s21_bigint.h"
+#include "s21_matrix_oop.h"
+
+namespace {
+/**
+ * @brief Splits a finite non-zero double into x = mantissa * 2^exponent
+ * with an odd integer mantissa.
+ */
+void Decompose(double x, long long* mantissa, int* exponent) {
+  int e = 0;
+  double fraction = std::frexp(x, &e);
+  *mantissa = static_cast<long long>(std::ldexp(fraction, 53));
+  int zeros = __builtin_ctzll(static_cast<unsigned long long>(*mantissa));
+  *mantissa >>= zeros;
+  *exponent = e - 53 + zeros;
+}
+
+/**
+ * @brief Integer arithmetic for Bareiss elimination on 64-bit words.
+ *
+ * The cross products are formed in 128 bits, so a step only fails when the
+ * exact quotient does not fit into 64 bits.
+ */
+struct Int64Arithmetic {
+  using Value = long long;
+
+  static bool Load(double x, int shift, Value* out) {
+    double scaled = std::ldexp(x, shift);
+    if (std::fabs(scaled) >= 0x1p62) return false;
+    *out = static_cast<Value>(scaled);
+    return true;
+  }
+  static bool IsZero(Value x) { return x == 0; }
+  static bool Step(Value a_ij, Value a_kk, Value a_ik, Value a_kj, Value prev,
+                   Value* out) {
+    __int128 cross = static_cast<__int128>(a_ij) * a_kk -
+                     static_cast<__int128>(a_ik) * a_kj;
+    if (cross > LLONG_MIN && cross <= LLONG_MAX) {
+      // Common case: a 64-bit division is several times cheaper.
+      *out = static_cast<Value>(cross) / prev;
+      return true;
+    }
+    __int128 quotient = cross / prev;
+    if (quotient > LLONG_MAX || quotient < LLONG_MIN) return false;
+    *out = static_cast<Value>(quotient);
+    return true;
+  }
+  static S21BigInt ToBig(Value x) { return S21BigInt(x); }
+};
+
+/**
+ * @brief Integer arithmetic for Bareiss elimination on 128-bit words with
+ * overflow detection.
+ */
+struct Int128Arithmetic {
+  using Value = __int128;
+  static constexpr Value kMin =
+      static_cast<Value>(static_cast<unsigned __int128>(1) << 127);
+
+  static bool Load(double x, int shift, Value* out) {
+    double scaled = std::ldexp(x, shift);
+    if (std::fabs(scaled) >= 0x1p126) return false;
+    *out = static_cast<Value>(scaled);
+    return true;
+  }
+  static bool IsZero(Value x) { return x == 0; }
+  static bool Step(Value a_ij, Value a_kk, Value a_ik, Value a_kj, Value prev,
+                   Value* out) {
+    Value first = 0;
+    Value second = 0;
+    Value cross = 0;
+    if (__builtin_mul_overflow(a_ij, a_kk, &first) ||
+        __builtin_mul_overflow(a_ik, a_kj, &second) ||
+        __builtin_sub_overflow(first, second, &cross)) {
+      return false;
+    }
+    if (prev == -1 && cross == kMin) return false;
+    *out = cross / prev;
+    return true;
+  }
+  static S21BigInt ToBig(Value x) {
+    // Split into 42-bit pieces that each fit into long long.
+    bool negative = x < 0;
+    unsigned __int128 magnitude =
+        negative ? 0 - static_cast<unsigned __int128>(x)
+                 : static_cast<unsigned __int128>(x);
+    constexpr unsigned __int128 kMask = (static_cast<unsigned __int128>(1)
+                                         << 42) - 1;
+    S21BigInt result;
+    for (int shift = 84; shift >= 0; shift -= 42) {
+      auto piece = static_cast<long long>((magnitude >> shift) & kMask);
+      result = (result << 42) + S21BigInt(piece);
+    }
+    return negative ? -result : result;
+  }
+};
+
+/**
+ * @brief Arbitrary-precision arithmetic for Bareiss elimination; never
+ * overflows.
+ */
+struct BigArithmetic {
+  using Value = S21BigInt;
+
+  static bool Load(double x, int shift, Value* out) {
+    if (x == 0.0) {
+      *out = S21BigInt();
+      return true;
+    }
+    long long mantissa = 0;
+    int exponent = 0;
+    Decompose(x, &mantissa, &exponent);
+    // x * 2^shift is an integer, so a negative total exponent only removes
+    // zero bits.
+    int total = exponent + shift;
+    *out = total >= 0 ? S21BigInt(mantissa) << total
+                      : S21BigInt(mantissa >> -total);
+    return true;
+  }
+  static bool IsZero(const Value& x) { return x.IsZero(); }
+  static bool Step(const Value& a_ij, const Value& a_kk, const Value& a_ik,
+                   const Value& a_kj, const Value& prev, Value* out) {
+    *out = (a_ij * a_kk - a_ik * a_kj).DivideExact(prev);
+    return true;
+  }
+  static S21BigInt ToBig(const Value& x) { return x; }
+};
+
+/**
+ * @brief Result of an exact elimination: the rank, and for a square
+ * matrix of full rank its determinant.
+ */
+struct ExactElimination {
+  int rank = 0;
+  S21BigInt determinant;
+};
+
+/**
+ * @brief Fraction-free Gaussian elimination (Bareiss) of the integer matrix
+ * a(i, j) * 2^shifts[i].
+ *
+ * After eliminating with pivot k every remaining entry equals a minor of
+ * the original matrix, so the division by the previous pivot is exact and
+ * the entries grow only polynomially. Columns without a non-zero pivot are
+ * skipped, which makes the number of pivots the exact rank. O(rows * cols *
+ * min(rows, cols)) arithmetic operations.
+ *
+ * @return false if a value did not fit into Arithmetic::Value.
+ */
+template <typename Arithmetic>
+bool Bareiss(const double* a, int rows, int cols,
+             const std::vector<int>& shifts, ExactElimination* result) {
+  using Value = typename Arithmetic::Value;
+  std::vector<Value> m(static_cast<std::size_t>(rows) * cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      std::size_t index = static_cast<std::size_t>(i) * cols + j;
+      if (!Arithmetic::Load(a[index], shifts[i], &m[index])) return false;
+    }
+  }
+  auto at = [&](int i, int j) -> Value& {
+    return m[static_cast<std::size_t>(i) * cols + j];
+  };
+
+  Value prev = Value(1);
+  int rank = 0;
+  bool negate = false;
+  for (int col = 0; col < cols && rank < rows; ++col) {
+    int pivot = rank;
+    while (pivot < rows && Arithmetic::IsZero(at(pivot, col))) ++pivot;
+    if (pivot == rows) continue;
+    if (pivot != rank) {
+      for (int j = col; j < cols; ++j) std::swap(at(pivot, j), at(rank, j));
+      negate = !negate;
+    }
+    for (int i = rank + 1; i < rows; ++i) {
+      for (int j = col + 1; j < cols; ++j) {
+        if (!Arithmetic::Step(at(i, j), at(rank, col), at(i, col),
+                              at(rank, j), prev, &at(i, j))) {
+          return false;
+        }
+      }
+      at(i, col) = Value(0);
+    }
+    prev = at(rank, col);
+    ++rank;
+  }
+
+  result->rank = rank;
+  result->determinant = S21BigInt();
+  if (rows == cols && rank == rows) {
+    S21BigInt last = Arithmetic::ToBig(prev);
+    result->determinant = negate ? -last : last;
+  }
+  return true;
+}
+
+/**
+ * @brief Runs the elimination in 64-bit, then 128-bit, then arbitrary
+ * precision integers, moving to the next width on overflow.
+ */
+ExactElimination Eliminate(const double* a, int rows, int cols,
+                           const std::vector<int>& shifts) {
+  ExactElimination result;
+  if (!Bareiss<Int64Arithmetic>(a, rows, cols, shifts, &result) &&
+      !Bareiss<Int128Arithmetic>(a, rows, cols, shifts, &result)) {
+    Bareiss<BigArithmetic>(a, rows, cols, shifts, &result);
+  }
+  return result;
+}
+}  // namespace
+
+/**
+ * @brief Calculates the exact determinant of a matrix of integers.
+ *
+ * Uses Bareiss fraction-free elimination in O(n^3) integer operations, so
+ * there is no rounding and no factorial-time cofactor expansion. The
+ * elimination runs on 64-bit integers and restarts with 128-bit and then
+ * arbitrary-precision integers if an intermediate value overflows.
+ *
+ * @exception std::invalid_argument Thrown if the matrix is not square or an
+ * element is not a finite integer.
+ * @return The determinant.
+ */
+S21BigInt S21Matrix::DeterminantExact() const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Determinant can only be calculated for a square matrix.");
+  }
+  for (std::size_t k = 0; k < Size(); ++k) {
+    if (!std::isfinite(matrix_[k]) || std::trunc(matrix_[k]) != matrix_[k]) {
+      throw std::invalid_argument(
+          "DeterminantExact requires integer elements.");
+    }
+  }
+  return Eliminate(matrix_, rows_, cols_, std::vector<int>(rows_, 0))
+      .determinant;
+}
+
+/**
+ * @brief Calculates the exact rank of the matrix.
+ *
+ * Every finite double is an integer times a power of two, so each row is
+ * scaled by the power of two that makes all its elements integers (this
+ * does not change the rank) and the rank is counted by Bareiss elimination
+ * without any rounding or tolerance.
+ *
+ * @exception std::invalid_argument Thrown if an element is not finite.
+ * @return The rank of the matrix.
+ */
+int S21Matrix::Rank() const {
+  std::vector<int> shifts(rows_, 0);
+  for (int i = 0; i < rows_; ++i) {
+    int lowest_bit = INT_MAX;
+    for (int j = 0; j < cols_; ++j) {
+      double x = matrix_[Index(i, j)];
+      if (!std::isfinite(x)) {
+        throw std::invalid_argument("Rank requires finite elements.");
+      }
+      if (x == 0.0) continue;
+      long long mantissa = 0;
+      int exponent = 0;
+      Decompose(x, &mantissa, &exponent);
+      lowest_bit = std::min(lowest_bit, exponent);
+    }
+    if (lowest_bit != INT_MAX) shifts[i] = -lowest_bit;
+  }
+  return Eliminate(matrix_, rows_, cols_, shifts).rank;
+}
@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <string>
+
+#include "s21_allocator.h"
 #include "s21_matrix_oop.h"
 
 // --- Accessors ---
@@ -16,6 +22,135 @@ int S21Matrix::get_rows() const { return rows_; }
  */
 int S21Matrix::get_cols() const { return cols_; }
 
+/**
+ * @brief Get the modification version of the matrix.
+ *
+ * The version changes on every non-const access path (operator(), At, data,
+ * row, begin/end, arithmetic, resizing, assignment). Cached results such as
+ * the LU factorization are valid only for the version they were computed at.
+ * Writes through a pointer or span obtained earlier are not tracked; obtain
+ * it again after the last write to invalidate the cache.
+ *
+ * @return The current version.
+ */
+std::uint64_t S21Matrix::get_version() const { return version_; }
+
+/**
+ * @brief Get whether copies of this matrix share its storage.
+ *
+ * @return true if copy-on-write is enabled.
+ */
+bool S21Matrix::get_copy_on_write() const { return copy_on_write_; }
+
+// --- Raw storage ---
+
+/**
+ * @brief Get the contiguous row-major element storage.
+ *
+ * Element (i, j) is data()[i * stride() + j]. The pointer is invalidated by
+ * set_rows, set_cols and assignment.
+ *
+ * @return Pointer to the first element.
+ */
+double* S21Matrix::data() {
+  Touch();
+  return matrix_;
+}
+
+/**
+ * @brief Get the contiguous row-major element storage for reading.
+ *
+ * @return Pointer to the first element.
+ */
+const double* S21Matrix::data() const { return matrix_; }
+
+/**
+ * @brief Get the distance, in elements, between the starts of two rows.
+ *
+ * @return The row stride of data().
+ */
+int S21Matrix::stride() const { return cols_; }
+
+/**
+ * @brief Get a view of one row.
+ *
+ * @param row The row index.
+ * @return A span over the cols elements of the row.
+ * @throw std::out_of_range if the row index is out of range.
+ */
+std::span<double> S21Matrix::row(int row) {
+  if (row >= rows_ || row < 0) {
+    throw std::out_of_range("Index out of range.");
+  }
+  Touch();
+  return std::span<double>(matrix_ + Index(row, 0), cols_);
+}
+
+/**
+ * @brief Get a read-only view of one row.
+ *
+ * @param row The row index.
+ * @return A span over the cols elements of the row.
+ * @throw std::out_of_range if the row index is out of range.
+ */
+std::span<const double> S21Matrix::row(int row) const {
+  if (row >= rows_ || row < 0) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return std::span<const double>(matrix_ + Index(row, 0), cols_);
+}
+
+/**
+ * @brief Iterator to the first element in row-major order.
+ *
+ * The iterators are random access, so the matrix can be passed directly to
+ * <algorithm> and <numeric>, including the parallel execution policies.
+ *
+ * @return Iterator to the first element.
+ */
+S21Matrix::iterator S21Matrix::begin() {
+  Touch();
+  return matrix_;
+}
+
+/**
+ * @brief Iterator past the last element in row-major order.
+ *
+ * @return Past-the-end iterator.
+ */
+S21Matrix::iterator S21Matrix::end() {
+  Touch();
+  return matrix_ + Size();
+}
+
+/**
+ * @brief Read-only iterator to the first element in row-major order.
+ *
+ * @return Iterator to the first element.
+ */
+S21Matrix::const_iterator S21Matrix::begin() const { return matrix_; }
+
+/**
+ * @brief Read-only iterator past the last element in row-major order.
+ *
+ * @return Past-the-end iterator.
+ */
+S21Matrix::const_iterator S21Matrix::end() const { return matrix_ + Size(); }
+
+/**
+ * @brief Read-only iterator to the first element in row-major order.
+ *
+ * @return Iterator to the first element.
+ */
+S21Matrix::const_iterator S21Matrix::cbegin() const { return matrix_; }
+
+/**
+ * @brief Read-only iterator past the last element in row-major order.
+ *
+ * @return Past-the-end iterator.
+ */
+S21Matrix::const_iterator S21Matrix::cend() const { return matrix_ + Size(); }
+
 // --- Mutators ---
 
 /**
@@ -34,11 +169,8 @@ void S21Matrix::set_rows(int new_rows) {
   S21Matrix new_matrix(new_rows, cols_);
 
   int rows_to_copy = std::min(rows_, new_rows);
-  for (int i = 0; i < rows_to_copy; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      new_matrix.matrix_[i][j] = matrix_[i][j];
-    }
-  }
+  std::copy(matrix_, matrix_ + Index(rows_to_copy, 0), new_matrix.matrix_);
+  new_matrix.copy_on_write_ = copy_on_write_;
 
   *this = std::move(new_matrix);
 }
@@ -60,34 +192,125 @@ void S21Matrix::set_cols(int new_cols) {
 
   int cols_to_copy = std::min(cols_, new_cols);
   for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < cols_to_copy; ++j) {
-      new_matrix.matrix_[i][j] = matrix_[i][j];
-    }
+    std::copy(matrix_ + Index(i, 0), matrix_ + Index(i, cols_to_copy),
+              new_matrix.matrix_ + new_matrix.Index(i, 0));
   }
+  new_matrix.copy_on_write_ = copy_on_write_;
   *this = std::move(new_matrix);
 }
 
+/**
+ * @brief Enable or disable copy-on-write for copies made from this matrix.
+ *
+ * With copy-on-write enabled, copy construction and copy assignment from
+ * this matrix share its heap buffer through an atomic reference count
+ * instead of copying the elements. Every non-const access path of any
+ * sharing matrix detaches it first by copying the buffer, so the copies
+ * behave exactly like deep copies. Copies inherit the mode. Matrices stored
+ * inline are always copied. Pointers, spans and iterators obtained before a
+ * copy was made write into the shared buffer; obtain them again after
+ * copying.
+ *
+ * @param enabled Whether copies should share storage.
+ */
+void S21Matrix::set_copy_on_write(bool enabled) { copy_on_write_ = enabled; }
+
 // --- Allocators ---
 
 /**
  * @brief Allocate memory for the matrix with the current number of rows and
  * columns. Initializes all elements to zero.
+ *
+ * Shapes with at most kInlineCapacity elements use the buffer embedded in
+ * the object, so small matrices and temporaries cost no heap allocation.
+ * Larger buffers follow the S21Allocator policy (huge pages, NUMA
+ * placement, first touch by row blocks).
  */
 void S21Matrix::AllocateMatrix() {
-  matrix_ = new double*[rows_];
-  for (int i = 0; i < rows_; ++i) {
-    matrix_[i] = new double[cols_]();
+  if (Size() <= kInlineCapacity) {
+    matrix_ = inline_;
+    std::fill(inline_, inline_ + Size(), 0.0);
+  } else {
+    matrix_ = S21Allocator::Allocate(Size(), rows_);
   }
 }
 
+/**
+ * @brief Frees the element storage if it lives on the heap. A shared buffer
+ * is freed by the last matrix that releases it.
+ */
+void S21Matrix::ReleaseMatrix() noexcept {
+  if (shared_count_) {
+    if (shared_count_->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      S21Allocator::Deallocate(matrix_);
+      delete shared_count_;
+    }
+    shared_count_ = nullptr;
+  } else if (!IsInline()) {
+    S21Allocator::Deallocate(matrix_);
+  }
+  matrix_ = nullptr;
+}
+
+/**
+ * @brief Gives the matrix exclusive ownership of its storage, copying the
+ * shared buffer unless this matrix is its last user.
+ */
+void S21Matrix::Detach() {
+  if (shared_count_->load(std::memory_order_acquire) == 1) {
+    delete shared_count_;
+  } else {
+    double* own = S21Allocator::Allocate(Size(), rows_);
+    std::copy(matrix_, matrix_ + Size(), own);
+    if (shared_count_->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      S21Allocator::Deallocate(matrix_);
+      delete shared_count_;
+    }
+    matrix_ = own;
+  }
+  shared_count_ = nullptr;
+}
+
+/**
+ * @brief Takes over the element storage of other, leaving other without
+ * storage. Heap buffers change owner together with their reference count;
+ * inline elements are copied.
+ *
+ * rows_ and cols_ must already describe the shape of other.
+ */
+void S21Matrix::StealMatrix(S21Matrix& other) noexcept {
+  if (other.IsInline()) {
+    std::copy(other.inline_, other.inline_ + other.Size(), inline_);
+    matrix_ = inline_;
+  } else {
+    matrix_ = other.matrix_;
+    shared_count_ = other.shared_count_;
+  }
+  other.matrix_ = nullptr;
+  other.shared_count_ = nullptr;
+}
+
 // --- Printers ---
 
 /**
  * @brief Print the matrix to the standard output with one decimal precision.
+ *
+ * Each element is followed by a space and each row by a newline. Values are
+ * formatted with std::to_chars into one buffer that is written at once.
  */
-// void S21Matrix::printMatrix() const {
-//   for (int i = 0; i < rows_; i++) {
-//     for (int j = 0; j < cols_; j++) printf("%.1lf ", matrix_[i][j]);
-//     printf("\n");
-//   }
-// }
+void S21Matrix::printMatrix() const {
+  std::string text;
+  char number[400];
+  for (int i = 0; i < rows_; ++i) {
+    for (int j = 0; j < cols_; ++j) {
+      char* end = std::to_chars(number, number + sizeof(number),
+                                matrix_[Index(i, j)],
+                                std::chars_format::fixed, 1)
+                      .ptr;
+      text.append(number, end);
+      text.push_back(' ');
+    }
+    text.push_back('\n');
+  }
+  std::fwrite(text.data(), 1, text.size(), stdout);
+}
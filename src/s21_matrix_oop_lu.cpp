@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <cfloat>
+#include <vector>
+
+#include "s21_backend.h"
+#include "s21_kernels.h"
+#include "s21_matrix_lu.h"
+
+// --- Factorization ---
+
+/**
+ * @brief Factorizes an n x n row-major matrix with partial pivoting.
+ *
+ * Right-looking elimination: for every pivot column the rows below are
+ * updated with contiguous axpy operations. A pivot not larger than
+ * n * DBL_EPSILON times the largest element of its original row marks the
+ * matrix as singular (the row is numerically a combination of the rows
+ * above); an exactly zero pivot column is skipped. Without a progress
+ * callback, large matrices are factorized by the system LAPACK when that
+ * backend is selected (see S21LinearAlgebra).
+ *
+ * @param a The matrix elements.
+ * @param order The matrix order n.
+ * @param on_step Optional progress callback, see the struct description.
+ */
+void S21Matrix::LuFactorization::Compute(
+    const double* a, int order, const std::function<void(int)>& on_step) {
+  n = order;
+  lu.assign(a, a + static_cast<size_t>(n) * n);
+  permutation.resize(n);
+  for (int i = 0; i < n; ++i) permutation[i] = i;
+
+  std::vector<double> row_scale(n);
+  for (int i = 0; i < n; ++i) {
+    row_scale[i] =
+        s21_internal::AbsMaxKernel(a + static_cast<size_t>(i) * n, n);
+  }
+  double tolerance = n * DBL_EPSILON;
+  double sign = 1.0;
+  double product = 1.0;
+  singular = false;
+
+  // The system library cannot report progress, so it is used only when no
+  // callback is installed.
+  if (!on_step && s21_internal::SystemLu(lu.data(), permutation.data(), n,
+                                         &sign)) {
+    for (int k = 0; k < n; ++k) {
+      double diag = lu[k * n + k];
+      product *= diag;
+      if (std::fabs(diag) <= tolerance * row_scale[permutation[k]]) {
+        singular = true;
+      }
+    }
+    determinant = sign * product;
+    return;
+  }
+
+  for (int k = 0; k < n; ++k) {
+    if (on_step && k % 32 == 0) on_step(k);
+    int pivot = k;
+    for (int i = k + 1; i < n; ++i) {
+      if (std::fabs(lu[i * n + k]) > std::fabs(lu[pivot * n + k])) pivot = i;
+    }
+    if (pivot != k) {
+      std::swap_ranges(lu.begin() + k * n, lu.begin() + (k + 1) * n,
+                       lu.begin() + pivot * n);
+      std::swap(permutation[k], permutation[pivot]);
+      sign = -sign;
+    }
+
+    double diag = lu[k * n + k];
+    product *= diag;
+    if (std::fabs(diag) <= tolerance * row_scale[permutation[k]]) {
+      singular = true;
+    }
+    if (diag == 0.0) continue;
+
+    const double* pivot_row = lu.data() + k * n;
+    for (int i = k + 1; i < n; ++i) {
+      double* row = lu.data() + i * n;
+      double factor = row[k] / diag;
+      row[k] = factor;
+      s21_internal::AxpyKernel(-factor, pivot_row + k + 1, row + k + 1,
+                               n - k - 1);
+    }
+  }
+  determinant = sign * product;
+}
+
+/**
+ * @brief Solves A x = b using the stored factors.
+ *
+ * @param b The right-hand side, n elements.
+ * @param x Receives the solution, n elements; must not alias b.
+ */
+void S21Matrix::LuFactorization::Solve(const double* b, double* x) const {
+  for (int i = 0; i < n; ++i) {
+    const double* row = lu.data() + i * n;
+    x[i] = b[permutation[i]] - s21_internal::DotKernel(row, x, i);
+  }
+  for (int i = n - 1; i >= 0; --i) {
+    const double* row = lu.data() + i * n;
+    double sum = s21_internal::DotKernel(row + i + 1, x + i + 1, n - i - 1);
+    x[i] = (x[i] - sum) / row[i];
+  }
+}
+
+// --- Cache ---
+
+/**
+ * @brief Returns the LU factorization of the matrix, computing it on first
+ * use.
+ *
+ * The factorization is cached and reused while the matrix version is
+ * unchanged, so repeated Determinant, InverseMatrix and Solve calls pay for
+ * the O(n^3) elimination once. The cache is guarded by a mutex: concurrent
+ * const callers are safe, and only one of them computes the factors.
+ *
+ * @return Shared, immutable factorization for the current version.
+ */
+std::shared_ptr<const S21Matrix::LuFactorization> S21Matrix::Factorize()
+    const {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (lu_cache_ && lu_cache_->version == version_) {
+    return lu_cache_;
+  }
+  auto factorization = std::make_shared<LuFactorization>();
+  factorization->Compute(matrix_, rows_);
+  factorization->version = version_;
+  lu_cache_ = factorization;
+  return factorization;
+}
+
+/**
+ * @brief The cached LU factorization if it belongs to the current version,
+ * otherwise nullptr; never computes one.
+ */
+std::shared_ptr<const S21Matrix::LuFactorization>
+S21Matrix::CurrentFactorization() const {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (lu_cache_ && lu_cache_->version == version_) return lu_cache_;
+  return nullptr;
+}
+
+// --- Linear systems ---
+
+/**
+ * @brief Solves the linear system A * X = B for X.
+ *
+ * Uses the cached LU factorization, so solving several right-hand sides in
+ * separate calls costs O(n^2) per column after the first call.
+ *
+ * @param rhs The right-hand side B; must have as many rows as the matrix.
+ * @return The solution X with the shape of B.
+ * @exception std::invalid_argument Thrown if the matrix is not square, the
+ * shapes do not match, or the matrix is singular.
+ */
+S21Matrix S21Matrix::Solve(const S21Matrix& rhs) const {
+  if (rows_ != cols_ || rhs.rows_ != rows_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for solving a linear system.");
+  }
+  std::shared_ptr<const LuFactorization> lu = Factorize();
+  if (lu->singular) {
+    throw std::invalid_argument("Matrix is singular, cannot solve.");
+  }
+
+  S21Matrix result(rhs.rows_, rhs.cols_);
+  std::vector<double> column(rows_);
+  std::vector<double> solution(rows_);
+  for (int j = 0; j < rhs.cols_; ++j) {
+    for (int i = 0; i < rows_; ++i) column[i] = rhs.matrix_[rhs.Index(i, j)];
+    lu->Solve(column.data(), solution.data());
+    for (int i = 0; i < rows_; ++i) {
+      result.matrix_[result.Index(i, j)] = solution[i];
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Solves the linear system A * x = b for x.
+ *
+ * @param rhs The right-hand side b; its size must equal the matrix order.
+ * @return The solution x.
+ * @exception std::invalid_argument Thrown if the matrix is not square, the
+ * sizes do not match, or the matrix is singular.
+ */
+S21Vector S21Matrix::Solve(const S21Vector& rhs) const {
+  if (rows_ != cols_ || rhs.get_size() != rows_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for solving a linear system.");
+  }
+  std::shared_ptr<const LuFactorization> lu = Factorize();
+  if (lu->singular) {
+    throw std::invalid_argument("Matrix is singular, cannot solve.");
+  }
+  S21Vector result(rows_);
+  lu->Solve(rhs.data(), result.data());
+  return result;
+}
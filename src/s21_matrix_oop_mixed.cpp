@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <cfloat>
+#include <limits>
+#include <vector>
+
+#include "s21_kernels.h"
+#include "s21_matrix_lu.h"
+
+namespace {
+// LAPACK dsgesv uses the same limit on refinement steps.
+constexpr int kMaxRefinementSteps = 30;
+
+/**
+ * @brief Single-precision LU factorization with partial pivoting.
+ *
+ * Half the memory traffic of the double factorization. ok is false when the
+ * matrix does not fit into float or a pivot vanishes; the caller then falls
+ * back to double precision.
+ */
+struct FloatLu {
+  int n = 0;
+  std::vector<float> lu;
+  std::vector<int> permutation;
+  bool ok = true;
+
+  void Compute(const double* a, int order) {
+    n = order;
+    lu.resize(static_cast<size_t>(n) * n);
+    for (size_t i = 0; i < lu.size(); ++i) {
+      if (std::fabs(a[i]) > FLT_MAX) ok = false;
+      lu[i] = static_cast<float>(a[i]);
+    }
+    permutation.resize(n);
+    for (int i = 0; i < n; ++i) permutation[i] = i;
+
+    for (int k = 0; k < n && ok; ++k) {
+      int pivot = k;
+      for (int i = k + 1; i < n; ++i) {
+        if (std::fabs(lu[i * n + k]) > std::fabs(lu[pivot * n + k])) pivot = i;
+      }
+      if (pivot != k) {
+        std::swap_ranges(lu.begin() + k * n, lu.begin() + (k + 1) * n,
+                         lu.begin() + pivot * n);
+        std::swap(permutation[k], permutation[pivot]);
+      }
+      float diag = lu[k * n + k];
+      if (diag == 0.0f || !std::isfinite(diag)) {
+        ok = false;
+        break;
+      }
+      const float* pivot_row = lu.data() + k * n;
+      for (int i = k + 1; i < n; ++i) {
+        float* row = lu.data() + i * n;
+        float factor = row[k] / diag;
+        row[k] = factor;
+        for (int j = k + 1; j < n; ++j) row[j] -= factor * pivot_row[j];
+      }
+    }
+  }
+
+  // Solves A x = b in single precision; input and output stay double.
+  void Solve(const double* b, double* x) const {
+    std::vector<float> y(n);
+    for (int i = 0; i < n; ++i) {
+      const float* row = lu.data() + i * n;
+      float sum = static_cast<float>(b[permutation[i]]);
+      for (int j = 0; j < i; ++j) sum -= row[j] * y[j];
+      y[i] = sum;
+    }
+    for (int i = n - 1; i >= 0; --i) {
+      const float* row = lu.data() + i * n;
+      float sum = y[i];
+      for (int j = i + 1; j < n; ++j) sum -= row[j] * y[j];
+      y[i] = sum / row[i];
+    }
+    for (int i = 0; i < n; ++i) x[i] = y[i];
+  }
+};
+
+/**
+ * @brief Normwise backward error of x for A x = b in the infinity norm.
+ *
+ * @param residual Receives b - A x.
+ */
+double BackwardError(const double* a, int n, double a_norm, const double* b,
+                     const double* x, std::vector<double>& residual) {
+  double r_norm = 0.0;
+  for (int i = 0; i < n; ++i) {
+    residual[i] = b[i] - s21_internal::DotKernel(a + i * n, x, n);
+    r_norm = std::fmax(r_norm, std::fabs(residual[i]));
+  }
+  double denominator = a_norm * s21_internal::AbsMaxKernel(x, n) +
+                       s21_internal::AbsMaxKernel(b, n);
+  if (!std::isfinite(r_norm)) return std::numeric_limits<double>::infinity();
+  return denominator == 0.0 ? 0.0 : r_norm / denominator;
+}
+
+/**
+ * @brief Iterative refinement of one right-hand side.
+ *
+ * x = solve_float(b); repeat r = b - A x in double, x += solve_float(r) until
+ * the backward error reaches sqrt(n) * DBL_EPSILON or the step limit.
+ *
+ * @return true if the solution reached double-precision accuracy.
+ */
+bool RefineColumn(const FloatLu& lu, const double* a, int n, double a_norm,
+                  const double* b, double* x, int* iterations,
+                  double* backward_error) {
+  double tolerance = std::sqrt(static_cast<double>(n)) * DBL_EPSILON;
+  std::vector<double> residual(n);
+  std::vector<double> correction(n);
+  lu.Solve(b, x);
+  for (int step = 0;; ++step) {
+    *backward_error = BackwardError(a, n, a_norm, b, x, residual);
+    *iterations = step;
+    if (*backward_error <= tolerance) return true;
+    if (step == kMaxRefinementSteps || !std::isfinite(*backward_error)) {
+      return false;
+    }
+    lu.Solve(residual.data(), correction.data());
+    for (int i = 0; i < n; ++i) x[i] += correction[i];
+  }
+}
+}  // namespace
+
+/**
+ * @brief Solves A * X = B with a single-precision factorization refined to
+ * double-precision accuracy.
+ *
+ * The O(n^3) factorization runs in float, which moves half the memory of the
+ * double path. Each column is then refined with residuals computed in double
+ * (O(n^2) per step). A column whose refinement does not reach a backward
+ * error of sqrt(n) * DBL_EPSILON within 30 steps, typically because A is
+ * too ill-conditioned for float, is solved again with the double LU
+ * factorization.
+ *
+ * @param rhs The right-hand side B; must have as many rows as the matrix.
+ * @param report If not null, receives iteration count, backward error and
+ * whether the double fallback was used.
+ * @return The solution X with the shape of B.
+ * @exception std::invalid_argument Thrown if the matrix is not square, the
+ * shapes do not match, or the matrix is singular.
+ */
+S21Matrix S21Matrix::SolveMixed(const S21Matrix& rhs,
+                                S21RefinementReport* report) const {
+  if (rows_ != cols_ || rhs.rows_ != rows_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for solving a linear system.");
+  }
+  int n = rows_;
+  double a_norm = NormInf();
+
+  FloatLu lu;
+  lu.Compute(matrix_, n);
+  std::shared_ptr<const LuFactorization> fallback;
+  S21RefinementReport summary;
+
+  S21Matrix result(rhs.rows_, rhs.cols_);
+  std::vector<double> b(n);
+  std::vector<double> x(n);
+  std::vector<double> residual(n);
+  for (int j = 0; j < rhs.cols_; ++j) {
+    for (int i = 0; i < n; ++i) b[i] = rhs.matrix_[rhs.Index(i, j)];
+
+    int iterations = 0;
+    double backward_error = 0.0;
+    bool converged = lu.ok && RefineColumn(lu, matrix_, n, a_norm, b.data(),
+                                           x.data(), &iterations,
+                                           &backward_error);
+    if (!converged) {
+      if (!fallback) fallback = Factorize();
+      if (fallback->singular) {
+        throw std::invalid_argument("Matrix is singular, cannot solve.");
+      }
+      fallback->Solve(b.data(), x.data());
+      backward_error =
+          BackwardError(matrix_, n, a_norm, b.data(), x.data(), residual);
+      summary.used_fallback = true;
+    }
+    summary.iterations = std::max(summary.iterations, iterations);
+    summary.backward_error = std::fmax(summary.backward_error, backward_error);
+    for (int i = 0; i < n; ++i) result.matrix_[result.Index(i, j)] = x[i];
+  }
+
+  if (report) *report = summary;
+  return result;
+}
+
+/**
+ * @brief Solves A * x = b with single-precision factorization and double
+ * iterative refinement. See SolveMixed(const S21Matrix&, ...).
+ *
+ * @param rhs The right-hand side b; its size must equal the matrix order.
+ * @param report If not null, receives the refinement statistics.
+ * @return The solution x.
+ * @exception std::invalid_argument Thrown if the matrix is not square, the
+ * sizes do not match, or the matrix is singular.
+ */
+S21Vector S21Matrix::SolveMixed(const S21Vector& rhs,
+                                S21RefinementReport* report) const {
+  if (rhs.get_size() != rows_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for solving a linear system.");
+  }
+  S21Matrix column(rhs.get_size(), 1);
+  std::copy(rhs.data(), rhs.data() + rhs.get_size(), column.matrix_);
+  S21Matrix solution = SolveMixed(column, report);
+  S21Vector result(rhs.get_size());
+  std::copy(solution.matrix_, solution.matrix_ + solution.Size(),
+            result.data());
+  return result;
+}
+
+/**
+ * @brief Calculates the inverse matrix by solving A * X = I in mixed
+ * precision. See SolveMixed(const S21Matrix&, ...).
+ *
+ * @param report If not null, receives the refinement statistics.
+ * @return The inverse matrix.
+ * @exception std::invalid_argument Thrown if the matrix is not square or is
+ * singular.
+ */
+S21Matrix S21Matrix::InverseMatrixMixed(S21RefinementReport* report) const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Inverse can only be calculated for a square matrix.");
+  }
+  S21Matrix identity(rows_, cols_);
+  for (int i = 0; i < rows_; ++i) identity.matrix_[Index(i, i)] = 1.0;
+  return SolveMixed(identity, report);
+}
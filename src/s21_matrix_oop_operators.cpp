@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "s21_matrix_oop.h"
 
 /**
@@ -6,9 +8,9 @@
  * This operator is responsible for copying the contents of the other matrix
  * to the current one. The function first checks if the two matrices are the
  * same object and if so, returns the current matrix immediately. Otherwise,
- * it creates a temporary matrix with the same dimensions as the other matrix,
- * copies the values from the other matrix to the temporary matrix, and then
- * moves the temporary matrix to the current matrix.
+ * it copy-constructs a temporary matrix from the other matrix (sharing its
+ * storage if the other matrix uses copy-on-write) and then moves the
+ * temporary matrix to the current matrix.
  * @param other The matrix to copy from.
  * @return A reference to the current matrix.
  */
@@ -17,13 +19,7 @@ S21Matrix& S21Matrix::operator=(const S21Matrix& other) {
     return *this;
   }
 
-  S21Matrix temp(other.rows_, other.cols_);
-  for (int i = 0; i < other.rows_; ++i) {
-    for (int j = 0; j < other.cols_; ++j) {
-      temp.matrix_[i][j] = other.matrix_[i][j];
-    }
-  }
-
+  S21Matrix temp(other);
   *this = std::move(temp);
 
   return *this;
@@ -34,26 +30,31 @@ S21Matrix& S21Matrix::operator=(const S21Matrix& other) {
  * @details
  * This operator is responsible for moving the contents of the other matrix
  * to the current one. The function first releases the memory of the current
- * matrix, then copies the rows, columns and matrix pointer of the other matrix
- * to the current matrix and finally sets the other matrix's pointer to nullptr.
+ * matrix, then copies the rows and columns of the other matrix and takes over
+ * its storage (inline elements are copied) and its copy-on-write mode, and
+ * finally sets the other matrix's pointer to nullptr. Copy assignment goes
+ * through here, so it inherits the mode as copy construction does.
+ * Both matrices get a new version and drop their cached factorizations.
  * @param other The matrix to move from.
  * @return A reference to the current matrix.
  * @note This function is noexcept.
  */
 S21Matrix& S21Matrix::operator=(S21Matrix&& other) noexcept {
   if (this != &other) {
-    for (int i = 0; i < rows_; ++i) {
-      delete[] matrix_[i];
-    }
-    delete[] matrix_;
+    ReleaseMatrix();
 
     rows_ = other.rows_;
     cols_ = other.cols_;
-    matrix_ = other.matrix_;
+    copy_on_write_ = other.copy_on_write_;
+    StealMatrix(other);
 
     other.rows_ = 0;
     other.cols_ = 0;
-    other.matrix_ = nullptr;
+
+    version_ = std::max(version_, other.version_) + 1;
+    other.Touch();
+    lu_cache_.reset();
+    other.lu_cache_.reset();
   }
   return *this;
 }
@@ -67,12 +68,14 @@ S21Matrix& S21Matrix::operator=(S21Matrix&& other) noexcept {
  * @param col The column index of the element.
  * @return A reference to the element at the given row and column.
  * @throw std::out_of_range if the row or column index is out of range.
+ * @note Bumps the matrix version, invalidating cached results.
  */
 double& S21Matrix::operator()(int row, int col) {
   if (row >= rows_ || col >= cols_ || row < 0 || col < 0) {
     throw std::out_of_range("Index out of range.");
   }
-  return matrix_[row][col];
+  Touch();
+  return matrix_[Index(row, col)];
 }
 
 /**
@@ -91,7 +94,7 @@ const double& S21Matrix::operator()(int row, int col) const {
   if (row >= rows_ || col >= cols_ || row < 0 || col < 0) {
     throw std::out_of_range("Index out of range.");
   }
-  return matrix_[row][col];
+  return matrix_[Index(row, col)];
 }
 
 /**
@@ -177,6 +180,18 @@ S21Matrix S21Matrix::operator*(const double num) const {
   return result;
 }
 
+/**
+ * @brief Multiplies the current matrix by a column vector.
+ *
+ * This operator is a shorthand for the MulVector method.
+ *
+ * @param vec The vector to multiply the current matrix by.
+ * @return The product vector.
+ */
+S21Vector S21Matrix::operator*(const S21Vector& vec) const {
+  return MulVector(vec);
+}
+
 /**
  * @brief Subtracts the given matrix from the current matrix.
  *
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_permutation.h"
+
+/**
+ * @brief Reorders the rows in place: row i becomes the former row order[i].
+ *
+ * Follows the cycles of the permutation, moving each row once through a
+ * single row of scratch space, so the extra memory is O(rows + cols)
+ * instead of a second matrix.
+ *
+ * @param order A permutation of the row indices.
+ * @exception std::invalid_argument Thrown if the permutation size differs
+ * from the number of rows.
+ */
+void S21Matrix::PermuteRows(const S21Permutation& order) {
+  if (order.get_size() != rows_) {
+    throw std::invalid_argument(
+        "Permutation size does not match the matrix dimensions.");
+  }
+  Touch();
+  const std::vector<int>& p = order.data();
+  std::vector<bool> visited(rows_, false);
+  std::vector<double> saved(cols_);
+  for (int start = 0; start < rows_; ++start) {
+    if (visited[start] || p[start] == start) continue;
+    std::copy(matrix_ + Index(start, 0), matrix_ + Index(start, 0) + cols_,
+              saved.begin());
+    int j = start;
+    while (p[j] != start) {
+      visited[j] = true;
+      std::copy(matrix_ + Index(p[j], 0), matrix_ + Index(p[j], 0) + cols_,
+                matrix_ + Index(j, 0));
+      j = p[j];
+    }
+    visited[j] = true;
+    std::copy(saved.begin(), saved.end(), matrix_ + Index(j, 0));
+  }
+}
+
+/**
+ * @brief Reorders the columns in place: column j becomes the former column
+ * order[j].
+ *
+ * The cycles are listed once, then every row is rotated along them with
+ * one scalar of scratch space; rows are independent and split across
+ * threads. Extra memory is O(cols).
+ *
+ * @param order A permutation of the column indices.
+ * @exception std::invalid_argument Thrown if the permutation size differs
+ * from the number of columns.
+ */
+void S21Matrix::PermuteCols(const S21Permutation& order) {
+  if (order.get_size() != cols_) {
+    throw std::invalid_argument(
+        "Permutation size does not match the matrix dimensions.");
+  }
+  Touch();
+  const std::vector<int>& p = order.data();
+  // Non-trivial cycles, stored back to back; cycle c is
+  // cycles[starts[c]] .. cycles[starts[c + 1] - 1].
+  std::vector<int> cycles;
+  std::vector<int> starts;
+  std::vector<bool> visited(cols_, false);
+  for (int start = 0; start < cols_; ++start) {
+    if (visited[start] || p[start] == start) continue;
+    starts.push_back(static_cast<int>(cycles.size()));
+    for (int j = start; !visited[j]; j = p[j]) {
+      visited[j] = true;
+      cycles.push_back(j);
+    }
+  }
+  starts.push_back(static_cast<int>(cycles.size()));
+  if (cycles.empty()) return;
+
+  double* data = matrix_;
+  int cols = cols_;
+  int cycle_count = static_cast<int>(starts.size()) - 1;
+  ForEachRange(true, [&](std::size_t first, std::size_t last) {
+    for (std::size_t offset = first; offset < last; offset += cols) {
+      double* row = data + offset;
+      for (int c = 0; c < cycle_count; ++c) {
+        const int* cycle = cycles.data() + starts[c];
+        int length = starts[c + 1] - starts[c];
+        double saved = row[cycle[0]];
+        for (int t = 0; t + 1 < length; ++t) row[cycle[t]] = row[cycle[t + 1]];
+        row[cycle[length - 1]] = saved;
+      }
+    }
+  });
+}
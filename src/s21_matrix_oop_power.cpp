@@ -0,0 +1,105 @@
+#include <cfloat>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "s21_eigen.h"
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Raises a square matrix to an integer power.
+ *
+ * Uses binary exponentiation: O(log |power|) products instead of |power|.
+ * The three working matrices (result, running square and a scratch buffer)
+ * are allocated once up front; inside the loop products are written into the
+ * scratch buffer and the buffers are swapped, so no memory is allocated per
+ * step. A negative power inverts the matrix once and raises the inverse.
+ *
+ * @param power The exponent; 0 yields the identity matrix.
+ * @return The matrix raised to the given power.
+ * @exception std::invalid_argument Thrown if the matrix is not square, or if
+ * the power is negative and the matrix is singular.
+ */
+S21Matrix S21Matrix::Pow(int power) const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Power can only be calculated for a square matrix.");
+  }
+
+  long long exponent = power;
+  S21Matrix base = exponent < 0 ? InverseMatrix() : *this;
+  if (exponent < 0) exponent = -exponent;
+
+  S21Matrix result(rows_, cols_);
+  for (int i = 0; i < rows_; ++i) result.matrix_[result.Index(i, i)] = 1.0;
+  S21Matrix scratch(rows_, cols_);
+
+  while (exponent > 0) {
+    if (exponent & 1) {
+      MultiplyInto(result, base, scratch);
+      std::swap(result, scratch);
+    }
+    exponent >>= 1;
+    if (exponent > 0) {
+      MultiplyInto(base, base, scratch);
+      std::swap(base, scratch);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Raises a symmetric matrix to an integer power through its
+ * eigendecomposition.
+ *
+ * A = V * diag(l) * V^T, hence A^k = V * diag(l^k) * V^T. The cost does not
+ * depend on the exponent, which makes this the faster choice for very large
+ * powers. The eigenvectors come from S21Eigen::Symmetric (Householder
+ * tridiagonalization and implicit QL). The result is accurate to the
+ * precision of the eigendecomposition, so Pow() should be preferred when
+ * exact integer results are expected.
+ *
+ * For negative powers the matrix counts as singular when an eigenvalue is
+ * not larger than n * eps * max|l|, so 1e-8 * I can still be inverted.
+ *
+ * @param power The exponent.
+ * @return The matrix raised to the given power.
+ * @exception std::invalid_argument Thrown if the matrix is not symmetric, or
+ * if the power is negative and the matrix is singular.
+ */
+S21Matrix S21Matrix::PowSymmetric(int power) const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Power can only be calculated for a square matrix.");
+  }
+  int n = rows_;
+  S21EigenDecomposition eigen = S21Eigen::Symmetric(*this);
+  const double* vectors = std::as_const(eigen.vectors).data();
+
+  double largest = 0.0;
+  for (int m = 0; m < n; ++m) {
+    largest = std::fmax(largest, std::fabs(eigen.values(m)));
+  }
+  std::vector<double> scaled(n);
+  for (int m = 0; m < n; ++m) {
+    double value = eigen.values(m);
+    if (power < 0 && !(std::fabs(value) > n * DBL_EPSILON * largest)) {
+      throw std::invalid_argument(
+          "Matrix is singular (determinant is zero), cannot find inverse.");
+    }
+    scaled[m] = std::pow(value, power);
+  }
+
+  S21Matrix result(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = i; j < n; ++j) {
+      double sum = 0.0;
+      for (int m = 0; m < n; ++m) {
+        sum += vectors[i * n + m] * scaled[m] * vectors[j * n + m];
+      }
+      result.matrix_[result.Index(i, j)] = sum;
+      result.matrix_[result.Index(j, i)] = sum;
+    }
+  }
+  return result;
+}
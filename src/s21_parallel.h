@@ -0,0 +1,171 @@
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Internal helpers shared by the library kernels. Not part of the public API.
+namespace s21_internal {
+
+/**
+ * @brief Per-thread cap on the threads a kernel called from this thread may
+ * use; 0 means no cap.
+ *
+ * Set by callers that already run one kernel per core, such as the workers
+ * of S21ProcessPool. A forked process inherits the value of the forking
+ * thread.
+ */
+inline int& ThreadLimit() {
+  thread_local int limit = 0;
+  return limit;
+}
+
+/**
+ * @brief Sets ThreadLimit() for the lifetime of the object and restores the
+ * previous value on destruction, also when an exception propagates.
+ */
+class ScopedThreadLimit {
+ public:
+  explicit ScopedThreadLimit(int limit) : saved_(ThreadLimit()) {
+    ThreadLimit() = limit;
+  }
+  ~ScopedThreadLimit() { ThreadLimit() = saved_; }
+  ScopedThreadLimit(const ScopedThreadLimit&) = delete;
+  ScopedThreadLimit& operator=(const ScopedThreadLimit&) = delete;
+
+ private:
+  int saved_;
+};
+
+/**
+ * @brief Returns the number of worker threads the kernels may use.
+ *
+ * Falls back to a single thread when the hardware concurrency cannot be
+ * determined, and never exceeds ThreadLimit().
+ */
+inline int HardwareThreads() {
+  unsigned int n = std::thread::hardware_concurrency();
+  int threads = n == 0 ? 1 : static_cast<int>(n);
+  return ThreadLimit() > 0 ? std::min(threads, ThreadLimit()) : threads;
+}
+
+// Multiply-adds per thread below which a product stays on one thread.
+inline constexpr long long kGemmParallelWork = 1LL << 20;
+
+/**
+ * @brief Minimal number of rows of a product with n columns and inner
+ * dimension k worth handing to a thread, as min_chunk of ParallelFor.
+ */
+inline int GemmMinRows(int n, int k) {
+  long long row_work = static_cast<long long>(n) * k;
+  return static_cast<int>(
+      std::max(1LL, kGemmParallelWork / std::max(row_work, 1LL)));
+}
+
+/**
+ * @brief Splits the range [begin, end) into contiguous chunks and runs
+ * fn(lo, hi) for each chunk, one chunk per thread.
+ *
+ * Ranges shorter than two chunks of min_chunk items are run inline on the
+ * calling thread, so small workloads never pay the thread start-up cost. The
+ * calling thread always processes the first chunk itself. fn must not throw.
+ *
+ * @param begin First index of the range.
+ * @param end One past the last index of the range.
+ * @param min_chunk Minimal number of items worth handing to a thread.
+ * @param fn Callable invoked as fn(int lo, int hi).
+ */
+template <typename Fn>
+void ParallelFor(int begin, int end, int min_chunk, Fn&& fn) {
+  int total = end - begin;
+  if (total <= 0) return;
+  int chunks = std::min(HardwareThreads(), total / std::max(min_chunk, 1));
+  if (chunks < 2) {
+    fn(begin, end);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(chunks - 1);
+  int step = total / chunks;
+  int rest = total % chunks;
+  int lo = begin + step + (rest > 0 ? 1 : 0);
+  for (int c = 1; c < chunks; ++c) {
+    int hi = lo + step + (c < rest ? 1 : 0);
+    workers.emplace_back([&fn, lo, hi]() { fn(lo, hi); });
+    lo = hi;
+  }
+  fn(begin, begin + step + (rest > 0 ? 1 : 0));
+  for (auto& worker : workers) worker.join();
+}
+
+/**
+ * @brief ParallelFor for callables that may throw.
+ *
+ * The first exception thrown by any chunk is rethrown on the calling thread
+ * after all chunks have finished; the remaining chunks still run.
+ */
+template <typename Fn>
+void ParallelForRethrow(int begin, int end, int min_chunk, Fn&& fn) {
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  ParallelFor(begin, end, min_chunk, [&](int lo, int hi) {
+    try {
+      fn(lo, hi);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) error = std::current_exception();
+    }
+  });
+  if (error) std::rethrow_exception(error);
+}
+
+/**
+ * @brief Reduces [0, count) split into fixed blocks of block items.
+ *
+ * block_fn(lo, hi) reduces one non-empty block; the block results are
+ * combined pairwise in a fixed tree. The partition depends only on count and
+ * block, so the result is the same for any number of threads, and the
+ * rounding error of a sum grows with log(count / block) rather than count.
+ *
+ * @param count Number of items, at least 1.
+ * @param block Items per block.
+ * @param min_blocks Blocks worth handing to a thread; 0 keeps the reduction
+ * on the calling thread.
+ * @param block_fn Callable invoked as block_fn(size_t lo, size_t hi) -> T.
+ * @param combine Associative callable invoked as combine(T, T) -> T.
+ */
+template <typename T, typename BlockFn, typename Combine>
+T BlockedReduce(std::size_t count, std::size_t block, int min_blocks,
+                BlockFn&& block_fn, Combine&& combine) {
+  int blocks = static_cast<int>((count + block - 1) / block);
+  if (blocks == 1) return block_fn(std::size_t{0}, count);
+  std::vector<T> partial(blocks);
+  auto run = [&](int lo, int hi) {
+    for (int b = lo; b < hi; ++b) {
+      std::size_t first = static_cast<std::size_t>(b) * block;
+      partial[b] = block_fn(first, std::min(first + block, count));
+    }
+  };
+  if (min_blocks > 0) {
+    ParallelForRethrow(0, blocks, min_blocks, run);
+  } else {
+    run(0, blocks);
+  }
+  for (int width = 1; width < blocks; width *= 2) {
+    for (int b = 0; b + width < blocks; b += 2 * width) {
+      partial[b] =
+          combine(std::move(partial[b]), std::move(partial[b + width]));
+    }
+  }
+  return std::move(partial[0]);
+}
+
+}  // namespace s21_internal
+
+#endif  // S21_PARALLEL_H
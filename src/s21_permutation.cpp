@@ -0,0 +1,364 @@
+#include "s21_permutation.h"
+
+#include <algorithm>
+#include <string>
+
+#include "s21_kernels.h"
+#include "s21_parallel.h"
+
+// --- S21Permutation ---
+
+/**
+ * @brief Creates the identity permutation.
+ *
+ * @exception std::invalid_argument Thrown if size is less than 1.
+ */
+S21Permutation::S21Permutation(int size) {
+  if (size < 1) {
+    throw std::invalid_argument("Incorrect permutation size");
+  }
+  order_.resize(size);
+  for (int i = 0; i < size; ++i) order_[i] = i;
+}
+
+/**
+ * @brief Creates a permutation from its gather order.
+ *
+ * @param order order[i] is the source index placed at position i.
+ * @exception std::invalid_argument Thrown if order is empty or is not a
+ * permutation of [0, n).
+ */
+S21Permutation::S21Permutation(std::vector<int> order)
+    : order_(std::move(order)) {
+  if (order_.empty()) {
+    throw std::invalid_argument("Incorrect permutation size");
+  }
+  std::vector<bool> seen(order_.size(), false);
+  for (int index : order_) {
+    if (index < 0 || index >= get_size() || seen[index]) {
+      throw std::invalid_argument("Order is not a permutation.");
+    }
+    seen[index] = true;
+  }
+}
+
+int S21Permutation::get_size() const { return static_cast<int>(order_.size()); }
+
+/**
+ * @brief Source index placed at a position.
+ *
+ * @exception std::out_of_range Thrown if the position is out of range.
+ */
+int S21Permutation::operator[](int position) const {
+  if (position < 0 || position >= get_size()) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return order_[position];
+}
+
+const std::vector<int>& S21Permutation::data() const { return order_; }
+
+/**
+ * @brief Composition matching the product of permutation matrices: applying
+ * p * q applies q first, then p.
+ *
+ * @exception std::invalid_argument Thrown if the sizes differ.
+ */
+S21Permutation S21Permutation::operator*(const S21Permutation& other) const {
+  if (get_size() != other.get_size()) {
+    throw std::invalid_argument("Permutations have different sizes.");
+  }
+  S21Permutation result(get_size());
+  for (int i = 0; i < get_size(); ++i) {
+    result.order_[i] = other.order_[order_[i]];
+  }
+  return result;
+}
+
+bool S21Permutation::operator==(const S21Permutation& other) const {
+  return order_ == other.order_;
+}
+
+/**
+ * @brief The permutation that undoes this one.
+ */
+S21Permutation S21Permutation::Inverse() const {
+  S21Permutation result(get_size());
+  for (int i = 0; i < get_size(); ++i) result.order_[order_[i]] = i;
+  return result;
+}
+
+/**
+ * @brief Exchanges the entries at two positions, as a pivoting step does.
+ *
+ * @exception std::out_of_range Thrown if a position is out of range.
+ */
+void S21Permutation::Swap(int i, int j) {
+  if (i < 0 || j < 0 || i >= get_size() || j >= get_size()) {
+    throw std::out_of_range("Index out of range.");
+  }
+  std::swap(order_[i], order_[j]);
+}
+
+/**
+ * @brief +1 for an even permutation, -1 for an odd one, from the number of
+ * cycles.
+ */
+int S21Permutation::Sign() const {
+  std::vector<bool> visited(order_.size(), false);
+  int transpositions = 0;
+  for (int start = 0; start < get_size(); ++start) {
+    for (int j = start; !visited[j]; j = order_[j]) {
+      visited[j] = true;
+      if (order_[j] != start) ++transpositions;
+    }
+  }
+  return transpositions % 2 == 0 ? 1 : -1;
+}
+
+// --- S21GatherView ---
+
+/**
+ * @brief View of the whole matrix.
+ */
+S21GatherView::S21GatherView(const S21Matrix& source) : source_(&source) {}
+
+/**
+ * @brief View of the rows and columns picked by two index lists.
+ *
+ * @param rows Source row of every view row; empty selects all rows.
+ * @param cols Source column of every view column; empty selects all.
+ * @exception std::out_of_range Thrown if an index is outside the source.
+ */
+S21GatherView::S21GatherView(const S21Matrix& source, std::vector<int> rows,
+                             std::vector<int> cols)
+    : source_(&source), rows_(std::move(rows)), cols_(std::move(cols)) {
+  CheckIndices(rows_, source.get_rows());
+  CheckIndices(cols_, source.get_cols());
+}
+
+/**
+ * @brief View with permuted rows and columns.
+ *
+ * @exception std::invalid_argument Thrown if a permutation does not match
+ * the source dimension it applies to.
+ */
+S21GatherView::S21GatherView(const S21Matrix& source,
+                             const S21Permutation& rows,
+                             const S21Permutation& cols)
+    : source_(&source) {
+  if (rows.get_size() != source.get_rows() ||
+      cols.get_size() != source.get_cols()) {
+    throw std::invalid_argument(
+        "Permutation size does not match the matrix dimensions.");
+  }
+  rows_ = rows.data();
+  cols_ = cols.data();
+}
+
+int S21GatherView::get_rows() const {
+  return rows_.empty() ? source_->get_rows() : static_cast<int>(rows_.size());
+}
+
+int S21GatherView::get_cols() const {
+  return cols_.empty() ? source_->get_cols() : static_cast<int>(cols_.size());
+}
+
+/**
+ * @brief Whether the columns are picked by an index list; if not, every
+ * view row is a contiguous source row.
+ */
+bool S21GatherView::get_gathers_cols() const { return !cols_.empty(); }
+
+/**
+ * @exception std::out_of_range Thrown if the index is out of range.
+ */
+double S21GatherView::operator()(int row, int col) const {
+  return SourceRow(row)[SourceCol(col)];
+}
+
+/**
+ * @brief Start of the source row behind a view row.
+ *
+ * @exception std::out_of_range Thrown if the row is out of range.
+ */
+const double* S21GatherView::SourceRow(int row) const {
+  if (row < 0 || row >= get_rows()) {
+    throw std::out_of_range("Index out of range.");
+  }
+  int source_row = rows_.empty() ? row : rows_[row];
+  return source_->data() +
+         static_cast<std::size_t>(source_row) * source_->get_cols();
+}
+
+/**
+ * @brief Source column behind a view column.
+ *
+ * @exception std::out_of_range Thrown if the column is out of range.
+ */
+int S21GatherView::SourceCol(int col) const {
+  if (col < 0 || col >= get_cols()) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return cols_.empty() ? col : cols_[col];
+}
+
+/**
+ * @brief Copies the selected elements into a new matrix.
+ */
+S21Matrix S21GatherView::ToMatrix() const {
+  S21Matrix result(get_rows(), get_cols());
+  for (int i = 0; i < get_rows(); ++i) {
+    const double* in = SourceRow(i);
+    double* out = result.data() + static_cast<std::size_t>(i) * get_cols();
+    if (cols_.empty()) {
+      std::copy(in, in + get_cols(), out);
+    } else {
+      for (int j = 0; j < get_cols(); ++j) out[j] = in[cols_[j]];
+    }
+  }
+  return result;
+}
+
+void S21GatherView::CheckIndices(const std::vector<int>& indices, int limit) {
+  for (int index : indices) {
+    if (index < 0 || index >= limit) {
+      throw std::out_of_range("Index out of range.");
+    }
+  }
+}
+
+// --- S21GatherOps ---
+
+/**
+ * @brief Product of two views.
+ *
+ * Each row of the result is built from axpy updates over source rows of
+ * rhs; a row of lhs with gathered columns is first collected into a
+ * buffer of k values. Rows of the result are split across threads.
+ *
+ * @exception std::invalid_argument Thrown if the dimensions do not match.
+ */
+S21Matrix S21GatherOps::Multiply(const S21GatherView& lhs,
+                                 const S21GatherView& rhs) {
+  int m = lhs.get_rows();
+  int k = lhs.get_cols();
+  int n = rhs.get_cols();
+  if (rhs.get_rows() != k) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  S21Matrix result(m, n);
+  double* out = result.data();
+  const int* b_cols = rhs.cols_.empty() ? nullptr : rhs.cols_.data();
+  int min_rows = s21_internal::GemmMinRows(n, k);
+  s21_internal::ParallelFor(0, m, min_rows, [&](int lo, int hi) {
+    std::vector<double> gathered(lhs.cols_.empty() ? 0 : k);
+    for (int i = lo; i < hi; ++i) {
+      const double* a_row = lhs.SourceRow(i);
+      if (!lhs.cols_.empty()) {
+        for (int p = 0; p < k; ++p) gathered[p] = a_row[lhs.cols_[p]];
+        a_row = gathered.data();
+      }
+      double* c_row = out + static_cast<std::size_t>(i) * n;
+      for (int p = 0; p < k; ++p) {
+        const double* b_row = rhs.SourceRow(p);
+        if (!b_cols) {
+          s21_internal::AxpyKernel(a_row[p], b_row, c_row, n);
+        } else {
+          for (int j = 0; j < n; ++j) c_row[j] += a_row[p] * b_row[b_cols[j]];
+        }
+      }
+    }
+  });
+  return result;
+}
+
+/**
+ * @brief Product of a view and a vector.
+ *
+ * @exception std::invalid_argument Thrown if the sizes do not match.
+ */
+S21Vector S21GatherOps::MulVector(const S21GatherView& lhs,
+                                  const S21Vector& vec) {
+  int k = lhs.get_cols();
+  if (vec.get_size() != k) {
+    throw std::invalid_argument(
+        "Matrix and vector dimensions are not suitable for multiplication.");
+  }
+  S21Vector result(lhs.get_rows());
+  for (int i = 0; i < lhs.get_rows(); ++i) {
+    const double* row = lhs.SourceRow(i);
+    if (lhs.cols_.empty()) {
+      result(i) = s21_internal::DotKernel(row, vec.data(), k);
+    } else {
+      double sum = 0.0;
+      for (int p = 0; p < k; ++p) sum += row[lhs.cols_[p]] * vec(p);
+      result(i) = sum;
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Elementwise sum of two views.
+ *
+ * @exception std::invalid_argument Thrown if the dimensions differ.
+ */
+S21Matrix S21GatherOps::Add(const S21GatherView& lhs,
+                            const S21GatherView& rhs) {
+  return Zip(lhs, rhs, [](double x, double y) { return x + y; }, "Add");
+}
+
+/**
+ * @brief Elementwise difference of two views.
+ *
+ * @exception std::invalid_argument Thrown if the dimensions differ.
+ */
+S21Matrix S21GatherOps::Sub(const S21GatherView& lhs,
+                            const S21GatherView& rhs) {
+  return Zip(lhs, rhs, [](double x, double y) { return x - y; }, "Sub");
+}
+
+/**
+ * @brief Elementwise product of two views.
+ *
+ * @exception std::invalid_argument Thrown if the dimensions differ.
+ */
+S21Matrix S21GatherOps::HadamardMul(const S21GatherView& lhs,
+                                    const S21GatherView& rhs) {
+  return Zip(lhs, rhs, [](double x, double y) { return x * y; },
+             "HadamardMul");
+}
+
+/**
+ * @brief Applies op row by row; rows without gathered columns are read
+ * contiguously.
+ */
+template <typename Op>
+S21Matrix S21GatherOps::Zip(const S21GatherView& lhs,
+                            const S21GatherView& rhs, Op op,
+                            const char* name) {
+  int m = lhs.get_rows();
+  int n = lhs.get_cols();
+  if (rhs.get_rows() != m || rhs.get_cols() != n) {
+    throw std::invalid_argument(
+        std::string("Matrices have different dimensions for ") + name + ".");
+  }
+  S21Matrix result(m, n);
+  const int* x_cols = lhs.cols_.empty() ? nullptr : lhs.cols_.data();
+  const int* y_cols = rhs.cols_.empty() ? nullptr : rhs.cols_.data();
+  for (int i = 0; i < m; ++i) {
+    const double* x = lhs.SourceRow(i);
+    const double* y = rhs.SourceRow(i);
+    double* out = result.data() + static_cast<std::size_t>(i) * n;
+    if (!x_cols && !y_cols) {
+      for (int j = 0; j < n; ++j) out[j] = op(x[j], y[j]);
+    } else {
+      for (int j = 0; j < n; ++j) {
+        out[j] = op(x[x_cols ? x_cols[j] : j], y[y_cols ? y_cols[j] : j]);
+      }
+    }
+  }
+  return result;
+}
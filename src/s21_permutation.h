@@ -0,0 +1,124 @@
+#ifndef S21_PERMUTATION_H
+#define S21_PERMUTATION_H
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Permutation of [0, n) in gather form.
+ *
+ * Position i takes the element at index (*this)[i] of the source: applying
+ * the permutation to rows moves source row (*this)[i] to row i. The same
+ * convention is used by S21GatherView and S21Matrix::PermuteRows.
+ */
+class S21Permutation {
+ private:
+  std::vector<int> order_;
+
+ public:
+  // -- Constructors --
+
+  explicit S21Permutation(int size);
+  explicit S21Permutation(std::vector<int> order);
+
+  // --- Getters ---
+
+  int get_size() const;
+
+  // --- Accessors ---
+
+  int operator[](int position) const;
+  const std::vector<int>& data() const;
+
+  // --- Overload operators ---
+
+  S21Permutation operator*(const S21Permutation& other) const;
+  bool operator==(const S21Permutation& other) const;
+
+  // --- Public methods ---
+
+  S21Permutation Inverse() const;
+  void Swap(int i, int j);
+  int Sign() const;
+};
+
+/**
+ * @brief Read-only view of selected rows and columns of an S21Matrix.
+ *
+ * Element (i, j) of the view is source(rows[i], cols[j]). Indices may
+ * repeat or skip source rows and columns; an empty index list selects all
+ * of them in order. Nothing is copied: S21GatherOps reads the source
+ * through the index lists, and when the columns are not gathered whole
+ * source rows are handed to the contiguous kernels. The source must outlive
+ * the view and must not change while it is in use, so temporaries are
+ * rejected at compile time. An S21Matrix lvalue converts implicitly to a
+ * view of itself.
+ *
+ * Usage: S21GatherView shuffled(m, {2, 0, 1}, {});
+ *        S21Matrix r = S21GatherOps::Multiply(shuffled, w);
+ */
+class S21GatherView {
+ private:
+  friend class S21GatherOps;
+
+  const S21Matrix* source_;
+  std::vector<int> rows_;
+  std::vector<int> cols_;
+
+  static void CheckIndices(const std::vector<int>& indices, int limit);
+
+ public:
+  // -- Constructors --
+
+  S21GatherView(const S21Matrix& source);
+  S21GatherView(const S21Matrix& source, std::vector<int> rows,
+                std::vector<int> cols);
+  S21GatherView(const S21Matrix& source, const S21Permutation& rows,
+                const S21Permutation& cols);
+  S21GatherView(const S21Matrix&& source) = delete;
+  S21GatherView(const S21Matrix&& source, std::vector<int> rows,
+                std::vector<int> cols) = delete;
+  S21GatherView(const S21Matrix&& source, const S21Permutation& rows,
+                const S21Permutation& cols) = delete;
+
+  // --- Getters ---
+
+  int get_rows() const;
+  int get_cols() const;
+  bool get_gathers_cols() const;
+
+  // --- Accessors ---
+
+  double operator()(int row, int col) const;
+  const double* SourceRow(int row) const;
+  int SourceCol(int col) const;
+
+  // --- Public methods ---
+
+  S21Matrix ToMatrix() const;
+};
+
+/**
+ * @brief Arithmetic on gather views without materializing them.
+ *
+ * Every operand may be an S21Matrix or an S21GatherView; the results are
+ * new matrices.
+ */
+class S21GatherOps {
+ private:
+  template <typename Op>
+  static S21Matrix Zip(const S21GatherView& lhs, const S21GatherView& rhs,
+                       Op op, const char* name);
+
+ public:
+  static S21Matrix Multiply(const S21GatherView& lhs,
+                            const S21GatherView& rhs);
+  static S21Vector MulVector(const S21GatherView& lhs, const S21Vector& vec);
+  static S21Matrix Add(const S21GatherView& lhs, const S21GatherView& rhs);
+  static S21Matrix Sub(const S21GatherView& lhs, const S21GatherView& rhs);
+  static S21Matrix HadamardMul(const S21GatherView& lhs,
+                               const S21GatherView& rhs);
+};
+
+#endif  // S21_PERMUTATION_H
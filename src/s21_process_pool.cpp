@@ -0,0 +1,532 @@
+#include "s21_process_pool.h"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <new>
+
+#include "s21_layout.h"
+#include "s21_parallel.h"
+
+namespace {
+// Longest segment name, including the terminating zero.
+constexpr std::size_t kNameSize = 64;
+// Result tile claimed by one participant at a time. Consecutive tiles walk
+// down the rows, so a participant keeps reusing the same columns of the
+// right operand.
+constexpr int kTileRows = 64;
+constexpr int kTileCols = 256;
+// Largest pool; each worker has a slot in the control block.
+constexpr int kMaxWorkers = 256;
+// How often a waiting pool checks whether its workers are still alive.
+constexpr long kPollNanoseconds = 100'000'000;
+// The destructor checks every 10 ms, for about a second, whether the
+// workers have exited before it kills the rest.
+constexpr int kStopPolls = 100;
+constexpr long kStopPollNanoseconds = 10'000'000;
+
+std::atomic<unsigned> segment_counter{0};
+
+std::string SegmentName() {
+  return "/s21_matrix_" + std::to_string(getpid()) + "_" +
+         std::to_string(segment_counter.fetch_add(1));
+}
+
+std::size_t SegmentBytes(int rows, int cols) {
+  return static_cast<std::size_t>(rows) * cols * sizeof(double);
+}
+
+/**
+ * @brief Maps an existing segment; nullptr if it cannot be opened.
+ */
+double* MapSegment(const char* name, std::size_t bytes, bool writable) {
+  int fd = shm_open(name, writable ? O_RDWR : O_RDONLY, 0);
+  if (fd < 0) return nullptr;
+  void* memory = mmap(nullptr, bytes, PROT_READ | (writable ? PROT_WRITE : 0),
+                      MAP_SHARED, fd, 0);
+  close(fd);
+  return memory == MAP_FAILED ? nullptr : static_cast<double*>(memory);
+}
+
+void UnmapSegment(const double* data, std::size_t bytes) {
+  if (data) munmap(const_cast<double*>(data), bytes);
+}
+
+/**
+ * @brief Locks a robust mutex; if its owner died holding it, takes it over.
+ */
+void Lock(pthread_mutex_t* mutex) {
+  if (pthread_mutex_lock(mutex) == EOWNERDEAD) {
+    pthread_mutex_consistent(mutex);
+  }
+}
+
+static_assert(sizeof(std::atomic<int>) == sizeof(int) &&
+                  std::atomic<int>::is_always_lock_free,
+              "The change counter doubles as a futex word.");
+
+/**
+ * @brief Unlocks mutex, sleeps until changes moves on from the value it had
+ * under the lock or kPollNanoseconds pass, and locks mutex again.
+ *
+ * A futex instead of a process-shared condition variable: a process killed
+ * while waiting on a glibc condition variable can block later broadcasts
+ * forever.
+ */
+void WaitForChange(std::atomic<int>* changes, pthread_mutex_t* mutex) {
+  int observed = changes->load();
+  pthread_mutex_unlock(mutex);
+  timespec timeout{0, kPollNanoseconds};
+  syscall(SYS_futex, reinterpret_cast<int*>(changes), FUTEX_WAIT, observed,
+          &timeout, nullptr, 0);
+  Lock(mutex);
+}
+
+/**
+ * @brief Announces a change of the shared state and wakes every waiter.
+ */
+void NotifyChange(std::atomic<int>* changes) {
+  changes->fetch_add(1);
+  syscall(SYS_futex, reinterpret_cast<int*>(changes), FUTEX_WAKE, INT_MAX,
+          nullptr, nullptr, 0);
+}
+}  // namespace
+
+// --- S21SharedMatrix ---
+
+/**
+ * @brief Creates a zero matrix in a new shared memory segment.
+ *
+ * @exception std::invalid_argument Thrown if a dimension is less than 1.
+ * @exception std::runtime_error Thrown if the segment cannot be created.
+ */
+S21SharedMatrix::S21SharedMatrix(int rows, int cols)
+    : rows_(rows), cols_(cols), data_(nullptr) {
+  if (rows < 1 || cols < 1) {
+    throw std::invalid_argument("Incorrect matrix dimensions");
+  }
+  name_ = SegmentName();
+  int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot create shared memory segment " + name_);
+  }
+  void* memory = MAP_FAILED;
+  if (ftruncate(fd, static_cast<off_t>(SegmentBytes(rows, cols))) == 0) {
+    memory = mmap(nullptr, SegmentBytes(rows, cols), PROT_READ | PROT_WRITE,
+                  MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if (memory == MAP_FAILED) {
+    shm_unlink(name_.c_str());
+    throw std::runtime_error("Cannot map shared memory segment " + name_);
+  }
+  data_ = static_cast<double*>(memory);
+}
+
+/**
+ * @brief Copies a matrix into a new shared memory segment.
+ *
+ * @exception std::runtime_error Thrown if the segment cannot be created.
+ */
+S21SharedMatrix::S21SharedMatrix(const S21Matrix& source)
+    : S21SharedMatrix(source.get_rows(), source.get_cols()) {
+  std::copy(source.cbegin(), source.cend(), data_);
+}
+
+S21SharedMatrix::S21SharedMatrix(S21SharedMatrix&& other) noexcept
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      name_(std::move(other.name_)),
+      data_(other.data_) {
+  other.data_ = nullptr;
+}
+
+S21SharedMatrix& S21SharedMatrix::operator=(S21SharedMatrix&& other) noexcept {
+  if (this != &other) {
+    Release();
+    rows_ = other.rows_;
+    cols_ = other.cols_;
+    name_ = std::move(other.name_);
+    data_ = other.data_;
+    other.data_ = nullptr;
+  }
+  return *this;
+}
+
+/**
+ * @brief Unmaps and unlinks the segment; mappings held by other processes
+ * stay valid until they unmap it.
+ */
+S21SharedMatrix::~S21SharedMatrix() { Release(); }
+
+int S21SharedMatrix::get_rows() const { return rows_; }
+
+int S21SharedMatrix::get_cols() const { return cols_; }
+
+/**
+ * @brief Name of the segment, for shm_open in another process.
+ */
+const std::string& S21SharedMatrix::get_name() const { return name_; }
+
+/**
+ * @exception std::out_of_range Thrown if the index is out of range.
+ */
+double& S21SharedMatrix::operator()(int row, int col) {
+  if (row < 0 || row >= rows_ || col < 0 || col >= cols_) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return data_[static_cast<std::size_t>(row) * cols_ + col];
+}
+
+/**
+ * @exception std::out_of_range Thrown if the index is out of range.
+ */
+double S21SharedMatrix::operator()(int row, int col) const {
+  return const_cast<S21SharedMatrix&>(*this)(row, col);
+}
+
+double* S21SharedMatrix::data() { return data_; }
+
+const double* S21SharedMatrix::data() const { return data_; }
+
+/**
+ * @brief Copies the matrix out of shared memory.
+ */
+S21Matrix S21SharedMatrix::ToMatrix() const {
+  S21Matrix result(rows_, cols_);
+  std::copy(data_, data_ + static_cast<std::size_t>(rows_) * cols_,
+            result.data());
+  return result;
+}
+
+void S21SharedMatrix::Release() {
+  if (!data_) return;
+  munmap(data_, SegmentBytes(rows_, cols_));
+  shm_unlink(name_.c_str());
+  data_ = nullptr;
+}
+
+// --- S21ProcessPool ---
+
+/**
+ * @brief Job board shared by the pool and its workers.
+ *
+ * Lives in an anonymous shared mapping created before the workers are
+ * forked. Lock-free atomics are address-free, so next_tile and computed
+ * work across processes; the robust process-shared mutex guards every
+ * other field, and changes is bumped whenever one of them changes so that
+ * waiters can sleep on it. Publishing a job bumps generation and opens it;
+ * a worker joins only while the job is open and marks its slot busy until
+ * it is done, so the pool waits for the workers that took part and no
+ * others.
+ */
+struct S21ProcessPool::Control {
+  pthread_mutex_t mutex;
+  std::atomic<int> changes{0};
+  char lhs[kNameSize];
+  char rhs[kNameSize];
+  char result[kNameSize];
+  int m = 0;
+  int n = 0;
+  int k = 0;
+  std::atomic<int> next_tile{0};
+  std::atomic<int> computed{0};
+  unsigned long generation = 0;
+  bool open = false;
+  bool stopping = false;
+  int active = 0;
+  bool busy[kMaxWorkers] = {};
+};
+
+/**
+ * @brief Forks the worker processes.
+ *
+ * @param workers Number of processes besides the caller; 0 computes in the
+ * calling process only.
+ * @exception std::invalid_argument Thrown if workers is negative or more
+ * than 256.
+ * @exception std::runtime_error Thrown if the shared control block cannot
+ * be mapped or a worker cannot be forked.
+ */
+S21ProcessPool::S21ProcessPool(int workers) : control_(nullptr) {
+  if (workers < 0 || workers > kMaxWorkers) {
+    throw std::invalid_argument("Number of workers must be in [0, 256].");
+  }
+  void* memory = mmap(nullptr, sizeof(Control), PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED) {
+    throw std::runtime_error("Cannot map the process pool control block.");
+  }
+  control_ = new (memory) Control();
+  pthread_mutexattr_t mutex_attributes;
+  pthread_mutexattr_init(&mutex_attributes);
+  pthread_mutexattr_setpshared(&mutex_attributes, PTHREAD_PROCESS_SHARED);
+  pthread_mutexattr_setrobust(&mutex_attributes, PTHREAD_MUTEX_ROBUST);
+  pthread_mutex_init(&control_->mutex, &mutex_attributes);
+  pthread_mutexattr_destroy(&mutex_attributes);
+
+  pid_t parent = getpid();
+  workers_.reserve(workers);
+  for (int i = 0; i < workers; ++i) {
+    pid_t pid = fork();
+    if (pid == 0) WorkerLoop(i, parent);
+    if (pid < 0) {
+      for (pid_t worker : workers_) kill(worker, SIGKILL);
+      for (pid_t worker : workers_) waitpid(worker, nullptr, 0);
+      workers_.clear();
+      ReleaseControl();
+      throw std::runtime_error("Cannot fork a worker process.");
+    }
+    workers_.push_back(pid);
+  }
+}
+
+/**
+ * @brief Stops and reaps the workers; one that has not exited after about
+ * a second, for example a stopped one, is killed.
+ */
+S21ProcessPool::~S21ProcessPool() {
+  Lock(&control_->mutex);
+  control_->stopping = true;
+  NotifyChange(&control_->changes);
+  ReapWorkers();
+  pthread_mutex_unlock(&control_->mutex);
+  for (int poll = 0; poll < kStopPolls && get_workers() > 0; ++poll) {
+    timespec pause{0, kStopPollNanoseconds};
+    nanosleep(&pause, nullptr);
+    Lock(&control_->mutex);
+    ReapWorkers();
+    pthread_mutex_unlock(&control_->mutex);
+  }
+  for (pid_t& worker : workers_) {
+    if (worker <= 0) continue;
+    kill(worker, SIGKILL);
+    waitpid(worker, nullptr, 0);
+    worker = 0;
+  }
+  ReleaseControl();
+}
+
+/**
+ * @brief Number of live worker processes, not counting the caller.
+ */
+int S21ProcessPool::get_workers() const {
+  return static_cast<int>(get_pids().size());
+}
+
+/**
+ * @brief Process ids of the live workers.
+ */
+std::vector<pid_t> S21ProcessPool::get_pids() const {
+  std::vector<pid_t> pids;
+  for (pid_t worker : workers_) {
+    if (worker > 0) pids.push_back(worker);
+  }
+  return pids;
+}
+
+/**
+ * @brief Computes result = lhs * rhs across the pool, in place.
+ *
+ * Returns once the calling process has claimed the last tile and every
+ * worker that joined the job has finished; workers that have not woken up
+ * by then sit the job out. While waiting it checks every 100 ms whether a
+ * participant has died.
+ *
+ * @exception std::invalid_argument Thrown if the shapes do not match or
+ * result shares a segment with an operand.
+ * @exception std::runtime_error Thrown if a tile was not computed because
+ * a worker died or failed; the result is then incomplete.
+ * @exception Rethrows an exception of the kernel in the calling process,
+ * after the workers have finished.
+ */
+void S21ProcessPool::Multiply(const S21SharedMatrix& lhs,
+                              const S21SharedMatrix& rhs,
+                              S21SharedMatrix& result) {
+  if (lhs.get_cols() != rhs.get_rows() ||
+      result.get_rows() != lhs.get_rows() ||
+      result.get_cols() != rhs.get_cols()) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  if (&result == &lhs || &result == &rhs) {
+    throw std::invalid_argument("Result must not alias an operand.");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  Lock(&control_->mutex);
+  ReapWorkers();
+  std::strncpy(control_->lhs, lhs.get_name().c_str(), kNameSize - 1);
+  std::strncpy(control_->rhs, rhs.get_name().c_str(), kNameSize - 1);
+  std::strncpy(control_->result, result.get_name().c_str(), kNameSize - 1);
+  control_->m = lhs.get_rows();
+  control_->n = rhs.get_cols();
+  control_->k = lhs.get_cols();
+  control_->next_tile.store(0);
+  control_->computed.store(0);
+  control_->open = true;
+  ++control_->generation;
+  NotifyChange(&control_->changes);
+  pthread_mutex_unlock(&control_->mutex);
+
+  std::exception_ptr error;
+  try {
+    RunTiles(lhs.data(), rhs.data(), result.data());
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  Lock(&control_->mutex);
+  control_->open = false;
+  while (control_->active > 0) {
+    WaitForChange(&control_->changes, &control_->mutex);
+    ReapWorkers();
+  }
+  pthread_mutex_unlock(&control_->mutex);
+  if (error) std::rethrow_exception(error);
+  int m = lhs.get_rows();
+  int n = rhs.get_cols();
+  int tiles = ((m + kTileRows - 1) / kTileRows) *
+              ((n + kTileCols - 1) / kTileCols);
+  if (control_->computed.load() != tiles) {
+    throw std::runtime_error("A worker process failed during Multiply.");
+  }
+}
+
+/**
+ * @brief Computes lhs * rhs across the pool.
+ *
+ * Stages the operands and the result in shared memory; use the overload
+ * for S21SharedMatrix to avoid these copies.
+ *
+ * @exception std::invalid_argument Thrown if the shapes do not match.
+ * @exception std::runtime_error Thrown if a segment cannot be created.
+ */
+S21Matrix S21ProcessPool::Multiply(const S21Matrix& lhs,
+                                   const S21Matrix& rhs) {
+  if (lhs.get_cols() != rhs.get_rows()) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  S21SharedMatrix a(lhs);
+  S21SharedMatrix b(rhs);
+  S21SharedMatrix c(lhs.get_rows(), rhs.get_cols());
+  Multiply(a, b, c);
+  return c.ToMatrix();
+}
+
+// --- Private methods ---
+
+/**
+ * @brief Body of the worker in slot: waits for jobs until the pool stops.
+ *
+ * The worker asks to be killed when the thread that forked it exits, and
+ * gives up at once if the parent is already gone. Leaves with _exit so the
+ * copies of the parent's static objects, such as thread pools whose
+ * threads do not exist in the child, are not destroyed.
+ */
+void S21ProcessPool::WorkerLoop(int slot, pid_t parent) {
+  prctl(PR_SET_PDEATHSIG, SIGKILL);
+  if (getppid() != parent) _exit(0);
+  Lock(&control_->mutex);
+  unsigned long seen = control_->generation;
+  for (;;) {
+    while (control_->generation == seen && !control_->stopping) {
+      WaitForChange(&control_->changes, &control_->mutex);
+    }
+    if (control_->stopping) {
+      pthread_mutex_unlock(&control_->mutex);
+      _exit(0);
+    }
+    seen = control_->generation;
+    if (!control_->open) continue;
+    control_->busy[slot] = true;
+    ++control_->active;
+    pthread_mutex_unlock(&control_->mutex);
+
+    std::size_t a_bytes = SegmentBytes(control_->m, control_->k);
+    std::size_t b_bytes = SegmentBytes(control_->k, control_->n);
+    std::size_t c_bytes = SegmentBytes(control_->m, control_->n);
+    const double* a = MapSegment(control_->lhs, a_bytes, false);
+    const double* b = MapSegment(control_->rhs, b_bytes, false);
+    double* c = MapSegment(control_->result, c_bytes, true);
+    try {
+      if (a && b && c) RunTiles(a, b, c);
+    } catch (...) {
+      // The pool sees the missing tiles in computed.
+    }
+    UnmapSegment(a, a_bytes);
+    UnmapSegment(b, b_bytes);
+    UnmapSegment(c, c_bytes);
+
+    Lock(&control_->mutex);
+    control_->busy[slot] = false;
+    --control_->active;
+    NotifyChange(&control_->changes);
+  }
+}
+
+/**
+ * @brief Claims result tiles until none are left and computes each with a
+ * single-threaded Gemm.
+ */
+void S21ProcessPool::RunTiles(const double* a, const double* b, double* c) {
+  int m = control_->m;
+  int n = control_->n;
+  int k = control_->k;
+  int row_tiles = (m + kTileRows - 1) / kTileRows;
+  int tiles = row_tiles * ((n + kTileCols - 1) / kTileCols);
+  s21_internal::ScopedThreadLimit limit(1);
+  for (int t = control_->next_tile.fetch_add(1); t < tiles;
+       t = control_->next_tile.fetch_add(1)) {
+    int i0 = (t % row_tiles) * kTileRows;
+    int j0 = (t / row_tiles) * kTileCols;
+    int rows = std::min(kTileRows, m - i0);
+    int cols = std::min(kTileCols, n - j0);
+    s21_internal::GemmStrided(false, false, rows, cols, k, 1.0,
+                              a + static_cast<std::size_t>(i0) * k, k, b + j0,
+                              n, 0.0, c + static_cast<std::size_t>(i0) * n + j0,
+                              n);
+    control_->computed.fetch_add(1);
+  }
+}
+
+/**
+ * @brief Reaps the workers that have exited and frees their slots; called
+ * with the control mutex held.
+ */
+void S21ProcessPool::ReapWorkers() {
+  for (std::size_t i = 0; i < workers_.size(); ++i) {
+    if (workers_[i] <= 0 || waitpid(workers_[i], nullptr, WNOHANG) == 0) {
+      continue;
+    }
+    workers_[i] = 0;
+    if (control_->busy[i]) {
+      control_->busy[i] = false;
+      --control_->active;
+    }
+  }
+}
+
+/**
+ * @brief Destroys the synchronization objects and unmaps the control block.
+ */
+void S21ProcessPool::ReleaseControl() {
+  pthread_mutex_destroy(&control_->mutex);
+  control_->~Control();
+  munmap(control_, sizeof(Control));
+  control_ = nullptr;
+}
@@ -0,0 +1,115 @@
+#ifndef S21_PROCESS_POOL_H
+#define S21_PROCESS_POOL_H
+
+#include <sys/types.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Row-major matrix stored in a named POSIX shared memory segment.
+ *
+ * Any process on the host can map the segment by get_name(); S21ProcessPool
+ * workers read operands and write results there directly. The object that
+ * created the segment unlinks it when it is destroyed.
+ */
+class S21SharedMatrix {
+ private:
+  int rows_;
+  int cols_;
+  std::string name_;
+  double* data_;
+
+  void Release();
+
+ public:
+  // -- Constructors, destructor --
+
+  S21SharedMatrix(int rows, int cols);
+  explicit S21SharedMatrix(const S21Matrix& source);
+  S21SharedMatrix(const S21SharedMatrix&) = delete;
+  S21SharedMatrix(S21SharedMatrix&& other) noexcept;
+  S21SharedMatrix& operator=(const S21SharedMatrix&) = delete;
+  S21SharedMatrix& operator=(S21SharedMatrix&& other) noexcept;
+  ~S21SharedMatrix();
+
+  // --- Getters ---
+
+  int get_rows() const;
+  int get_cols() const;
+  const std::string& get_name() const;
+
+  // --- Accessors ---
+
+  double& operator()(int row, int col);
+  double operator()(int row, int col) const;
+  double* data();
+  const double* data() const;
+
+  // --- Public methods ---
+
+  S21Matrix ToMatrix() const;
+};
+
+/**
+ * @brief Pool of forked worker processes that multiply shared matrices.
+ *
+ * The constructor forks the workers; they wait on a futex in an anonymous
+ * shared mapping. Multiply() publishes the segment
+ * names and shapes of the operands, wakes the workers, and every worker
+ * that wakes while the job is open, together with the calling process,
+ * claims tiles of the result from a shared atomic counter. Each participant
+ * maps the operands by name and writes its tiles in place; nothing is
+ * copied between processes. The call returns when all tiles are done and
+ * the workers that joined have finished. Kernels inside a participant run
+ * on one thread, on the builtin kernels even under the OpenBLAS backend.
+ *
+ * Create the pool before starting other threads, as with any fork-based
+ * pool: the children start as copies of the forking thread only, and they
+ * are killed when that thread exits. A worker that is not scheduled in time
+ * sits the job out, and one that cannot map the operands skips it; the
+ * others take their tiles. Waits poll for dead workers every 100 ms: a
+ * worker that dies is reaped and dropped from the pool, and if it had
+ * claimed a tile Multiply() throws instead of blocking. Calls to Multiply()
+ * from several threads run one after another.
+ *
+ * Usage: S21ProcessPool pool(3);
+ *        S21Matrix c = pool.Multiply(a, b);
+ */
+class S21ProcessPool {
+ private:
+  struct Control;
+
+  Control* control_;
+  std::vector<pid_t> workers_;
+  std::mutex mutex_;
+
+  [[noreturn]] void WorkerLoop(int slot, pid_t parent);
+  void RunTiles(const double* a, const double* b, double* c);
+  void ReapWorkers();
+  void ReleaseControl();
+
+ public:
+  // -- Constructors, destructor --
+
+  explicit S21ProcessPool(int workers);
+  S21ProcessPool(const S21ProcessPool&) = delete;
+  S21ProcessPool& operator=(const S21ProcessPool&) = delete;
+  ~S21ProcessPool();
+
+  // --- Getters ---
+
+  int get_workers() const;
+  std::vector<pid_t> get_pids() const;
+
+  // --- Public methods ---
+
+  void Multiply(const S21SharedMatrix& lhs, const S21SharedMatrix& rhs,
+                S21SharedMatrix& result);
+  S21Matrix Multiply(const S21Matrix& lhs, const S21Matrix& rhs);
+};
+
+#endif  // S21_PROCESS_POOL_H
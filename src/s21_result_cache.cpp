@@ -0,0 +1,364 @@
+#include "s21_result_cache.h"
+
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define S21_HASH_X86 1
+#endif
+
+using s21_internal::CachedOperation;
+
+namespace {
+constexpr std::size_t kDefaultCapacity = std::size_t{64} << 20;
+// Bookkeeping charged per entry on top of its matrices: list node, hash
+// table slot and the entry itself.
+constexpr std::size_t kEntryOverhead = 256;
+
+constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+// Per-lane keys of the first stripe; each later stripe adds kPrime2, so
+// equal words at different positions contribute differently.
+constexpr std::uint64_t kLaneKeys[4] = {
+    0xBE4BA423396CFEB8ULL, 0x1CAD21F72C81017CULL, 0xDB979083E96DD4DEULL,
+    0x1F67B3B7A4A44072ULL};
+
+/**
+ * @brief Final mix of a 64-bit value (MurmurHash3 fmix64).
+ */
+std::uint64_t Avalanche(std::uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+/**
+ * @brief Adds one word to a lane accumulator: the 32 x 32 -> 64-bit product
+ * of the halves of the keyed word, plus the word itself. Both operations
+ * exist on four 64-bit lanes in AVX2, which has no full 64-bit multiply.
+ */
+inline std::uint64_t Round(std::uint64_t acc, std::uint64_t word,
+                           std::uint64_t key) {
+  std::uint64_t keyed = word ^ key;
+  return acc + (keyed & 0xFFFFFFFFULL) * (keyed >> 32) + word;
+}
+
+void AccumulateScalar(const double* data, std::size_t stripes,
+                      std::uint64_t acc[4]) {
+  for (std::size_t s = 0; s < stripes; ++s) {
+    for (int lane = 0; lane < 4; ++lane) {
+      std::uint64_t word;
+      std::memcpy(&word, data + 4 * s + lane, sizeof(word));
+      acc[lane] = Round(acc[lane], word, kLaneKeys[lane] + s * kPrime2);
+    }
+  }
+}
+
+#ifdef S21_HASH_X86
+/**
+ * @brief AccumulateScalar on four lanes at once; the same result.
+ */
+__attribute__((target("avx2"))) void AccumulateAvx2(const double* data,
+                                                    std::size_t stripes,
+                                                    std::uint64_t acc[4]) {
+  __m256i sum = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc));
+  __m256i keys =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(kLaneKeys));
+  __m256i step = _mm256_set1_epi64x(static_cast<long long>(kPrime2));
+  for (std::size_t s = 0; s < stripes; ++s) {
+    __m256i word = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(data + 4 * s));
+    __m256i keyed = _mm256_xor_si256(word, keys);
+    __m256i product =
+        _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+    sum = _mm256_add_epi64(sum, _mm256_add_epi64(product, word));
+    keys = _mm256_add_epi64(keys, step);
+  }
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc), sum);
+}
+#endif
+
+bool CpuHasAvx2() {
+#ifdef S21_HASH_X86
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#else
+  return false;
+#endif
+}
+
+struct Entry {
+  std::uint64_t key = 0;
+  CachedOperation op = CachedOperation::kDeterminant;
+  S21Backend backend = S21Backend::kBuiltin;
+  S21Matrix input;
+  S21Matrix matrix;
+  double scalar = 0.0;
+  std::size_t bytes = 0;
+};
+
+using EntryList = std::list<std::shared_ptr<const Entry>>;
+
+/**
+ * @brief The process-wide cache. The list is ordered from most to least
+ * recently used; the index maps a key to its list node.
+ */
+struct Cache {
+  std::atomic<bool> enabled{false};
+  std::atomic<std::size_t> hits{0};
+  std::atomic<std::size_t> misses{0};
+  std::atomic<std::size_t> collisions{0};
+  std::mutex mutex;
+  std::size_t capacity = kDefaultCapacity;
+  std::size_t bytes = 0;
+  std::size_t evictions = 0;
+  EntryList lru;
+  std::unordered_map<std::uint64_t, EntryList::iterator> index;
+
+  // Requires mutex.
+  void Erase(EntryList::iterator it) {
+    bytes -= (*it)->bytes;
+    index.erase((*it)->key);
+    lru.erase(it);
+  }
+
+  // Requires mutex.
+  void Shrink() {
+    while (bytes > capacity && !lru.empty()) {
+      Erase(std::prev(lru.end()));
+      ++evictions;
+    }
+  }
+};
+
+Cache& Instance() {
+  static Cache cache;
+  return cache;
+}
+
+bool SameContents(const S21Matrix& a, const S21Matrix& b) {
+  if (a.get_rows() != b.get_rows() || a.get_cols() != b.get_cols()) {
+    return false;
+  }
+  std::size_t bytes = static_cast<std::size_t>(a.get_rows()) *
+                      a.get_cols() * sizeof(double);
+  return std::memcmp(a.data(), b.data(), bytes) == 0;
+}
+
+/**
+ * @brief The verified entry for key, or nullptr; updates the counters.
+ *
+ * Only the list update holds the lock; the O(n^2) comparison runs outside
+ * it on the immutable entry.
+ */
+std::shared_ptr<const Entry> Lookup(std::uint64_t key, CachedOperation op,
+                                    S21Backend backend,
+                                    const S21Matrix& input) {
+  Cache& cache = Instance();
+  std::shared_ptr<const Entry> entry;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto found = cache.index.find(key);
+    if (found != cache.index.end()) {
+      cache.lru.splice(cache.lru.begin(), cache.lru, found->second);
+      entry = *found->second;
+    }
+  }
+  if (!entry) {
+    ++cache.misses;
+    return nullptr;
+  }
+  if (entry->op != op || entry->backend != backend ||
+      !SameContents(entry->input, input)) {
+    ++cache.misses;
+    ++cache.collisions;
+    return nullptr;
+  }
+  ++cache.hits;
+  return entry;
+}
+
+/**
+ * @brief Inserts an entry, replacing one with the same key, and evicts
+ * least recently used entries down to the capacity.
+ */
+void Insert(std::shared_ptr<Entry> entry) {
+  Cache& cache = Instance();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (entry->bytes > cache.capacity) return;
+  auto found = cache.index.find(entry->key);
+  if (found != cache.index.end()) cache.Erase(found->second);
+  cache.bytes += entry->bytes;
+  std::uint64_t key = entry->key;
+  cache.lru.push_front(std::move(entry));
+  cache.index[key] = cache.lru.begin();
+  cache.Shrink();
+}
+
+std::size_t MatrixBytes(const S21Matrix& m) {
+  return static_cast<std::size_t>(m.get_rows()) * m.get_cols() *
+         sizeof(double);
+}
+}  // namespace
+
+// --- S21ResultCache ---
+
+bool S21ResultCache::get_enabled() { return Instance().enabled.load(); }
+
+/**
+ * @brief Largest total size of the entries, in bytes.
+ */
+std::size_t S21ResultCache::get_capacity() {
+  Cache& cache = Instance();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.capacity;
+}
+
+S21CacheStats S21ResultCache::get_stats() {
+  Cache& cache = Instance();
+  S21CacheStats stats;
+  stats.hits = cache.hits.load();
+  stats.misses = cache.misses.load();
+  stats.collisions = cache.collisions.load();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  stats.evictions = cache.evictions;
+  stats.entries = cache.lru.size();
+  stats.bytes = cache.bytes;
+  return stats;
+}
+
+/**
+ * @brief Turns the cache on or off; disabling keeps the entries.
+ */
+void S21ResultCache::set_enabled(bool enabled) {
+  Instance().enabled.store(enabled);
+}
+
+/**
+ * @brief Sets the largest total size of the entries and evicts down to it.
+ */
+void S21ResultCache::set_capacity(std::size_t bytes) {
+  Cache& cache = Instance();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.capacity = bytes;
+  cache.Shrink();
+}
+
+/**
+ * @brief Drops every entry and resets the counters.
+ */
+void S21ResultCache::Clear() {
+  Cache& cache = Instance();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.lru.clear();
+  cache.index.clear();
+  cache.bytes = 0;
+  cache.evictions = 0;
+  cache.hits = 0;
+  cache.misses = 0;
+  cache.collisions = 0;
+}
+
+/**
+ * @brief 64-bit hash of the shape and the bit pattern of the elements.
+ *
+ * Four independent lanes, each accumulating position-keyed 32 x 32-bit
+ * products of the element words, combined and mixed at the end. The AVX2
+ * path processes a stripe of four elements per step and gives the same
+ * value as the scalar path.
+ */
+std::uint64_t S21ResultCache::Hash(const S21Matrix& matrix) {
+  static const bool kAvx2 = CpuHasAvx2();
+  std::size_t size = static_cast<std::size_t>(matrix.get_rows()) *
+                     matrix.get_cols();
+  std::size_t stripes = size / 4;
+  std::uint64_t acc[4] = {0, 0, 0, 0};
+#ifdef S21_HASH_X86
+  if (kAvx2) {
+    AccumulateAvx2(matrix.data(), stripes, acc);
+  } else {
+    AccumulateScalar(matrix.data(), stripes, acc);
+  }
+#else
+  AccumulateScalar(matrix.data(), stripes, acc);
+#endif
+  for (std::size_t i = 4 * stripes; i < size; ++i) {
+    std::uint64_t word;
+    std::memcpy(&word, matrix.data() + i, sizeof(word));
+    int lane = static_cast<int>(i % 4);
+    acc[lane] = Round(acc[lane], word, kLaneKeys[lane] + stripes * kPrime2);
+  }
+  std::uint64_t h = static_cast<std::uint64_t>(matrix.get_rows()) * kPrime1 ^
+                    static_cast<std::uint64_t>(matrix.get_cols()) * kPrime2;
+  for (std::uint64_t lane : acc) h = (h ^ Avalanche(lane)) * kPrime1;
+  return Avalanche(h);
+}
+
+// --- s21_internal::CacheLookup ---
+
+/**
+ * @brief Hashes the input if use is true, the cache is enabled and the
+ * input is a square matrix larger than 4x4.
+ */
+s21_internal::CacheLookup::CacheLookup(CachedOperation op,
+                                       const S21Matrix& input, bool use)
+    : op_(op),
+      backend_(S21LinearAlgebra::get_backend()),
+      input_(input),
+      active_(false),
+      key_(0) {
+  if (!use || !S21ResultCache::get_enabled()) return;
+  if (input.get_rows() != input.get_cols() || input.get_rows() <= 4) return;
+  active_ = true;
+  std::uint64_t tag = static_cast<std::uint64_t>(op) * 2 +
+                      static_cast<std::uint64_t>(backend_) + 1;
+  key_ = Avalanche(S21ResultCache::Hash(input) + tag * kPrime2);
+}
+
+bool s21_internal::CacheLookup::Find(S21Matrix* result) const {
+  if (!active_) return false;
+  std::shared_ptr<const Entry> entry = Lookup(key_, op_, backend_, input_);
+  if (!entry) return false;
+  *result = entry->matrix;
+  return true;
+}
+
+bool s21_internal::CacheLookup::Find(double* result) const {
+  if (!active_) return false;
+  std::shared_ptr<const Entry> entry = Lookup(key_, op_, backend_, input_);
+  if (!entry) return false;
+  *result = entry->scalar;
+  return true;
+}
+
+void s21_internal::CacheLookup::Store(const S21Matrix& result) {
+  if (!active_) return;
+  auto entry = std::make_shared<Entry>();
+  entry->key = key_;
+  entry->op = op_;
+  entry->backend = backend_;
+  entry->input = input_;
+  entry->matrix = result;
+  entry->bytes = MatrixBytes(input_) + MatrixBytes(result) + kEntryOverhead;
+  Insert(std::move(entry));
+}
+
+void s21_internal::CacheLookup::Store(double result) {
+  if (!active_) return;
+  auto entry = std::make_shared<Entry>();
+  entry->key = key_;
+  entry->op = op_;
+  entry->backend = backend_;
+  entry->input = input_;
+  entry->scalar = result;
+  entry->bytes = MatrixBytes(input_) + kEntryOverhead;
+  Insert(std::move(entry));
+}
@@ -0,0 +1,102 @@
+#ifndef S21_RESULT_CACHE_H
+#define S21_RESULT_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "s21_backend.h"
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Counters of S21ResultCache since the last Clear().
+ *
+ * collisions counts lookups whose hash matched an entry with different
+ * contents; they are also counted as misses. entries and bytes describe
+ * the current contents.
+ */
+struct S21CacheStats {
+  std::size_t hits = 0;
+  std::size_t misses = 0;
+  std::size_t collisions = 0;
+  std::size_t evictions = 0;
+  std::size_t entries = 0;
+  std::size_t bytes = 0;
+};
+
+/**
+ * @brief Process-wide memoization of InverseMatrix(), Determinant() and
+ * CalcComplements() across matrix instances.
+ *
+ * Disabled by default. When enabled, these methods look up square matrices
+ * larger than 4x4 (smaller ones use closed forms that are cheaper than a
+ * lookup) by a 64-bit hash of the operation, the selected S21Backend, the
+ * shape and the bit pattern of the elements, hashed four words at a time
+ * with AVX2 when available. A hit is verified against a stored copy of the
+ * input before its result is returned, so equal hashes of different
+ * matrices only cost a miss. A matrix that already holds a current LU
+ * factorization computes from it and skips the cache, without hashing.
+ *
+ * Entries are evicted least recently used first once their total size,
+ * inputs and results included, exceeds the capacity (64 MiB by default);
+ * results larger than the capacity are not stored. Failed computations,
+ * such as the inverse of a singular matrix, are not cached. All functions
+ * are thread-safe.
+ */
+class S21ResultCache {
+ public:
+  // --- Getters ---
+
+  static bool get_enabled();
+  static std::size_t get_capacity();
+  static S21CacheStats get_stats();
+
+  // --- Setters ---
+
+  static void set_enabled(bool enabled);
+  static void set_capacity(std::size_t bytes);
+
+  // --- Public methods ---
+
+  static void Clear();
+  static std::uint64_t Hash(const S21Matrix& matrix);
+};
+
+namespace s21_internal {
+/**
+ * @brief Results memoized by S21ResultCache.
+ */
+enum class CachedOperation { kInverse, kDeterminant, kComplements };
+
+/**
+ * @brief One cache lookup, and the store of its result on a miss.
+ *
+ * The key is hashed once, in the constructor, and only if use is true, the
+ * cache is enabled and the input is eligible; otherwise Find() returns
+ * false and Store() does nothing. The key includes the backend selected at
+ * construction, so results computed by different backends are kept apart.
+ * The input must outlive the object.
+ *
+ * Usage: CacheLookup cache(CachedOperation::kDeterminant, *this);
+ *        if (cache.Find(&det)) return det;
+ *        det = ...;
+ *        cache.Store(det);
+ */
+class CacheLookup {
+ private:
+  CachedOperation op_;
+  S21Backend backend_;
+  const S21Matrix& input_;
+  bool active_;
+  std::uint64_t key_;
+
+ public:
+  CacheLookup(CachedOperation op, const S21Matrix& input, bool use = true);
+
+  bool Find(S21Matrix* result) const;
+  bool Find(double* result) const;
+  void Store(const S21Matrix& result);
+  void Store(double result);
+};
+}  // namespace s21_internal
+
+#endif  // S21_RESULT_CACHE_H
@@ -0,0 +1,157 @@
+#ifndef S21_SMALL_KERNELS_H
+#define S21_SMALL_KERNELS_H
+
+#include <cfloat>
+#include <cmath>
+#include <utility>
+
+// Internal closed-form kernels for matrices of order 1 to 4. Not part of the
+// public API. Inputs and outputs are contiguous row-major n x n arrays; the
+// code is allocation-free and, apart from the pivoting in SmallIsSingular,
+// straight-line and branch-free.
+namespace s21_internal {
+
+/**
+ * @brief Determinant of a 3x3 matrix, expanded along the first row.
+ */
+inline double Determinant3(const double* a) {
+  return a[0] * (a[4] * a[8] - a[5] * a[7]) -
+         a[1] * (a[3] * a[8] - a[5] * a[6]) +
+         a[2] * (a[3] * a[7] - a[4] * a[6]);
+}
+
+/**
+ * @brief Determinant of a 4x4 matrix from the six 2x2 minors of the upper
+ * two rows and the six complementary minors of the lower two rows (Laplace
+ * expansion along rows 0 and 1).
+ */
+inline double Determinant4(const double* a) {
+  double s0 = a[0] * a[5] - a[4] * a[1];
+  double s1 = a[0] * a[6] - a[4] * a[2];
+  double s2 = a[0] * a[7] - a[4] * a[3];
+  double s3 = a[1] * a[6] - a[5] * a[2];
+  double s4 = a[1] * a[7] - a[5] * a[3];
+  double s5 = a[2] * a[7] - a[6] * a[3];
+  double c5 = a[10] * a[15] - a[14] * a[11];
+  double c4 = a[9] * a[15] - a[13] * a[11];
+  double c3 = a[9] * a[14] - a[13] * a[10];
+  double c2 = a[8] * a[15] - a[12] * a[11];
+  double c1 = a[8] * a[14] - a[12] * a[10];
+  double c0 = a[8] * a[13] - a[12] * a[9];
+  return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+/**
+ * @brief Determinant of an n x n matrix, n in [1, 4].
+ */
+inline double SmallDeterminant(const double* a, int n) {
+  switch (n) {
+    case 1:
+      return a[0];
+    case 2:
+      return a[0] * a[3] - a[1] * a[2];
+    case 3:
+      return Determinant3(a);
+    default:
+      return Determinant4(a);
+  }
+}
+
+/**
+ * @brief Adjugate (transposed matrix of algebraic complements) of an n x n
+ * matrix, n in [1, 4]. out must not alias a.
+ */
+inline void SmallAdjugate(const double* a, int n, double* out) {
+  if (n == 1) {
+    out[0] = 1.0;
+  } else if (n == 2) {
+    out[0] = a[3];
+    out[1] = -a[1];
+    out[2] = -a[2];
+    out[3] = a[0];
+  } else if (n == 3) {
+    out[0] = a[4] * a[8] - a[5] * a[7];
+    out[1] = a[2] * a[7] - a[1] * a[8];
+    out[2] = a[1] * a[5] - a[2] * a[4];
+    out[3] = a[5] * a[6] - a[3] * a[8];
+    out[4] = a[0] * a[8] - a[2] * a[6];
+    out[5] = a[2] * a[3] - a[0] * a[5];
+    out[6] = a[3] * a[7] - a[4] * a[6];
+    out[7] = a[1] * a[6] - a[0] * a[7];
+    out[8] = a[0] * a[4] - a[1] * a[3];
+  } else {
+    double s0 = a[0] * a[5] - a[4] * a[1];
+    double s1 = a[0] * a[6] - a[4] * a[2];
+    double s2 = a[0] * a[7] - a[4] * a[3];
+    double s3 = a[1] * a[6] - a[5] * a[2];
+    double s4 = a[1] * a[7] - a[5] * a[3];
+    double s5 = a[2] * a[7] - a[6] * a[3];
+    double c5 = a[10] * a[15] - a[14] * a[11];
+    double c4 = a[9] * a[15] - a[13] * a[11];
+    double c3 = a[9] * a[14] - a[13] * a[10];
+    double c2 = a[8] * a[15] - a[12] * a[11];
+    double c1 = a[8] * a[14] - a[12] * a[10];
+    double c0 = a[8] * a[13] - a[12] * a[9];
+    out[0] = a[5] * c5 - a[6] * c4 + a[7] * c3;
+    out[1] = -a[1] * c5 + a[2] * c4 - a[3] * c3;
+    out[2] = a[13] * s5 - a[14] * s4 + a[15] * s3;
+    out[3] = -a[9] * s5 + a[10] * s4 - a[11] * s3;
+    out[4] = -a[4] * c5 + a[6] * c2 - a[7] * c1;
+    out[5] = a[0] * c5 - a[2] * c2 + a[3] * c1;
+    out[6] = -a[12] * s5 + a[14] * s2 - a[15] * s1;
+    out[7] = a[8] * s5 - a[10] * s2 + a[11] * s1;
+    out[8] = a[4] * c4 - a[5] * c2 + a[7] * c0;
+    out[9] = -a[0] * c4 + a[1] * c2 - a[3] * c0;
+    out[10] = a[12] * s4 - a[13] * s2 + a[15] * s0;
+    out[11] = -a[8] * s4 + a[9] * s2 - a[11] * s0;
+    out[12] = -a[4] * c3 + a[5] * c1 - a[6] * c0;
+    out[13] = a[0] * c3 - a[1] * c1 + a[2] * c0;
+    out[14] = -a[12] * s3 + a[13] * s1 - a[14] * s0;
+    out[15] = a[8] * s3 - a[9] * s1 + a[10] * s0;
+  }
+}
+
+/**
+ * @brief Whether an n x n matrix, n in [1, 4], is singular by the rule of
+ * the LU factorization used for larger matrices: elimination with partial
+ * pivoting, where a pivot not larger than n * DBL_EPSILON times the largest
+ * element of its original row marks the matrix as singular.
+ *
+ * Both sides of the test scale with each row, so c * A is singular exactly
+ * when A is, for every order.
+ */
+inline bool SmallIsSingular(const double* a, int n) {
+  double lu[16];
+  double scale[4];
+  int origin[4];
+  for (int i = 0; i < n; ++i) {
+    origin[i] = i;
+    scale[i] = 0.0;
+    for (int j = 0; j < n; ++j) {
+      lu[i * n + j] = a[i * n + j];
+      scale[i] = std::fmax(scale[i], std::fabs(a[i * n + j]));
+    }
+  }
+  double tolerance = n * DBL_EPSILON;
+  for (int k = 0; k < n; ++k) {
+    int pivot = k;
+    for (int i = k + 1; i < n; ++i) {
+      if (std::fabs(lu[i * n + k]) > std::fabs(lu[pivot * n + k])) pivot = i;
+    }
+    if (pivot != k) {
+      for (int j = 0; j < n; ++j) std::swap(lu[k * n + j], lu[pivot * n + j]);
+      std::swap(origin[k], origin[pivot]);
+    }
+    double diag = lu[k * n + k];
+    if (std::fabs(diag) <= tolerance * scale[origin[k]]) return true;
+    for (int i = k + 1; i < n; ++i) {
+      double factor = lu[i * n + k] / diag;
+      for (int j = k + 1; j < n; ++j) lu[i * n + j] -= factor * lu[k * n + j];
+    }
+  }
+  return false;
+}
+
+}  // namespace s21_internal
+
+#endif  // S21_SMALL_KERNELS_H
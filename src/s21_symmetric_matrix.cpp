@@ -0,0 +1,194 @@
+#include "s21_symmetric_matrix.h"
+
+#include <cfloat>
+
+#include "s21_kernels.h"
+
+// --- Constructors ---
+
+/**
+ * @brief Creates a zero symmetric matrix.
+ *
+ * @param size The order n.
+ * @exception std::invalid_argument Thrown if size is less than 1.
+ */
+S21SymmetricMatrix::S21SymmetricMatrix(int size) : size_(size) {
+  if (size < 1) {
+    throw std::invalid_argument("Incorrect matrix dimensions");
+  }
+  values_.assign(static_cast<std::size_t>(size) * (size + 1) / 2, 0.0);
+}
+
+/**
+ * @brief Packs a dense symmetric matrix.
+ *
+ * @param dense A square matrix equal to its transpose within 1e-7.
+ * @exception std::invalid_argument Thrown if the matrix is not square or not
+ * symmetric.
+ */
+S21SymmetricMatrix::S21SymmetricMatrix(const S21Matrix& dense)
+    : S21SymmetricMatrix(dense.get_rows()) {
+  if (dense.get_rows() != dense.get_cols()) {
+    throw std::invalid_argument("Symmetric matrix must be square.");
+  }
+  for (int i = 0; i < size_; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      if (std::fabs(dense(i, j) - dense(j, i)) > 1e-7) {
+        throw std::invalid_argument("Matrix is not symmetric.");
+      }
+      values_[Position(i, j)] = dense(i, j);
+    }
+  }
+}
+
+// --- Accessors ---
+
+/**
+ * @brief Get the order of the matrix.
+ */
+int S21SymmetricMatrix::get_size() const { return size_; }
+
+/**
+ * @brief Returns a reference to the element shared by (row, col) and
+ * (col, row).
+ *
+ * @exception std::out_of_range Thrown if the index is out of range.
+ */
+double& S21SymmetricMatrix::operator()(int row, int col) {
+  if (row < 0 || col < 0 || row >= size_ || col >= size_) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return values_[Position(row, col)];
+}
+
+/**
+ * @brief Returns the element at (row, col).
+ *
+ * @exception std::out_of_range Thrown if the index is out of range.
+ */
+double S21SymmetricMatrix::operator()(int row, int col) const {
+  if (row < 0 || col < 0 || row >= size_ || col >= size_) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return values_[Position(row, col)];
+}
+
+// --- Operations ---
+
+/**
+ * @brief Expands the matrix into dense storage.
+ */
+S21Matrix S21SymmetricMatrix::ToDense() const {
+  S21Matrix result(size_, size_);
+  double* out = result.data();
+  for (int i = 0; i < size_; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      double value = values_[Position(i, j)];
+      out[static_cast<std::size_t>(i) * size_ + j] = value;
+      out[static_cast<std::size_t>(j) * size_ + i] = value;
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Multiplies the matrix by a vector (packed SYMV).
+ *
+ * Row i of the packed triangle contributes a dot product to y_i and an AXPY
+ * to y_0..y_{i-1}, so each stored entry is loaded once.
+ *
+ * @exception std::invalid_argument Thrown if the sizes do not match.
+ */
+S21Vector S21SymmetricMatrix::MulVector(const S21Vector& vec) const {
+  if (vec.get_size() != size_) {
+    throw std::invalid_argument(
+        "Matrix and vector dimensions are not suitable for multiplication.");
+  }
+  S21Vector result(size_);
+  const double* x = vec.data();
+  double* y = result.data();
+  for (int i = 0; i < size_; ++i) {
+    const double* row = values_.data() + Position(i, 0);
+    y[i] += s21_internal::DotKernel(row, x, i + 1);
+    s21_internal::AxpyKernel(x[i], row, y, i);
+  }
+  return result;
+}
+
+/**
+ * @brief Multiplies the matrix by a dense matrix, using each stored entry
+ * for both triangles.
+ *
+ * @exception std::invalid_argument Thrown if the dimensions do not match.
+ */
+S21Matrix S21SymmetricMatrix::MulMatrix(const S21Matrix& other) const {
+  if (other.get_rows() != size_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  int cols = other.get_cols();
+  S21Matrix result(size_, cols);
+  const double* b = other.data();
+  double* out = result.data();
+  for (int i = 0; i < size_; ++i) {
+    const double* row = values_.data() + Position(i, 0);
+    const double* b_i = b + static_cast<std::size_t>(i) * cols;
+    double* out_i = out + static_cast<std::size_t>(i) * cols;
+    for (int j = 0; j < i; ++j) {
+      s21_internal::AxpyKernel(row[j], b + static_cast<std::size_t>(j) * cols,
+                               out_i, cols);
+      s21_internal::AxpyKernel(row[j], b_i,
+                               out + static_cast<std::size_t>(j) * cols, cols);
+    }
+    s21_internal::AxpyKernel(row[i], b_i, out_i, cols);
+  }
+  return result;
+}
+
+/**
+ * @brief Calculates the determinant from a packed LDL^T factorization,
+ * det(A) = d_1 * ... * d_n, in n^3/6 multiply-adds.
+ *
+ * LDL^T does not pivot; when a pivot is negligible against the size of its
+ * row (indefinite or singular matrices), the dense LU factorization is used
+ * instead.
+ */
+double S21SymmetricMatrix::Determinant() const {
+  std::vector<double> ldl(values_);
+  std::vector<double> scaled(size_);
+  double result = 1.0;
+  for (int k = 0; k < size_; ++k) {
+    double* row_k = ldl.data() + Position(k, 0);
+    // row_k[j] holds l_kj * d_j for j < k until it is finalized below.
+    for (int j = 0; j < k; ++j) {
+      const double* row_j = ldl.data() + Position(j, 0);
+      row_k[j] -= s21_internal::DotKernel(row_j, row_k, j);
+    }
+    double diagonal = row_k[k];
+    double row_scale = std::fabs(values_[Position(k, k)]);
+    for (int j = 0; j < k; ++j) {
+      double d_j = ldl[Position(j, j)];
+      double l_kj = row_k[j] / d_j;
+      diagonal -= l_kj * row_k[j];
+      scaled[j] = l_kj;
+      row_scale = std::fmax(row_scale, std::fabs(values_[Position(k, j)]));
+    }
+    if (std::fabs(diagonal) <= size_ * DBL_EPSILON * row_scale) {
+      return ToDense().Determinant();
+    }
+    for (int j = 0; j < k; ++j) row_k[j] = scaled[j];
+    row_k[k] = diagonal;
+    result *= diagonal;
+  }
+  return result;
+}
+
+// --- Helpers ---
+
+/**
+ * @brief Position of (row, col) in the packed lower triangle.
+ */
+std::size_t S21SymmetricMatrix::Position(int row, int col) const {
+  if (row < col) std::swap(row, col);
+  return static_cast<std::size_t>(row) * (row + 1) / 2 + col;
+}
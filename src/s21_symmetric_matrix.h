@@ -0,0 +1,45 @@
+#ifndef S21_SYMMETRIC_MATRIX_H
+#define S21_SYMMETRIC_MATRIX_H
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Symmetric matrix in packed storage.
+ *
+ * Only the lower triangle is stored, row by row (n(n+1)/2 entries);
+ * (i, j) and (j, i) refer to the same element. Products read every stored
+ * entry once and use it for both triangles.
+ */
+class S21SymmetricMatrix {
+ private:
+  int size_;
+  std::vector<double> values_;
+
+  std::size_t Position(int row, int col) const;
+
+ public:
+  // -- Constructors --
+
+  explicit S21SymmetricMatrix(int size);
+  explicit S21SymmetricMatrix(const S21Matrix& dense);
+
+  // --- Getters ---
+
+  int get_size() const;
+
+  // --- Accessors ---
+
+  double& operator()(int row, int col);
+  double operator()(int row, int col) const;
+
+  // --- Public methods ---
+
+  S21Matrix ToDense() const;
+  S21Vector MulVector(const S21Vector& vec) const;
+  S21Matrix MulMatrix(const S21Matrix& other) const;
+  double Determinant() const;
+};
+
+#endif  // S21_SYMMETRIC_MATRIX_H
@@ -0,0 +1,244 @@
+#include "s21_triangular_matrix.h"
+
+#include <utility>
+
+#include "s21_kernels.h"
+
+// --- Constructors ---
+
+/**
+ * @brief Creates a zero triangular matrix.
+ *
+ * @param size The order n.
+ * @param triangle Which triangle holds the entries.
+ * @exception std::invalid_argument Thrown if size is less than 1.
+ */
+S21TriangularMatrix::S21TriangularMatrix(int size, S21Triangle triangle)
+    : size_(size), triangle_(triangle) {
+  if (size < 1) {
+    throw std::invalid_argument("Incorrect matrix dimensions");
+  }
+  values_.assign(static_cast<std::size_t>(size) * (size + 1) / 2, 0.0);
+}
+
+/**
+ * @brief Packs the triangle of a dense matrix.
+ *
+ * @param dense A square matrix whose entries outside the triangle are zero
+ * (within 1e-7).
+ * @param triangle Which triangle holds the entries.
+ * @exception std::invalid_argument Thrown if the matrix is not square or has
+ * entries outside the triangle.
+ */
+S21TriangularMatrix::S21TriangularMatrix(const S21Matrix& dense,
+                                         S21Triangle triangle)
+    : S21TriangularMatrix(dense.get_rows(), triangle) {
+  if (dense.get_rows() != dense.get_cols()) {
+    throw std::invalid_argument("Triangular matrix must be square.");
+  }
+  for (int i = 0; i < size_; ++i) {
+    for (int j = 0; j < size_; ++j) {
+      if (Contains(i, j)) {
+        values_[Offset(i) + (j - First(i))] = dense(i, j);
+      } else if (std::fabs(dense(i, j)) > 1e-7) {
+        throw std::invalid_argument("Matrix is not triangular.");
+      }
+    }
+  }
+}
+
+// --- Accessors ---
+
+/**
+ * @brief Get the order of the matrix.
+ */
+int S21TriangularMatrix::get_size() const { return size_; }
+
+/**
+ * @brief Get which triangle holds the entries.
+ */
+S21Triangle S21TriangularMatrix::get_triangle() const { return triangle_; }
+
+/**
+ * @brief Returns a reference to a stored entry.
+ *
+ * @exception std::out_of_range Thrown if the index is outside the matrix or
+ * outside the triangle, where the entries are structurally zero.
+ */
+double& S21TriangularMatrix::operator()(int row, int col) {
+  if (row < 0 || col < 0 || row >= size_ || col >= size_ ||
+      !Contains(row, col)) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return values_[Offset(row) + (col - First(row))];
+}
+
+/**
+ * @brief Returns an entry; entries outside the triangle are zero.
+ *
+ * @exception std::out_of_range Thrown if the index is outside the matrix.
+ */
+double S21TriangularMatrix::operator()(int row, int col) const {
+  if (row < 0 || col < 0 || row >= size_ || col >= size_) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return Contains(row, col) ? values_[Offset(row) + (col - First(row))] : 0.0;
+}
+
+// --- Operations ---
+
+/**
+ * @brief Expands the matrix into dense storage.
+ */
+S21Matrix S21TriangularMatrix::ToDense() const {
+  S21Matrix result(size_, size_);
+  double* out = result.data();
+  for (int i = 0; i < size_; ++i) {
+    std::copy(values_.data() + Offset(i),
+              values_.data() + Offset(i) + Length(i),
+              out + static_cast<std::size_t>(i) * size_ + First(i));
+  }
+  return result;
+}
+
+/**
+ * @brief Multiplies the matrix by a vector in n(n+1)/2 multiply-adds.
+ *
+ * @exception std::invalid_argument Thrown if the sizes do not match.
+ */
+S21Vector S21TriangularMatrix::MulVector(const S21Vector& vec) const {
+  if (vec.get_size() != size_) {
+    throw std::invalid_argument(
+        "Matrix and vector dimensions are not suitable for multiplication.");
+  }
+  S21Vector result(size_);
+  for (int i = 0; i < size_; ++i) {
+    result(i) = s21_internal::DotKernel(values_.data() + Offset(i),
+                                        vec.data() + First(i), Length(i));
+  }
+  return result;
+}
+
+/**
+ * @brief Multiplies the matrix by a dense matrix, skipping the zero
+ * triangle.
+ *
+ * @exception std::invalid_argument Thrown if the dimensions do not match.
+ */
+S21Matrix S21TriangularMatrix::MulMatrix(const S21Matrix& other) const {
+  if (other.get_rows() != size_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for multiplication.");
+  }
+  int cols = other.get_cols();
+  S21Matrix result(size_, cols);
+  const double* b = other.data();
+  double* out = result.data();
+  for (int i = 0; i < size_; ++i) {
+    const double* row = values_.data() + Offset(i);
+    double* out_i = out + static_cast<std::size_t>(i) * cols;
+    for (int k = 0; k < Length(i); ++k) {
+      std::size_t source = static_cast<std::size_t>(First(i) + k) * cols;
+      s21_internal::AxpyKernel(row[k], b + source, out_i, cols);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Calculates the determinant as the product of the diagonal, O(n).
+ */
+double S21TriangularMatrix::Determinant() const {
+  double result = 1.0;
+  for (int i = 0; i < size_; ++i) result *= (*this)(i, i);
+  return result;
+}
+
+/**
+ * @brief Solves A * x = b by forward (lower) or back (upper) substitution.
+ *
+ * @exception std::invalid_argument Thrown if the sizes do not match or a
+ * diagonal entry is zero.
+ */
+S21Vector S21TriangularMatrix::Solve(const S21Vector& rhs) const {
+  if (rhs.get_size() != size_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for solving a linear system.");
+  }
+  S21Matrix column(size_, 1);
+  std::copy(rhs.data(), rhs.data() + size_, column.data());
+  S21Matrix solution = Solve(column);
+  S21Vector result(size_);
+  std::copy(std::as_const(solution).data(),
+            std::as_const(solution).data() + size_, result.data());
+  return result;
+}
+
+/**
+ * @brief Solves A * X = B for every column of B at once.
+ *
+ * Works row by row on contiguous rows of X, so each step is one AXPY per
+ * stored entry.
+ *
+ * @exception std::invalid_argument Thrown if the shapes do not match or a
+ * diagonal entry is zero.
+ */
+S21Matrix S21TriangularMatrix::Solve(const S21Matrix& rhs) const {
+  if (rhs.get_rows() != size_) {
+    throw std::invalid_argument(
+        "Matrix dimensions are not suitable for solving a linear system.");
+  }
+  int cols = rhs.get_cols();
+  S21Matrix result(rhs);
+  double* x = result.data();
+  bool lower = triangle_ == S21Triangle::kLower;
+  for (int step = 0; step < size_; ++step) {
+    int i = lower ? step : size_ - 1 - step;
+    const double* row = values_.data() + Offset(i);
+    double* x_i = x + static_cast<std::size_t>(i) * cols;
+    int diagonal = i - First(i);
+    for (int k = 0; k < Length(i); ++k) {
+      if (k == diagonal) continue;
+      s21_internal::AxpyKernel(
+          -row[k], x + static_cast<std::size_t>(First(i) + k) * cols, x_i,
+          cols);
+    }
+    if (row[diagonal] == 0.0) {
+      throw std::invalid_argument("Matrix is singular, cannot solve.");
+    }
+    for (int j = 0; j < cols; ++j) x_i[j] /= row[diagonal];
+  }
+  return result;
+}
+
+// --- Helpers ---
+
+/**
+ * @brief Whether (row, col) lies in the stored triangle.
+ */
+bool S21TriangularMatrix::Contains(int row, int col) const {
+  return triangle_ == S21Triangle::kLower ? col <= row : col >= row;
+}
+
+/**
+ * @brief Position of the first stored entry of a row in values_.
+ */
+std::size_t S21TriangularMatrix::Offset(int row) const {
+  std::size_t i = row;
+  return triangle_ == S21Triangle::kLower ? i * (i + 1) / 2
+                                          : i * size_ - i * (i - 1) / 2;
+}
+
+/**
+ * @brief Column of the first stored entry of a row.
+ */
+int S21TriangularMatrix::First(int row) const {
+  return triangle_ == S21Triangle::kLower ? 0 : row;
+}
+
+/**
+ * @brief Number of stored entries in a row.
+ */
+int S21TriangularMatrix::Length(int row) const {
+  return triangle_ == S21Triangle::kLower ? row + 1 : size_ - row;
+}
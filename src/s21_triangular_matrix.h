@@ -0,0 +1,58 @@
+#ifndef S21_TRIANGULAR_MATRIX_H
+#define S21_TRIANGULAR_MATRIX_H
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+/**
+ * @brief Which triangle of a triangular matrix holds the entries.
+ */
+enum class S21Triangle { kLower, kUpper };
+
+/**
+ * @brief Square lower or upper triangular matrix in packed row-major
+ * storage.
+ *
+ * Only the n(n+1)/2 entries of the triangle are stored; every row of the
+ * triangle is contiguous. The determinant is the product of the diagonal,
+ * and systems are solved by forward or back substitution in O(n^2).
+ */
+class S21TriangularMatrix {
+ private:
+  int size_;
+  S21Triangle triangle_;
+  std::vector<double> values_;
+
+  bool Contains(int row, int col) const;
+  std::size_t Offset(int row) const;
+  int First(int row) const;
+  int Length(int row) const;
+
+ public:
+  // -- Constructors --
+
+  S21TriangularMatrix(int size, S21Triangle triangle);
+  S21TriangularMatrix(const S21Matrix& dense, S21Triangle triangle);
+
+  // --- Getters ---
+
+  int get_size() const;
+  S21Triangle get_triangle() const;
+
+  // --- Accessors ---
+
+  double& operator()(int row, int col);
+  double operator()(int row, int col) const;
+
+  // --- Public methods ---
+
+  S21Matrix ToDense() const;
+  S21Vector MulVector(const S21Vector& vec) const;
+  S21Matrix MulMatrix(const S21Matrix& other) const;
+  double Determinant() const;
+  S21Vector Solve(const S21Vector& rhs) const;
+  S21Matrix Solve(const S21Matrix& rhs) const;
+};
+
+#endif  // S21_TRIANGULAR_MATRIX_H
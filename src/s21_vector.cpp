@@ -0,0 +1,367 @@
+#include "s21_vector.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "s21_kernels.h"
+#include "s21_parallel.h"
+
+namespace {
+// Vectors shorter than this are processed on the calling thread only.
+constexpr int kParallelBlock = 1 << 16;
+
+/**
+ * @brief Dot product split into fixed-size blocks that are evaluated in
+ * parallel and summed in block order, so the result does not depend on the
+ * number of threads.
+ */
+double BlockedDot(const double* x, const double* y, int n) {
+  if (n < 2 * kParallelBlock) return s21_internal::DotKernel(x, y, n);
+  int blocks = (n + kParallelBlock - 1) / kParallelBlock;
+  std::vector<double> partial(blocks, 0.0);
+  s21_internal::ParallelFor(0, blocks, 1, [&](int lo, int hi) {
+    for (int b = lo; b < hi; ++b) {
+      int start = b * kParallelBlock;
+      int len = std::min(kParallelBlock, n - start);
+      partial[b] = s21_internal::DotKernel(x + start, y + start, len);
+    }
+  });
+  double result = 0.0;
+  for (double p : partial) result += p;
+  return result;
+}
+}  // namespace
+
+// --- Constructors ---
+
+/**
+ * @brief Default constructor for S21Vector.
+ *
+ * Initializes a vector of three elements set to zero.
+ */
+S21Vector::S21Vector() : size_(3), data_(new double[3]()) {}
+
+/**
+ * @brief Parameterized constructor for S21Vector.
+ *
+ * Initializes a zero vector with the specified number of elements.
+ *
+ * @param size Number of elements in the vector.
+ * @exception std::invalid_argument Thrown if size is less than 1.
+ */
+S21Vector::S21Vector(int size) : size_(size), data_(nullptr) {
+  if (size < 1) {
+    throw std::invalid_argument("Incorrect vector size");
+  }
+  data_ = new double[size_]();
+}
+
+/**
+ * @brief Copy constructor for S21Vector.
+ *
+ * @param other The vector to copy from.
+ */
+S21Vector::S21Vector(const S21Vector& other)
+    : size_(other.size_), data_(new double[other.size_]) {
+  std::copy(other.data_, other.data_ + size_, data_);
+}
+
+/**
+ * @brief Move constructor for S21Vector.
+ *
+ * The original vector is left empty.
+ *
+ * @param other The vector from which to transfer ownership.
+ */
+S21Vector::S21Vector(S21Vector&& other) noexcept
+    : size_(other.size_), data_(other.data_) {
+  other.size_ = 0;
+  other.data_ = nullptr;
+}
+
+/**
+ * @brief Destructor for the S21Vector class.
+ */
+S21Vector::~S21Vector() { delete[] data_; }
+
+// --- Accessors ---
+
+/**
+ * @brief Get the number of elements in the vector.
+ *
+ * @return Number of elements.
+ */
+int S21Vector::get_size() const { return size_; }
+
+/**
+ * @brief Get the contiguous element storage.
+ *
+ * @return Pointer to the first element.
+ */
+double* S21Vector::data() { return data_; }
+
+/**
+ * @brief Get the contiguous element storage for reading.
+ *
+ * @return Pointer to the first element.
+ */
+const double* S21Vector::data() const { return data_; }
+
+/**
+ * @brief Returns a reference to the element at the given index.
+ *
+ * @param index The element index.
+ * @return A reference to the element.
+ * @throw std::out_of_range if the index is out of range.
+ */
+double& S21Vector::operator()(int index) {
+  if (index >= size_ || index < 0) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return data_[index];
+}
+
+/**
+ * @brief Returns a constant reference to the element at the given index.
+ *
+ * @param index The element index.
+ * @return A constant reference to the element.
+ * @throw std::out_of_range if the index is out of range.
+ */
+const double& S21Vector::operator()(int index) const {
+  if (index >= size_ || index < 0) {
+    throw std::out_of_range("Index out of range.");
+  }
+  return data_[index];
+}
+
+// --- Assignment operators ---
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param other The vector to copy from.
+ * @return A reference to the current vector.
+ */
+S21Vector& S21Vector::operator=(const S21Vector& other) {
+  if (this == &other) {
+    return *this;
+  }
+  S21Vector temp(other);
+  *this = std::move(temp);
+  return *this;
+}
+
+/**
+ * @brief Move assignment operator.
+ *
+ * @param other The vector to move from.
+ * @return A reference to the current vector.
+ */
+S21Vector& S21Vector::operator=(S21Vector&& other) noexcept {
+  if (this != &other) {
+    delete[] data_;
+    size_ = other.size_;
+    data_ = other.data_;
+    other.size_ = 0;
+    other.data_ = nullptr;
+  }
+  return *this;
+}
+
+// --- Operators ---
+
+/**
+ * @brief Calculates the sum of two vectors.
+ *
+ * @param other The vector to add.
+ * @return The sum of the two vectors.
+ */
+S21Vector S21Vector::operator+(const S21Vector& other) const {
+  S21Vector result(*this);
+  result += other;
+  return result;
+}
+
+/**
+ * @brief Calculates the difference of two vectors.
+ *
+ * @param other The vector to subtract.
+ * @return The difference of the two vectors.
+ */
+S21Vector S21Vector::operator-(const S21Vector& other) const {
+  S21Vector result(*this);
+  result -= other;
+  return result;
+}
+
+/**
+ * @brief Scales the vector by a given number.
+ *
+ * @param num The number to scale by.
+ * @return The scaled vector.
+ */
+S21Vector S21Vector::operator*(const double num) const {
+  S21Vector result(*this);
+  result.MulNumber(num);
+  return result;
+}
+
+/**
+ * @brief Compares two vectors for equality within a tolerance of 1e-7.
+ *
+ * @param other The vector to compare against.
+ * @return true if the vectors are equal; false otherwise.
+ */
+bool S21Vector::operator==(const S21Vector& other) const {
+  return EqVector(other);
+}
+
+/**
+ * @brief Adds another vector to this vector in place.
+ *
+ * @param other The vector to add.
+ * @return The current vector.
+ * @exception std::invalid_argument Thrown if the sizes differ.
+ */
+S21Vector& S21Vector::operator+=(const S21Vector& other) {
+  Axpy(1.0, other);
+  return *this;
+}
+
+/**
+ * @brief Subtracts another vector from this vector in place.
+ *
+ * @param other The vector to subtract.
+ * @return The current vector.
+ * @exception std::invalid_argument Thrown if the sizes differ.
+ */
+S21Vector& S21Vector::operator-=(const S21Vector& other) {
+  Axpy(-1.0, other);
+  return *this;
+}
+
+/**
+ * @brief Scales the vector by a given number in place.
+ *
+ * @param num The number to scale by.
+ * @return The current vector.
+ */
+S21Vector& S21Vector::operator*=(const double num) {
+  MulNumber(num);
+  return *this;
+}
+
+// --- Public methods ---
+
+/**
+ * @brief Compares this vector with another one element by element within a
+ * tolerance of 1e-7.
+ *
+ * @param other The vector to compare with.
+ * @return true if the sizes and elements match; false otherwise.
+ */
+bool S21Vector::EqVector(const S21Vector& other) const {
+  if (size_ != other.size_) {
+    return false;
+  }
+  for (int i = 0; i < size_; ++i) {
+    if (std::fabs(data_[i] - other.data_[i]) > 1e-7) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Calculates the dot product with another vector.
+ *
+ * Long vectors are reduced in fixed-size blocks in parallel; the blocks are
+ * combined in a fixed order, so the result is reproducible.
+ *
+ * @param other The second operand.
+ * @return The dot product.
+ * @exception std::invalid_argument Thrown if the sizes differ.
+ */
+double S21Vector::Dot(const S21Vector& other) const {
+  if (size_ != other.size_) {
+    throw std::invalid_argument("Vectors have different sizes for Dot.");
+  }
+  return BlockedDot(data_, other.data_, size_);
+}
+
+/**
+ * @brief Performs the BLAS axpy update: this += alpha * x.
+ *
+ * @param alpha The scale applied to x.
+ * @param x The vector to accumulate.
+ * @exception std::invalid_argument Thrown if the sizes differ.
+ */
+void S21Vector::Axpy(const double alpha, const S21Vector& x) {
+  if (size_ != x.size_) {
+    throw std::invalid_argument("Vectors have different sizes for Axpy.");
+  }
+  if (&x == this) {
+    MulNumber(1.0 + alpha);
+    return;
+  }
+  double* y = data_;
+  const double* src = x.data_;
+  s21_internal::ParallelFor(0, size_, kParallelBlock, [=](int lo, int hi) {
+    s21_internal::AxpyKernel(alpha, src + lo, y + lo, hi - lo);
+  });
+}
+
+/**
+ * @brief Multiplies all elements of the vector by a given number.
+ *
+ * @param num The number to multiply by.
+ */
+void S21Vector::MulNumber(const double num) {
+  for (int i = 0; i < size_; ++i) {
+    data_[i] *= num;
+  }
+}
+
+/**
+ * @brief Calculates the 1-norm (sum of absolute values).
+ *
+ * @return The 1-norm of the vector.
+ */
+double S21Vector::Norm1() const {
+  return s21_internal::AbsSumKernel(data_, size_);
+}
+
+/**
+ * @brief Calculates the Euclidean norm.
+ *
+ * The sum of squares is accumulated directly; if it overflows or underflows,
+ * the computation is repeated on values scaled by the largest magnitude.
+ * A NaN element makes the result NaN.
+ *
+ * @return The 2-norm of the vector.
+ */
+double S21Vector::Norm2() const {
+  double sum = BlockedDot(data_, data_, size_);
+  if (std::isfinite(sum) && sum > 1e-280) {
+    return std::sqrt(sum);
+  }
+  if (std::isnan(sum)) return sum;
+  double scale = NormInf();
+  if (scale == 0.0 || !std::isfinite(scale)) return scale;
+  double scaled = 0.0;
+  for (int i = 0; i < size_; ++i) {
+    double v = data_[i] / scale;
+    scaled += v * v;
+  }
+  return scale * std::sqrt(scaled);
+}
+
+/**
+ * @brief Calculates the infinity norm (largest absolute value).
+ *
+ * @return The infinity norm of the vector.
+ */
+double S21Vector::NormInf() const {
+  return s21_internal::AbsMaxKernel(data_, size_);
+}
@@ -0,0 +1,60 @@
+#ifndef S21_VECTOR_H
+#define S21_VECTOR_H
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+class S21Vector {
+ private:
+  int size_;
+  double* data_;
+
+ public:
+  // -- Constructors, destructor --
+
+  S21Vector();
+  explicit S21Vector(int size);
+  S21Vector(const S21Vector& other);
+  S21Vector(S21Vector&& other) noexcept;
+  ~S21Vector();
+
+  // --- Getters ---
+
+  int get_size() const;
+  double* data();
+  const double* data() const;
+
+  // --- Accessors, mutatators ---
+
+  double& operator()(int index);
+  const double& operator()(int index) const;
+
+  // --- Assignment operators ---
+
+  S21Vector& operator=(const S21Vector& other);
+  S21Vector& operator=(S21Vector&& other) noexcept;
+
+  // --- Overload operators ---
+
+  S21Vector operator+(const S21Vector& other) const;
+  S21Vector operator-(const S21Vector& other) const;
+  S21Vector operator*(const double num) const;
+  bool operator==(const S21Vector& other) const;
+
+  S21Vector& operator+=(const S21Vector& other);
+  S21Vector& operator-=(const S21Vector& other);
+  S21Vector& operator*=(const double num);
+
+  // --- Public methods ---
+
+  bool EqVector(const S21Vector& other) const;
+  double Dot(const S21Vector& other) const;
+  void Axpy(const double alpha, const S21Vector& x);
+  void MulNumber(const double num);
+  double Norm1() const;
+  double Norm2() const;
+  double NormInf() const;
+};
+
+#endif  // S21_VECTOR_H
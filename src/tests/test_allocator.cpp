@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "s21_allocator.h"
+#include "s21_matrix_oop.h"
+
+namespace {
+// Восстанавливает политику по умолчанию после теста
+class PolicyGuard {
+ public:
+  explicit PolicyGuard(const S21AllocationPolicy& policy) {
+    S21Allocator::set_policy(policy);
+  }
+  ~PolicyGuard() { S21Allocator::set_policy(S21AllocationPolicy()); }
+};
+
+S21Matrix Filled(int n) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) m(i, j) = (i * 3 + j) % 7 - 3.0;
+  }
+  return m;
+}
+
+bool AllZero(const S21Matrix& m) {
+  for (double value : m) {
+    if (value != 0.0) return false;
+  }
+  return true;
+}
+}  // namespace
+
+// --- Тестирование политики размещения ---
+TEST(AllocatorSuite, DefaultPolicyDoesNotMap) {
+  // Arrange
+  S21AllocationStats before = S21Allocator::get_stats();
+
+  // Act
+  S21Matrix m(600, 600);
+
+  // Assert
+  ASSERT_EQ(S21Allocator::get_stats().mapped, before.mapped);
+  ASSERT_TRUE(AllZero(m));
+}
+
+TEST(AllocatorSuite, TransparentHugePages) {
+  // Arrange
+  S21AllocationPolicy policy;
+  policy.huge_pages = S21HugePages::kTransparent;
+  policy.min_bytes = 0;
+  PolicyGuard guard(policy);
+  S21AllocationStats before = S21Allocator::get_stats();
+
+  // Act
+  S21Matrix m(300, 300);
+  S21AllocationStats after = S21Allocator::get_stats();
+
+  // Assert: буфер выровнен по 2 МиБ и обнулён
+  ASSERT_EQ(after.mapped, before.mapped + 1);
+  ASSERT_EQ(after.huge_pages_advised + after.fallbacks,
+            before.huge_pages_advised + before.fallbacks + 1);
+  auto address = reinterpret_cast<std::uintptr_t>(std::as_const(m).data());
+  ASSERT_EQ(address % (std::uintptr_t{1} << 21), 0u);
+  ASSERT_TRUE(AllZero(m));
+}
+
+TEST(AllocatorSuite, ExplicitHugePagesFallBack) {
+  // Arrange
+  S21AllocationPolicy policy;
+  policy.huge_pages = S21HugePages::kExplicit;
+  policy.min_bytes = 0;
+  PolicyGuard guard(policy);
+  S21AllocationStats before = S21Allocator::get_stats();
+
+  // Act: без пула hugetlbfs запрос уходит в прозрачные huge pages
+  S21Matrix m(50, 50);
+  m(49, 49) = 1.0;
+  S21AllocationStats after = S21Allocator::get_stats();
+
+  // Assert
+  ASSERT_EQ(after.mapped, before.mapped + 1);
+  ASSERT_GE(after.explicit_huge_pages + after.fallbacks,
+            before.explicit_huge_pages + before.fallbacks + 1);
+  ASSERT_DOUBLE_EQ(m(49, 49), 1.0);
+}
+
+TEST(AllocatorSuite, NumaPlacementOnSingleNode) {
+  for (S21NumaPlacement placement :
+       {S21NumaPlacement::kLocal, S21NumaPlacement::kInterleave}) {
+    // Arrange
+    S21AllocationPolicy policy;
+    policy.placement = placement;
+    policy.min_bytes = 0;
+    PolicyGuard guard(policy);
+    S21AllocationStats before = S21Allocator::get_stats();
+
+    // Act
+    S21Matrix m(40, 40);
+    S21AllocationStats after = S21Allocator::get_stats();
+
+    // Assert: mbind либо применён, либо учтён как откат
+    ASSERT_EQ(after.mapped, before.mapped + 1);
+    ASSERT_EQ(after.numa_bound + after.fallbacks,
+              before.numa_bound + before.fallbacks + 1);
+    ASSERT_TRUE(AllZero(m));
+  }
+}
+
+TEST(AllocatorSuite, MappedMatricesComputeLikeHeapOnes) {
+  // Arrange
+  S21Matrix a = Filled(70);
+  S21Matrix b = Filled(70).Transpose();
+  S21Matrix expected = a * b;
+  S21AllocationPolicy policy;
+  policy.huge_pages = S21HugePages::kTransparent;
+  policy.placement = S21NumaPlacement::kInterleave;
+  policy.min_bytes = 0;
+  S21Matrix result(1, 1);
+
+  // Act
+  {
+    PolicyGuard guard(policy);
+    S21Matrix mapped_a(a);
+    S21Matrix mapped_b(b);
+    result = mapped_a * mapped_b;
+    mapped_a.set_copy_on_write(true);
+    S21Matrix shared(mapped_a);
+    shared(0, 0) += 1.0;
+    ASSERT_DOUBLE_EQ(shared(0, 0), mapped_a(0, 0) + 1.0);
+  }
+
+  // Assert: освобождение после смены политики корректно
+  ASSERT_TRUE(result == expected);
+  result.set_rows(10);
+  ASSERT_EQ(result.get_rows(), 10);
+}
+
+TEST(AllocatorSuite, SmallBuffersStayOnHeap) {
+  // Arrange
+  S21AllocationPolicy policy;
+  policy.huge_pages = S21HugePages::kTransparent;
+  PolicyGuard guard(policy);
+  S21AllocationStats before = S21Allocator::get_stats();
+
+  // Act: меньше min_bytes (2 МиБ по умолчанию)
+  S21Matrix m(100, 100);
+
+  // Assert
+  ASSERT_EQ(S21Allocator::get_stats().mapped, before.mapped);
+  ASSERT_EQ(S21Allocator::get_policy().huge_pages, S21HugePages::kTransparent);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "s21_executor.h"
+#include "s21_matrix_oop.h"
+
+namespace {
+S21Matrix WellConditioned(int n) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      m(i, j) = (i == j) ? n + 1.0 : 1.0 / (1.0 + i + 2 * j);
+    }
+  }
+  return m;
+}
+}  // namespace
+
+// --- Тестирование асинхронного умножения ---
+TEST(AsyncSuite, MulMatrixAsync) {
+  // Arrange
+  S21Matrix a = WellConditioned(70);
+  S21Matrix b = WellConditioned(70);
+  std::vector<double> progress;
+  S21AsyncOptions options;
+  options.progress = [&progress](double p) { progress.push_back(p); };
+
+  // Act
+  std::future<S21Matrix> future = a.MulMatrixAsync(b, options);
+  S21Matrix expected = a * b;
+  a(0, 0) = 1000.0;  // Операнды копируются при вызове
+  S21Matrix result = future.get();
+
+  // Assert
+  ASSERT_TRUE(result == expected);
+  ASSERT_GE(progress.size(), 3u);
+  // Неполная последняя полоса строк и прямоугольные операнды
+  S21Matrix tall(45, 70);
+  S21Matrix wide(70, 33);
+  for (int i = 0; i < 70; ++i) {
+    for (int j = 0; j < 45; ++j) tall(j, i) = 0.01 * (i - j);
+    for (int j = 0; j < 33; ++j) wide(i, j) = 0.02 * (i + j);
+  }
+  ASSERT_TRUE(tall.MulMatrixAsync(wide).get() == tall * wide);
+  ASSERT_TRUE(std::is_sorted(progress.begin(), progress.end()));
+  ASSERT_DOUBLE_EQ(progress.back(), 1.0);
+}
+
+// --- Тестирование отмены ---
+TEST(AsyncSuite, CancelBeforeStart) {
+  std::stop_source source;
+  source.request_stop();
+  S21AsyncOptions options;
+  options.stop_token = source.get_token();
+
+  S21Matrix m = WellConditioned(10);
+  ASSERT_THROW(m.MulMatrixAsync(m, options).get(), S21OperationCancelled);
+  ASSERT_THROW(m.InverseMatrixAsync(options).get(), S21OperationCancelled);
+  ASSERT_THROW(m.CalcComplementsAsync(options).get(), S21OperationCancelled);
+}
+
+TEST(AsyncSuite, CancelAtTileBoundary) {
+  // Arrange: отмена запрашивается из первого отчёта о прогрессе
+  std::stop_source source;
+  std::atomic<int> calls{0};
+  S21AsyncOptions options;
+  options.stop_token = source.get_token();
+  options.progress = [&source, &calls](double) {
+    ++calls;
+    source.request_stop();
+  };
+  S21Matrix m = WellConditioned(100);
+
+  // Act & Assert
+  ASSERT_THROW(m.InverseMatrixAsync(options).get(), S21OperationCancelled);
+  ASSERT_EQ(calls.load(), 1);
+}
+
+// --- Тестирование асинхронного обращения и дополнений ---
+TEST(AsyncSuite, InverseAndComplementsAsync) {
+  // Arrange
+  S21Matrix large = WellConditioned(40);
+  S21Matrix small = WellConditioned(3);
+
+  // Act
+  auto large_inverse = large.InverseMatrixAsync();
+  auto small_inverse = small.InverseMatrixAsync();
+  auto complements = WellConditioned(6).CalcComplementsAsync();
+
+  // Assert
+  ASSERT_TRUE(large_inverse.get() == large.InverseMatrix());
+  ASSERT_TRUE(small_inverse.get() == small.InverseMatrix());
+  ASSERT_TRUE(complements.get() == WellConditioned(6).CalcComplements());
+}
+
+TEST(AsyncSuite, SingularComplementsAsync) {
+  S21Matrix m(4, 4);
+  for (int i = 0; i < 4; ++i) {
+    m(i, 0) = i + 1.0;
+    m(i, 1) = 2.0 * (i + 1.0);
+    m(i, 2) = i * i;
+    m(i, 3) = 1.0;
+  }
+  ASSERT_TRUE(m.CalcComplementsAsync().get() == m.CalcComplements());
+  ASSERT_THROW(m.InverseMatrixAsync().get(), std::invalid_argument);
+}
+
+TEST(AsyncSuite, ThrowsImmediately) {
+  S21Matrix rect(2, 3);
+  ASSERT_THROW(rect.MulMatrixAsync(rect), std::invalid_argument);
+  ASSERT_THROW(rect.InverseMatrixAsync(), std::invalid_argument);
+  ASSERT_THROW(rect.CalcComplementsAsync(), std::invalid_argument);
+}
+
+// --- Тестирование пула потоков ---
+TEST(AsyncSuite, ExecutorRunsTasks) {
+  S21Executor executor(2);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 10; ++i) {
+    results.push_back(executor.Submit([i]() { return i * i; }));
+  }
+  int sum = 0;
+  for (auto& r : results) sum += r.get();
+  ASSERT_EQ(sum, 285);
+  ASSERT_EQ(executor.get_threads(), 2);
+  ASSERT_THROW(S21Executor(0), std::invalid_argument);
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "s21_backend.h"
+#include "s21_executor.h"
+#include "s21_expression.h"
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+#include "s21_process_pool.h"
+#include "test_helpers.h"
+
+namespace {
+// Восстанавливает выбранный бэкенд по завершении теста
+class BackendGuard {
+ public:
+  BackendGuard() : saved_(S21LinearAlgebra::get_backend()) {}
+  ~BackendGuard() { S21LinearAlgebra::set_backend(saved_); }
+
+ private:
+  S21Backend saved_;
+};
+}  // namespace
+
+// --- Тестирование встроенного бэкенда ---
+TEST(BackendSuite, BuiltinRoutesNothing) {
+  // Arrange
+  BackendGuard guard;
+  S21LinearAlgebra::set_backend(S21Backend::kBuiltin);
+  S21Matrix a = DominantMatrix(64, 64, 1);
+  S21BackendStats before = S21LinearAlgebra::get_stats();
+
+  // Act
+  S21Matrix product = a * a;
+  double det = a.Determinant();
+  S21BackendStats after = S21LinearAlgebra::get_stats();
+
+  // Assert
+  ASSERT_EQ(S21LinearAlgebra::get_backend(), S21Backend::kBuiltin);
+  ASSERT_TRUE(S21LinearAlgebra::IsAvailable(S21Backend::kBuiltin));
+  ASSERT_EQ(after.system_calls, before.system_calls);
+  ASSERT_EQ(after.fallbacks, before.fallbacks);
+  ASSERT_NE(det, 0.0);
+  ASSERT_EQ(product.get_rows(), 64);
+}
+
+// --- Тестирование совпадения результатов OpenBLAS и встроенных ядер ---
+TEST(BackendSuite, OpenBlasMatchesBuiltin) {
+  // Arrange
+  BackendGuard guard;
+  S21Matrix a = DominantMatrix(96, 80, 2);
+  S21Matrix b = DominantMatrix(80, 96, 3);
+  S21Matrix square = DominantMatrix(70, 70, 4);
+  S21Matrix c = DominantMatrix(96, 96, 5);
+  S21Matrix c_builtin = c;
+  S21LinearAlgebra::set_backend(S21Backend::kBuiltin);
+  S21Matrix product_builtin = a * b;
+  S21Matrix::Gemm(0.5, b, a, -2.0, c_builtin, S21Transpose::kTranspose,
+                  S21Transpose::kTranspose);
+  double det_builtin = square.Determinant();
+  S21Matrix inverse_builtin = square.InverseMatrix();
+
+  // Act
+  S21LinearAlgebra::set_backend(S21Backend::kOpenBlas);
+  if (!S21LinearAlgebra::IsAvailable(S21Backend::kOpenBlas)) {
+    ASSERT_EQ(S21LinearAlgebra::get_backend(), S21Backend::kBuiltin);
+    GTEST_SKIP() << "OpenBLAS is not installed";
+  }
+  S21BackendStats before = S21LinearAlgebra::get_stats();
+  S21Matrix product = a * b;
+  S21Matrix::Gemm(0.5, b, a, -2.0, c, S21Transpose::kTranspose,
+                  S21Transpose::kTranspose);
+  // Копия без кэша LU, чтобы разложение выполнил LAPACK
+  S21Matrix fresh = square;
+  fresh(0, 0) += 0.0;
+  double det = fresh.Determinant();
+  S21Matrix inverse = fresh.InverseMatrix();
+  S21BackendStats after = S21LinearAlgebra::get_stats();
+
+  // Assert
+  ASSERT_EQ(S21LinearAlgebra::get_backend(), S21Backend::kOpenBlas);
+  ASSERT_GE(after.system_calls - before.system_calls, 4u);
+  for (int i = 0; i < 96; ++i) {
+    for (int j = 0; j < 96; ++j) {
+      ASSERT_NEAR(product(i, j), product_builtin(i, j), 1e-9);
+      ASSERT_NEAR(c(i, j), c_builtin(i, j), 1e-9);
+    }
+  }
+  ASSERT_NEAR(det / det_builtin, 1.0, 1e-10);
+  for (int i = 0; i < 70; ++i) {
+    for (int j = 0; j < 70; ++j) {
+      ASSERT_NEAR(inverse(i, j), inverse_builtin(i, j), 1e-12);
+    }
+  }
+}
+
+// --- Тестирование вырожденной матрицы через OpenBLAS ---
+TEST(BackendSuite, OpenBlasSingular) {
+  // Arrange
+  BackendGuard guard;
+  S21LinearAlgebra::set_backend(S21Backend::kOpenBlas);
+  S21Matrix a = DominantMatrix(40, 40, 6);
+  for (int j = 0; j < 40; ++j) a(39, j) = a(0, j) + a(1, j);
+
+  // Act & Assert: определитель мал относительно произведения диагонали
+  ASSERT_LT(std::fabs(a.Determinant()), 1e-10 * std::pow(41.0, 40));
+  ASSERT_THROW(a.InverseMatrix(), std::invalid_argument);
+}
+
+// --- Тестирование ограничения потоков при OpenBLAS ---
+TEST(BackendSuite, ThreadLimitKeepsBuiltin) {
+  // Arrange: многопоточный OpenBLAS не видит ограничение потоков
+  BackendGuard guard;
+  S21LinearAlgebra::set_backend(S21Backend::kOpenBlas);
+  if (!S21LinearAlgebra::IsAvailable(S21Backend::kOpenBlas)) {
+    GTEST_SKIP() << "OpenBLAS is not installed";
+  }
+  S21Matrix a = DominantMatrix(96, 96, 7);
+  S21Matrix b = DominantMatrix(96, 96, 8);
+  S21Matrix expected = a * b;
+  S21Expression la(a), lb(b);
+  S21Executor executor(2);
+  S21ProcessPool pool(2);
+
+  // Act
+  S21BackendStats before = S21LinearAlgebra::get_stats();
+  S21Matrix limited(1, 1);
+  {
+    s21_internal::ScopedThreadLimit limit(1);
+    limited = a * b;
+    S21Matrix fresh = a;
+    fresh.Determinant();
+  }
+  std::vector<S21Matrix> values =
+      S21Expression::Eval({la * lb, lb * la}, executor);
+  S21Matrix pooled = pool.Multiply(a, b);
+  S21BackendStats after = S21LinearAlgebra::get_stats();
+
+  // Assert
+  ASSERT_EQ(after.system_calls, before.system_calls);
+  ASSERT_EQ(after.fallbacks, before.fallbacks);
+  for (const S21Matrix* m : {&limited, &values[0], &pooled}) {
+    for (int i = 0; i < 96; ++i) {
+      for (int j = 0; j < 96; ++j) {
+        ASSERT_NEAR((*m)(i, j), expected(i, j), 1e-9);
+      }
+    }
+  }
+  S21Matrix unlimited = a * b;
+  ASSERT_GT(S21LinearAlgebra::get_stats().system_calls, after.system_calls);
+  ASSERT_NEAR(unlimited(5, 7), expected(5, 7), 1e-9);
+}
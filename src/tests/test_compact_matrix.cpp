@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "s21_compact_matrix.h"
+#include "test_helpers.h"
+
+namespace {
+// Матрица модулей элементов
+S21Matrix Abs(const S21Matrix& m) {
+  S21Matrix result = m;
+  for (int i = 0; i < m.get_rows(); ++i) {
+    for (int j = 0; j < m.get_cols(); ++j) result(i, j) = std::fabs(m(i, j));
+  }
+  return result;
+}
+
+// Проверка |actual - expected| <= bound поэлементно
+void ExpectWithin(const S21Matrix& actual, const S21Matrix& expected,
+                  const S21Matrix& bound) {
+  for (int i = 0; i < expected.get_rows(); ++i) {
+    for (int j = 0; j < expected.get_cols(); ++j) {
+      ASSERT_LE(std::fabs(actual(i, j) - expected(i, j)), bound(i, j));
+    }
+  }
+}
+}  // namespace
+
+// --- Тестирование округления при сохранении ---
+TEST(CompactMatrixSuite, RoundingToSixteenBits) {
+  // Arrange
+  constexpr S21Precision kHalf = S21Precision::kHalf;
+  constexpr S21Precision kBf16 = S21Precision::kBFloat16;
+  double inf = std::numeric_limits<double>::infinity();
+
+  // Act & Assert
+  // Середина между соседними числами округляется к чётному
+  ASSERT_EQ(S21CompactMatrix::Round(1.0 + 0x1p-11, kHalf), 1.0);
+  ASSERT_EQ(S21CompactMatrix::Round(1.0 + 3 * 0x1p-11, kHalf), 1.0 + 0x1p-9);
+  ASSERT_EQ(S21CompactMatrix::Round(1.0 + 0x1p-11 + 0x1p-40, kHalf),
+            1.0 + 0x1p-10);
+  ASSERT_EQ(S21CompactMatrix::Round(65504.0, kHalf), 65504.0);
+  ASSERT_EQ(S21CompactMatrix::Round(65519.0, kHalf), 65504.0);
+  ASSERT_EQ(S21CompactMatrix::Round(65520.0, kHalf), inf);
+  ASSERT_EQ(S21CompactMatrix::Round(-1e6, kHalf), -inf);
+  // Субнормальные числа binary16
+  ASSERT_EQ(S21CompactMatrix::Round(0x1p-24, kHalf), 0x1p-24);
+  ASSERT_EQ(S21CompactMatrix::Round(3 * 0x1p-25, kHalf), 0x1p-23);
+  ASSERT_EQ(S21CompactMatrix::Round(0x1p-25, kHalf), 0.0);
+  ASSERT_TRUE(std::isnan(S21CompactMatrix::Round(NAN, kHalf)));
+  // bfloat16 сохраняет диапазон float
+  ASSERT_EQ(S21CompactMatrix::Round(1e30, kBf16), 0x1.94p+99);
+  ASSERT_EQ(S21CompactMatrix::Round(1.0 + 0x1p-8, kBf16), 1.0);
+  ASSERT_EQ(S21CompactMatrix::Round(-(1.0 + 3 * 0x1p-8), kBf16),
+            -(1.0 + 0x1p-6));
+  ASSERT_TRUE(std::isnan(S21CompactMatrix::Round(NAN, kBf16)));
+  // Граница относительной погрешности
+  std::mt19937 engine(1);
+  std::uniform_real_distribution<double> uniform(-1000.0, 1000.0);
+  for (int i = 0; i < 10000; ++i) {
+    double x = uniform(engine);
+    for (S21Precision p : {kHalf, kBf16}) {
+      ASSERT_LE(std::fabs(S21CompactMatrix::Round(x, p) - x),
+                S21CompactMatrix::UnitRoundoff(p) * std::fabs(x));
+    }
+  }
+}
+
+// --- Тестирование хранения и обратного преобразования ---
+TEST(CompactMatrixSuite, StorageAndConversion) {
+  // Arrange
+  S21Matrix dense = RandomMatrix(13, 21, 2);
+  dense(0, 0) = 1e-6;
+
+  for (bool simd : {false, true}) {
+    S21CompactMatrix::set_simd_enabled(simd);
+    for (S21Precision p : {S21Precision::kHalf, S21Precision::kBFloat16}) {
+      // Act
+      S21CompactMatrix compact(dense, p);
+      compact.Set(12, 20, 0.1);
+      S21Matrix widened = compact.ToDense();
+
+      // Assert
+      ASSERT_EQ(compact.get_rows(), 13);
+      ASSERT_EQ(compact.get_precision(), p);
+      ASSERT_EQ(compact(12, 20), S21CompactMatrix::Round(0.1, p));
+      for (int i = 0; i < 13; ++i) {
+        for (int j = 0; j < 21; ++j) {
+          ASSERT_EQ(widened(i, j), compact(i, j));
+          if (i < 12 || j < 20) {
+            ASSERT_EQ(widened(i, j), S21CompactMatrix::Round(dense(i, j), p));
+          }
+        }
+      }
+      // Повторное сжатие расширенной матрицы ничего не меняет
+      ASSERT_EQ(S21CompactMatrix(widened, p).ToDense(), widened);
+    }
+  }
+  S21CompactMatrix::set_simd_enabled(true);
+  S21CompactMatrix compact(2, 2, S21Precision::kHalf);
+  ASSERT_THROW(compact(2, 0), std::out_of_range);
+  ASSERT_THROW(compact.Set(0, -1, 1.0), std::out_of_range);
+  ASSERT_THROW(S21CompactMatrix(0, 3, S21Precision::kHalf),
+               std::invalid_argument);
+}
+
+// --- Тестирование умножения в пределах оценки погрешности ---
+TEST(CompactMatrixSuite, ProductsWithinErrorBounds) {
+  // Arrange
+  S21Matrix a = RandomMatrix(67, 301, 3);
+  S21Matrix b = RandomMatrix(301, 45, 4);
+  S21Vector x(301);
+  for (int i = 0; i < 301; ++i) x(i) = b(i, 0);
+  S21Matrix magnitude = Abs(a) * Abs(b);
+  double eps = 301 * 0x1p-53;
+
+  for (bool simd : {false, true}) {
+    S21CompactMatrix::set_simd_enabled(simd);
+    for (S21Precision p : {S21Precision::kHalf, S21Precision::kBFloat16}) {
+      double u = S21CompactMatrix::UnitRoundoff(p);
+      S21CompactMatrix ca(a, p);
+      S21CompactMatrix cb(b, p);
+
+      // Act
+      S21Matrix mixed = ca.MulMatrix(b);
+      S21Matrix compact = ca.MulMatrix(cb);
+      S21Vector column = ca.MulVector(x);
+
+      // Assert
+      ExpectWithin(mixed, a * b, magnitude * (u + eps));
+      ExpectWithin(compact, a * b, magnitude * (2 * u + u * u + eps));
+      // Относительно сохранённых значений — точность double
+      ExpectWithin(compact, ca.ToDense() * cb.ToDense(), magnitude * eps);
+      for (int i = 0; i < 67; ++i) {
+        ASSERT_NEAR(column(i), mixed(i, 0), magnitude(i, 0) * eps);
+      }
+    }
+  }
+  S21CompactMatrix::set_simd_enabled(true);
+  S21CompactMatrix ca(a, S21Precision::kHalf);
+  ASSERT_THROW(ca.MulMatrix(a), std::invalid_argument);
+  ASSERT_THROW(ca.MulMatrix(S21CompactMatrix(a, S21Precision::kHalf)),
+               std::invalid_argument);
+  ASSERT_THROW(ca.MulVector(S21Vector(67)), std::invalid_argument);
+}
+
+// --- Тестирование поэлементных операций ---
+TEST(CompactMatrixSuite, ElementwiseRoundOnce) {
+  // Arrange
+  S21Matrix a = RandomMatrix(30, 17, 5);
+  S21Matrix b = RandomMatrix(30, 17, 6);
+  S21CompactMatrix ca(a, S21Precision::kHalf);
+  S21CompactMatrix cb(b, S21Precision::kBFloat16);
+  S21Matrix wa = ca.ToDense();
+  S21Matrix wb = cb.ToDense();
+  S21Matrix product = wa;
+  product.HadamardMul(wb);
+
+  // Act
+  S21CompactMatrix sum = ca.SumMatrix(cb);
+  S21CompactMatrix difference = ca.SubMatrix(cb);
+  S21CompactMatrix hadamard = ca.HadamardMul(cb);
+  S21CompactMatrix scaled = ca.MulNumber(3.0);
+
+  // Assert: результат в формате левого операнда, округлён один раз
+  ASSERT_EQ(sum.get_precision(), S21Precision::kHalf);
+  for (int i = 0; i < 30; ++i) {
+    for (int j = 0; j < 17; ++j) {
+      ASSERT_EQ(sum(i, j), S21CompactMatrix::Round(wa(i, j) + wb(i, j),
+                                                   S21Precision::kHalf));
+      ASSERT_EQ(difference(i, j),
+                S21CompactMatrix::Round(wa(i, j) - wb(i, j),
+                                        S21Precision::kHalf));
+      ASSERT_EQ(hadamard(i, j),
+                S21CompactMatrix::Round(product(i, j), S21Precision::kHalf));
+      ASSERT_EQ(scaled(i, j),
+                S21CompactMatrix::Round(3.0 * wa(i, j), S21Precision::kHalf));
+    }
+  }
+  ASSERT_THROW(ca.SumMatrix(S21CompactMatrix(17, 30, S21Precision::kHalf)),
+               std::invalid_argument);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+S21Matrix Filled(int rows, int cols) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = i * cols + j;
+  }
+  return m;
+}
+
+const double* Storage(const S21Matrix& m) { return m.data(); }
+}  // namespace
+
+// --- Тестирование копирования при записи ---
+TEST(CopyOnWriteSuite, CopiesShareUntilWrite) {
+  // Arrange
+  S21Matrix source = Filled(8, 8);
+  source.set_copy_on_write(true);
+
+  // Act
+  S21Matrix copy(source);
+  S21Matrix assigned(2, 2);
+  assigned = source;
+
+  // Assert
+  ASSERT_TRUE(copy.get_copy_on_write());
+  ASSERT_EQ(Storage(copy), Storage(source));
+  ASSERT_EQ(Storage(assigned), Storage(source));
+
+  copy(0, 0) = -1.0;
+  ASSERT_NE(Storage(copy), Storage(source));
+  ASSERT_DOUBLE_EQ(source(0, 0), 0.0);
+  ASSERT_DOUBLE_EQ(assigned(0, 0), 0.0);
+  ASSERT_DOUBLE_EQ(copy(0, 0), -1.0);
+  ASSERT_TRUE(copy.EqMatrix(copy));
+}
+
+TEST(CopyOnWriteSuite, MutatingPathsDetach) {
+  // Arrange
+  S21Matrix source = Filled(5, 5);
+  source.set_copy_on_write(true);
+  S21Matrix expected = Filled(5, 5);
+
+  // Act
+  S21Matrix summed(source);
+  summed.SumMatrix(source);
+  S21Matrix scaled(source);
+  scaled.MulNumber(2.0);
+  S21Matrix resized(source);
+  resized.set_cols(6);
+  S21Matrix through_data(source);
+  through_data.data()[0] = 42.0;
+
+  // Assert
+  ASSERT_TRUE(source == expected);
+  ASSERT_TRUE(summed == scaled);
+  ASSERT_DOUBLE_EQ(resized(4, 4), 24.0);
+  ASSERT_DOUBLE_EQ(resized(4, 5), 0.0);
+  ASSERT_DOUBLE_EQ(through_data(0, 0), 42.0);
+}
+
+TEST(CopyOnWriteSuite, DisabledByDefault) {
+  // Arrange
+  S21Matrix source = Filled(8, 8);
+
+  // Act
+  S21Matrix copy(source);
+
+  // Assert
+  ASSERT_FALSE(copy.get_copy_on_write());
+  ASSERT_NE(Storage(copy), Storage(source));
+}
+
+TEST(CopyOnWriteSuite, LastOwnerKeepsBuffer) {
+  // Arrange
+  S21Matrix source = Filled(6, 6);
+  source.set_copy_on_write(true);
+  const double* buffer = Storage(source);
+
+  // Act: единственный оставшийся владелец пишет без копирования
+  { S21Matrix temporary(source); }
+  source(1, 1) = 3.5;
+
+  // Assert
+  ASSERT_EQ(Storage(source), buffer);
+}
+
+TEST(CopyOnWriteSuite, ConcurrentCopiesAndWrites) {
+  // Arrange
+  S21Matrix source = Filled(32, 32);
+  source.set_copy_on_write(true);
+  S21Matrix expected = Filled(32, 32);
+  const int kThreads = 8;
+  std::vector<int> ok(kThreads, 0);
+
+  // Act: потоки копируют общий источник, изменяют и уничтожают копии
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&source, &ok, t]() {
+      bool good = true;
+      for (int round = 0; round < 200; ++round) {
+        S21Matrix copy(source);
+        S21Matrix second(copy);
+        copy(t, t) = -t - 1.0;
+        good = good && copy(t, t) == -t - 1.0 &&
+               second(t, t) == t * 32 + t;
+      }
+      ok[t] = good;
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // Assert
+  for (int t = 0; t < kThreads; ++t) ASSERT_TRUE(ok[t]);
+  ASSERT_TRUE(source == expected);
+}
+
+// --- Тестирование наследования режима при присваивании ---
+TEST(CopyOnWriteSuite, AssignmentInheritsMode) {
+  // Arrange
+  S21Matrix source = Filled(6, 6);
+  source.set_copy_on_write(true);
+  S21Matrix assigned(2, 2);
+  S21Matrix moved(2, 2);
+  S21Matrix own = Filled(6, 6);
+  own.set_copy_on_write(true);
+
+  // Act
+  assigned = source;
+  moved = S21Matrix(source);
+  S21Matrix copy_of_copy(assigned);
+  own.set_rows(7);
+  own.set_cols(5);
+  own.MulMatrix(Filled(5, 5));
+
+  // Assert
+  ASSERT_TRUE(assigned.get_copy_on_write());
+  ASSERT_TRUE(moved.get_copy_on_write());
+  ASSERT_EQ(Storage(copy_of_copy), Storage(source));
+  // Операции на месте сохраняют режим матрицы
+  ASSERT_TRUE(own.get_copy_on_write());
+  S21Matrix plain = Filled(3, 3);
+  plain = S21Matrix(3, 3);
+  ASSERT_FALSE(plain.get_copy_on_write());
+}
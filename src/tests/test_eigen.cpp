@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "s21_eigen.h"
+
+namespace {
+// Случайная симметричная матрица n x n
+S21Matrix RandomSymmetric(int n, unsigned seed) {
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      m(i, j) = uniform(engine);
+      m(j, i) = m(i, j);
+    }
+  }
+  return m;
+}
+
+// Максимум |A * v_j - l_j * v_j| по всем парам
+double MaxResidual(const S21Matrix& a, const S21EigenDecomposition& eigen) {
+  int n = a.get_rows();
+  double worst = 0.0;
+  for (int j = 0; j < eigen.vectors.get_cols(); ++j) {
+    for (int i = 0; i < n; ++i) {
+      double sum = 0.0;
+      for (int k = 0; k < n; ++k) sum += a(i, k) * eigen.vectors(k, j);
+      worst = std::max(worst,
+                       std::fabs(sum - eigen.values(j) * eigen.vectors(i, j)));
+    }
+  }
+  return worst;
+}
+
+// Максимальное отклонение Q^T * Q от единичной матрицы
+double OrthogonalityError(const S21Matrix& q) {
+  double worst = 0.0;
+  for (int a = 0; a < q.get_cols(); ++a) {
+    for (int b = 0; b < q.get_cols(); ++b) {
+      double dot = 0.0;
+      for (int i = 0; i < q.get_rows(); ++i) dot += q(i, a) * q(i, b);
+      worst = std::max(worst, std::fabs(dot - (a == b ? 1.0 : 0.0)));
+    }
+  }
+  return worst;
+}
+}  // namespace
+
+// --- Тестирование полного спектра симметричной матрицы ---
+TEST(EigenSuite, SymmetricKnownSpectrum) {
+  // Arrange: трёхдиагональная матрица (2, -1) с известными собственными
+  // значениями 2 - 2 cos(k pi / (n + 1))
+  int n = 8;
+  S21Matrix a(n, n);
+  for (int i = 0; i < n; ++i) {
+    a(i, i) = 2.0;
+    if (i + 1 < n) a(i, i + 1) = a(i + 1, i) = -1.0;
+  }
+
+  // Act
+  S21EigenDecomposition eigen = S21Eigen::Symmetric(a);
+  S21EigenDecomposition values = S21Eigen::Symmetric(a, false);
+
+  // Assert
+  for (int k = 0; k < n; ++k) {
+    double expected = 2.0 - 2.0 * std::cos((k + 1) * M_PI / (n + 1));
+    ASSERT_NEAR(eigen.values(k), expected, 1e-12);
+    ASSERT_NEAR(values.values(k), expected, 1e-12);
+  }
+  ASSERT_LT(MaxResidual(a, eigen), 1e-12);
+  ASSERT_LT(OrthogonalityError(eigen.vectors), 1e-12);
+  ASSERT_EQ(values.vectors.get_rows(), 1);
+}
+
+// --- Тестирование разложения случайной матрицы и вырожденных случаев ---
+TEST(EigenSuite, SymmetricRandomAndDegenerate) {
+  // Arrange
+  S21Matrix a = RandomSymmetric(60, 7);
+  S21Matrix identity(5, 5);
+  for (int i = 0; i < 5; ++i) identity(i, i) = 3.0;
+  S21Matrix single(1, 1);
+  single(0, 0) = -4.0;
+
+  // Act
+  S21EigenDecomposition eigen = S21Eigen::Symmetric(a);
+  S21EigenDecomposition repeated = S21Eigen::Symmetric(identity);
+  S21EigenDecomposition scalar = S21Eigen::Symmetric(single);
+
+  // Assert
+  ASSERT_LT(MaxResidual(a, eigen), 1e-11);
+  ASSERT_LT(OrthogonalityError(eigen.vectors), 1e-12);
+  double trace = 0.0;
+  for (int i = 0; i < 60; ++i) {
+    trace += a(i, i) - eigen.values(i);
+    if (i > 0) {
+      ASSERT_LE(eigen.values(i - 1), eigen.values(i));
+    }
+  }
+  ASSERT_NEAR(trace, 0.0, 1e-11);
+  for (int i = 0; i < 5; ++i) ASSERT_DOUBLE_EQ(repeated.values(i), 3.0);
+  ASSERT_LT(OrthogonalityError(repeated.vectors), 1e-14);
+  ASSERT_DOUBLE_EQ(scalar.values(0), -4.0);
+  ASSERT_DOUBLE_EQ(std::fabs(scalar.vectors(0, 0)), 1.0);
+}
+
+// --- Тестирование метода Ланцоша на крайних собственных значениях ---
+TEST(EigenSuite, LanczosMatchesFullSpectrum) {
+  // Arrange
+  int n = 200;
+  S21Matrix a = RandomSymmetric(n, 11);
+  S21Vector all = S21Eigen::Symmetric(a, false).values;
+
+  // Act
+  S21EigenDecomposition largest = S21Eigen::Lanczos(a, 4);
+  S21LanczosOptions options;
+  options.end = S21SpectrumEnd::kSmallest;
+  S21EigenDecomposition smallest = S21Eigen::Lanczos(a, 3, options);
+  options.end = S21SpectrumEnd::kLargestMagnitude;
+  S21EigenDecomposition magnitude = S21Eigen::Lanczos(a, 2, options);
+
+  // Assert
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_NEAR(largest.values(i), all(n - 1 - i), 1e-8);
+  }
+  for (int i = 0; i < 3; ++i) ASSERT_NEAR(smallest.values(i), all(i), 1e-8);
+  double top = std::max(std::fabs(all(0)), std::fabs(all(n - 1)));
+  ASSERT_NEAR(std::fabs(magnitude.values(0)), top, 1e-8);
+  ASSERT_EQ(largest.vectors.get_rows(), n);
+  ASSERT_EQ(largest.vectors.get_cols(), 4);
+  ASSERT_LT(MaxResidual(a, largest), 1e-6);
+  ASSERT_LT(OrthogonalityError(largest.vectors), 1e-10);
+}
+
+// --- Тестирование метода Ланцоша на кратных собственных значениях ---
+TEST(EigenSuite, LanczosRepeatedEigenvalues) {
+  // Arrange: diag(5, 5, 5, 1, 1, ...) — подпространство Крылова
+  // вырождается после первого шага
+  int n = 30;
+  S21Matrix a(n, n);
+  for (int i = 0; i < n; ++i) a(i, i) = i < 3 ? 5.0 : 1.0;
+
+  // Act
+  S21EigenDecomposition eigen = S21Eigen::Lanczos(a, 3);
+
+  // Assert
+  for (int i = 0; i < 3; ++i) ASSERT_NEAR(eigen.values(i), 5.0, 1e-10);
+  ASSERT_LT(MaxResidual(a, eigen), 1e-8);
+  ASSERT_LT(OrthogonalityError(eigen.vectors), 1e-10);
+}
+
+// --- Тестирование рандомизированного SVD на матрице малого ранга ---
+TEST(EigenSuite, RandomizedSvdLowRank) {
+  // Arrange: A = U diag(10, 5, 1, 0.1) V^T размера 120 x 80
+  int m = 120, n = 80, rank = 4;
+  double sigma[] = {10.0, 5.0, 1.0, 0.1};
+  S21Matrix u = RandomSymmetric(m, 3);
+  S21Matrix v = RandomSymmetric(n, 5);
+  S21Matrix left = S21Eigen::Symmetric(u).vectors;
+  S21Matrix right = S21Eigen::Symmetric(v).vectors;
+  S21Matrix a(m, n);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      for (int r = 0; r < rank; ++r) {
+        a(i, j) += left(i, r) * sigma[r] * right(j, r);
+      }
+    }
+  }
+
+  // Act
+  S21SingularValueDecomposition svd = S21Eigen::RandomizedSvd(a, 3);
+  S21Matrix transposed = a.Transpose();
+  S21SingularValueDecomposition svd_t = S21Eigen::RandomizedSvd(transposed, 4);
+
+  // Assert
+  for (int r = 0; r < 3; ++r) ASSERT_NEAR(svd.values(r), sigma[r], 1e-10);
+  for (int r = 0; r < 4; ++r) ASSERT_NEAR(svd_t.values(r), sigma[r], 1e-10);
+  ASSERT_LT(OrthogonalityError(svd.left), 1e-12);
+  ASSERT_LT(OrthogonalityError(svd.right), 1e-12);
+  double error = 0.0;
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      double sum = 0.0;
+      for (int r = 0; r < 4; ++r) {
+        sum += svd_t.right(i, r) * svd_t.values(r) * svd_t.left(j, r);
+      }
+      error = std::max(error, std::fabs(sum - a(i, j)));
+    }
+  }
+  ASSERT_LT(error, 1e-10);
+}
+
+// --- Тестирование относительной проверки симметрии ---
+TEST(EigenSuite, SymmetryIsRelative) {
+  // Arrange: погрешность порядка ulp на масштабе 1e12 допустима
+  S21Matrix large = RandomSymmetric(6, 13) * 1e12;
+  large(1, 4) = std::nextafter(large(1, 4), INFINITY);
+  // На масштабе 1e-12 асимметрия 1e-13 составляет десятую часть элемента
+  S21Matrix tiny(2, 2);
+  tiny(0, 0) = 1e-12;
+  tiny(1, 1) = 2e-12;
+  tiny(0, 1) = 5e-13;
+  tiny(1, 0) = 6e-13;
+  S21Matrix b = RandomSymmetric(5, 17);
+  b(0, 3) += 0.5;
+
+  // Act & Assert
+  S21EigenDecomposition eigen = S21Eigen::Symmetric(large, false);
+  ASSERT_EQ(eigen.values.get_size(), 6);
+  ASSERT_THROW(S21Eigen::Symmetric(tiny), std::invalid_argument);
+  ASSERT_NO_THROW(S21Eigen::Symmetric(b.Transpose() * b));
+}
+
+// --- Тестирование ошибок ---
+TEST(EigenSuite, InvalidArguments) {
+  // Arrange
+  S21Matrix rectangular(2, 3);
+  S21Matrix asymmetric(2, 2);
+  asymmetric(0, 1) = 1.0;
+  S21Matrix square = RandomSymmetric(4, 1);
+  S21Matrix infinite(2, 2);
+  infinite(0, 0) = INFINITY;
+
+  // Act & Assert
+  ASSERT_THROW(S21Eigen::Symmetric(rectangular), std::invalid_argument);
+  ASSERT_THROW(S21Eigen::Symmetric(asymmetric), std::invalid_argument);
+  ASSERT_THROW(S21Eigen::Symmetric(infinite), std::invalid_argument);
+  ASSERT_THROW(S21Eigen::Lanczos(square, 0), std::invalid_argument);
+  ASSERT_THROW(S21Eigen::Lanczos(square, 5), std::invalid_argument);
+  ASSERT_THROW(S21Eigen::RandomizedSvd(rectangular, 3), std::invalid_argument);
+  S21RandomizedSvdOptions options;
+  options.power_iterations = -1;
+  ASSERT_THROW(S21Eigen::RandomizedSvd(square, 2, options),
+               std::invalid_argument);
+}
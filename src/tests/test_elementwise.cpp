@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+// Матрица 2x3: [[1, -2, 3], [-4, 5, -6]]
+S21Matrix Small() {
+  S21Matrix m(2, 3);
+  double value = 1.0;
+  for (double& x : m) {
+    x = value;
+    value = value > 0 ? -(value + 1) : -value + 1;
+  }
+  return m;
+}
+
+// Большая матрица, сумма которой чувствительна к порядку сложения
+S21Matrix Large(int rows, int cols) {
+  S21Matrix m(rows, cols);
+  long k = 0;
+  for (double& x : m) {
+    x = (k % 3 == 0 ? 1e8 : 1.0) * std::sin(0.37 * static_cast<double>(k));
+    ++k;
+  }
+  return m;
+}
+}  // namespace
+
+// --- Тестирование Map, ZipMap и Apply ---
+TEST(ElementwiseSuite, MapZipMapApply) {
+  // Arrange
+  S21Matrix a = Small();
+  S21Matrix b = Small();
+
+  // Act
+  S21Matrix squares = a.Map([](double x) { return x * x; });
+  S21Matrix sums = a.ZipMap(b, [](double x, double y) { return x + y; });
+  b.Apply([](double x) { return -x; });
+
+  // Assert
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      ASSERT_DOUBLE_EQ(squares(i, j), a(i, j) * a(i, j));
+      ASSERT_DOUBLE_EQ(sums(i, j), 2.0 * a(i, j));
+      ASSERT_DOUBLE_EQ(b(i, j), -a(i, j));
+    }
+  }
+  ASSERT_THROW(a.ZipMap(S21Matrix(3, 2), std::plus<double>()),
+               std::invalid_argument);
+}
+
+// --- Тестирование Reduce с пользовательской операцией ---
+TEST(ElementwiseSuite, ReduceCustom) {
+  // Arrange
+  S21Matrix a = Small();
+
+  // Act
+  long positives = a.Reduce(0L, std::plus<long>(),
+                            [](double x) { return x > 0 ? 1L : 0L; });
+  double product = a.Reduce(1.0, std::multiplies<double>());
+  double largest_abs = a.Reduce(
+      0.0, [](double x, double y) { return std::fmax(x, y); },
+      [](double x) { return std::fabs(x); }, false);
+
+  // Assert
+  ASSERT_EQ(positives, 3);
+  ASSERT_DOUBLE_EQ(product, -720.0);
+  ASSERT_DOUBLE_EQ(largest_abs, 6.0);
+}
+
+// --- Тестирование встроенных редукций и норм ---
+TEST(ElementwiseSuite, BuiltInReductions) {
+  // Arrange
+  S21Matrix a = Small();
+  S21Matrix square(2, 2);
+  square(0, 0) = 3.0;
+  square(0, 1) = 7.0;
+  square(1, 0) = -1.0;
+  square(1, 1) = 4.0;
+
+  // Act & Assert
+  ASSERT_DOUBLE_EQ(a.Sum(), -3.0);
+  ASSERT_DOUBLE_EQ(a.Min(), -6.0);
+  ASSERT_DOUBLE_EQ(a.Max(), 5.0);
+  ASSERT_DOUBLE_EQ(a.Norm1(), 9.0);
+  ASSERT_DOUBLE_EQ(a.NormInf(), 15.0);
+  ASSERT_DOUBLE_EQ(a.NormFrobenius(), std::sqrt(91.0));
+  ASSERT_DOUBLE_EQ(a.NormMax(), 6.0);
+  ASSERT_DOUBLE_EQ(square.Trace(), 7.0);
+  ASSERT_THROW(a.Trace(), std::invalid_argument);
+}
+
+// --- Тестирование воспроизводимости и точности суммирования ---
+TEST(ElementwiseSuite, ReductionIsReproducible) {
+  // Arrange
+  S21Matrix m = Large(517, 389);
+  long double exact = 0.0L;
+  for (double x : std::as_const(m)) exact += x;
+
+  // Act
+  double sum = m.Sum();
+  double parallel = m.Reduce(0.0, std::plus<double>());
+  double serial = m.Reduce(0.0, std::plus<double>(), std::identity(), false);
+
+  // Assert
+  ASSERT_EQ(parallel, serial);
+  ASSERT_NEAR(sum, static_cast<double>(exact),
+              1e-13 * static_cast<double>(std::fabs(exact)) + 1e-6);
+  ASSERT_NEAR(parallel, static_cast<double>(exact),
+              1e-13 * static_cast<double>(std::fabs(exact)) + 1e-6);
+  ASSERT_EQ(m.Sum(), sum);
+}
+
+// --- Тестирование нормы Фробениуса без переполнения ---
+TEST(ElementwiseSuite, FrobeniusNormScaling) {
+  // Arrange
+  S21Matrix huge(2, 2);
+  S21Matrix tiny(2, 2);
+  for (double& x : huge) x = 3e200;
+  for (double& x : tiny) x = 3e-200;
+
+  // Act & Assert
+  ASSERT_DOUBLE_EQ(huge.NormFrobenius(), 6e200);
+  ASSERT_DOUBLE_EQ(tiny.NormFrobenius(), 6e-200);
+  ASSERT_DOUBLE_EQ(S21Matrix(3, 3).NormFrobenius(), 0.0);
+}
+
+// --- Тестирование распространения NaN в нормах ---
+TEST(ElementwiseSuite, NormsPropagateNan) {
+  // Arrange: NaN в середине большой матрицы, чтобы сработало деление на блоки
+  S21Matrix a(300, 300);
+  for (double& x : a) x = 1.0;
+  a(150, 7) = std::numeric_limits<double>::quiet_NaN();
+  S21Matrix small = Small();
+  small(0, 0) = std::numeric_limits<double>::quiet_NaN();
+
+  // Act & Assert
+  ASSERT_TRUE(std::isnan(a.NormMax()));
+  ASSERT_TRUE(std::isnan(a.Norm1()));
+  ASSERT_TRUE(std::isnan(a.NormInf()));
+  ASSERT_TRUE(std::isnan(a.NormFrobenius()));
+  ASSERT_TRUE(std::isnan(small.NormMax()));
+  ASSERT_TRUE(std::isnan(small.Norm1()));
+  ASSERT_TRUE(std::isnan(small.NormInf()));
+}
+
+// --- Тестирование поэлементных произведения, деления и ограничения ---
+TEST(ElementwiseSuite, HadamardAndClamp) {
+  // Arrange
+  S21Matrix a = Small();
+  a.set_copy_on_write(true);
+  S21Matrix b = Large(2, 3);
+  S21Matrix product = a;
+  S21Matrix quotient = a;
+  S21Matrix clamped = a;
+
+  // Act
+  product.HadamardMul(b);
+  quotient.HadamardDiv(b);
+  clamped.Clamp(-2.5, 2.5);
+
+  // Assert
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      ASSERT_DOUBLE_EQ(product(i, j), a(i, j) * b(i, j));
+      ASSERT_DOUBLE_EQ(quotient(i, j), a(i, j) / b(i, j));
+      ASSERT_DOUBLE_EQ(clamped(i, j), std::fmin(std::fmax(a(i, j), -2.5), 2.5));
+    }
+  }
+  ASSERT_TRUE(a == Small());
+  ASSERT_THROW(a.HadamardMul(S21Matrix(2, 2)), std::invalid_argument);
+  ASSERT_THROW(a.HadamardDiv(S21Matrix(3, 3)), std::invalid_argument);
+  ASSERT_THROW(a.Clamp(1.0, -1.0), std::invalid_argument);
+  ASSERT_THROW(a.Clamp(std::numeric_limits<double>::quiet_NaN(), 1.0),
+               std::invalid_argument);
+}
+
+// --- Тестирование передачи исключения из параллельного Map ---
+TEST(ElementwiseSuite, MapPropagatesExceptions) {
+  // Arrange
+  S21Matrix m = Large(600, 600);
+
+  // Act & Assert
+  ASSERT_THROW(m.Map([](double x) -> double {
+    if (x > 9.9e7) throw std::domain_error("too large");
+    return x;
+  }),
+               std::domain_error);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+// Матрица Вандермонда по узлам x: V(i, j) = x_i^j
+S21Matrix Vandermonde(const std::vector<long long>& x) {
+  int n = static_cast<int>(x.size());
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    double power = 1.0;
+    for (int j = 0; j < n; ++j) {
+      m(i, j) = power;
+      power *= static_cast<double>(x[i]);
+    }
+  }
+  return m;
+}
+
+// det V = произведение (x_j - x_i) по i < j
+S21BigInt VandermondeDeterminant(const std::vector<long long>& x) {
+  S21BigInt det(1);
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    for (std::size_t j = i + 1; j < x.size(); ++j) det = det * (x[j] - x[i]);
+  }
+  return det;
+}
+}  // namespace
+
+// --- Тестирование арифметики S21BigInt ---
+TEST(ExactSuite, BigIntArithmetic) {
+  // Arrange
+  S21BigInt a = S21BigInt(1) << 100;
+  S21BigInt b(-1234567890123LL);
+
+  // Act
+  S21BigInt product = a * b;
+  S21BigInt sum = product + a - b;
+
+  // Assert
+  ASSERT_EQ(a.ToString(), "1267650600228229401496703205376");
+  ASSERT_EQ(product.DivideExact(b), a);
+  ASSERT_EQ(product.DivideExact(a), b);
+  ASSERT_EQ((sum - a + b).DivideExact(b * a), S21BigInt(1));
+  ASSERT_EQ(S21BigInt(-7).ToString(), "-7");
+  ASSERT_EQ(S21BigInt().ToString(), "0");
+  ASSERT_EQ(S21BigInt(1000000000).ToString(), "1000000000");
+  ASSERT_EQ(S21BigInt::FromDouble(-1e20).ToString(), "-100000000000000000000");
+  ASSERT_DOUBLE_EQ(a.ToDouble(), std::ldexp(1.0, 100));
+  ASSERT_EQ(b.ToInt64(), -1234567890123LL);
+  ASSERT_EQ(S21BigInt(std::numeric_limits<long long>::min()).ToInt64(),
+            std::numeric_limits<long long>::min());
+  ASSERT_EQ((S21BigInt(5) - S21BigInt(5)).Sign(), 0);
+  ASSERT_THROW(a.ToInt64(), std::out_of_range);
+  ASSERT_THROW(a.DivideExact(S21BigInt()), std::invalid_argument);
+  ASSERT_THROW(S21BigInt::FromDouble(0.5), std::invalid_argument);
+}
+
+// --- Тестирование точного определителя в 64 битах ---
+TEST(ExactSuite, DeterminantSmall) {
+  // Arrange
+  S21Matrix m(3, 3);
+  double values[] = {0, 2, 1, 3, -1, 4, 5, 6, -2};
+  int k = 0;
+  for (double& x : m) x = values[k++];
+  S21Matrix singular(3, 3);
+  for (int i = 0; i < 3; ++i) {
+    singular(i, 0) = i + 1;
+    singular(i, 1) = 2 * (i + 1);
+    singular(i, 2) = i * i;
+  }
+
+  // Act
+  S21BigInt det = m.DeterminantExact();
+
+  // Assert
+  ASSERT_EQ(det.ToInt64(), static_cast<long long>(std::round(m.Determinant())));
+  ASSERT_EQ(det.ToInt64(), 75);
+  ASSERT_TRUE(singular.DeterminantExact().IsZero());
+}
+
+// --- Тестирование перехода на 128 бит и длинную арифметику ---
+TEST(ExactSuite, DeterminantOverflowFallback) {
+  // Arrange
+  std::vector<long long> medium = {3, 900, 4100, 5200, 7000};
+  std::vector<long long> large = {12, 26, 42, 60, 80, 102, 126, 152};
+  S21Matrix diagonal(4, 4);
+  for (int i = 0; i < 4; ++i) diagonal(i, i) = std::ldexp(3.0, 40);
+
+  // Act
+  S21BigInt medium_det = Vandermonde(medium).DeterminantExact();
+  S21BigInt large_det = Vandermonde(large).DeterminantExact();
+  S21BigInt diagonal_det = diagonal.DeterminantExact();
+
+  // Assert
+  ASSERT_EQ(medium_det, VandermondeDeterminant(medium));
+  ASSERT_EQ(large_det, VandermondeDeterminant(large));
+  ASSERT_EQ(diagonal_det, S21BigInt(81) << 160);
+}
+
+// --- Тестирование точного ранга ---
+TEST(ExactSuite, Rank) {
+  // Arrange
+  S21Matrix dependent(3, 4);
+  for (int j = 0; j < 4; ++j) {
+    dependent(0, j) = j + 1;
+    dependent(1, j) = 7 - j * j;
+    dependent(2, j) = dependent(0, j) - 2 * dependent(1, j);
+  }
+  S21Matrix nearly(3, 3);
+  double rows[3][3] = {{0.5, 0.25, 0.125},
+                       {1.0, 0.5, 0.25 + std::ldexp(1.0, -40)},
+                       {2.0, 1.0, 0.5}};
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) nearly(i, j) = rows[i][j];
+  }
+  S21Matrix wide_range(2, 2);
+  wide_range(0, 0) = 1e-300;
+  wide_range(0, 1) = 1e300;
+  wide_range(1, 0) = 2e-300;
+  wide_range(1, 1) = 2e300;
+
+  // Act & Assert
+  ASSERT_EQ(dependent.Rank(), 2);
+  ASSERT_EQ(dependent.Transpose().Rank(), 2);
+  ASSERT_EQ(nearly.Rank(), 2);
+  ASSERT_EQ(wide_range.Rank(), 1);
+  ASSERT_EQ(S21Matrix(2, 5).Rank(), 0);
+  ASSERT_EQ(Vandermonde({1, 2, 3, 4, 5, 6}).Rank(), 6);
+}
+
+// --- Тестирование ошибок ---
+TEST(ExactSuite, Errors) {
+  // Arrange
+  S21Matrix fraction(2, 2);
+  fraction(0, 0) = 0.5;
+  S21Matrix infinite(2, 2);
+  infinite(1, 1) = std::numeric_limits<double>::infinity();
+
+  // Act & Assert
+  ASSERT_THROW(S21Matrix(2, 3).DeterminantExact(), std::invalid_argument);
+  ASSERT_THROW(fraction.DeterminantExact(), std::invalid_argument);
+  ASSERT_THROW(infinite.DeterminantExact(), std::invalid_argument);
+  ASSERT_THROW(infinite.Rank(), std::invalid_argument);
+}
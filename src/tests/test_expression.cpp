@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "s21_executor.h"
+#include "s21_expression.h"
+#include "s21_parallel.h"
+#include "test_helpers.h"
+
+// --- Тестирование совпадения с немедленным вычислением ---
+TEST(ExpressionSuite, MatchesEagerEvaluation) {
+  // Arrange
+  S21Matrix a = RandomMatrix(30, 20, 1);
+  S21Matrix b = RandomMatrix(20, 20, 2);
+  S21Matrix c = RandomMatrix(30, 20, 3);
+  S21Expression la(a), lb(b), lc(c);
+  S21Matrix expected = (a.Transpose() * a + b * 2.0 - b.Transpose()) * b;
+  S21Matrix hadamard = c;
+  hadamard.HadamardMul(a);
+
+  // Act
+  S21Matrix result =
+      ((la.Transpose() * la + lb * 2.0 - lb.Transpose()) * lb).Eval();
+  S21Matrix elementwise = (lc.HadamardMul(la) - la * 0.5).Eval();
+
+  // Assert
+  ExpectNear(result, expected, 1e-12);
+  ExpectNear(elementwise, hadamard - a * 0.5, 1e-15);
+}
+
+// --- Тестирование устранения общих подвыражений ---
+TEST(ExpressionSuite, DeduplicatesSubexpressions) {
+  // Arrange: A^T * A записано дважды разными объектами
+  S21Matrix a = RandomMatrix(40, 25, 4);
+  S21Matrix b = RandomMatrix(25, 25, 5);
+  S21Expression first(a), second(a), lb(b);
+  S21Expression gram_1 = first.Transpose() * first;
+  S21Expression gram_2 = second.Transpose() * second;
+  S21EvaluationReport report;
+
+  // Act
+  S21Matrix result = (gram_1 * lb + lb * gram_2).Eval(&report);
+
+  // Assert
+  S21Matrix gram = a.Transpose() * a;
+  ExpectNear(result, gram * b + b * gram, 1e-12);
+  // Один продукт Грама, два умножения на B и один проход сложения
+  ASSERT_EQ(report.kernels, 4u);
+  ASSERT_EQ(report.folded_transposes, 1u);
+  ASSERT_LT(report.unique, report.recorded);
+}
+
+// --- Тестирование слияния поэлементных цепочек и освобождения ---
+TEST(ExpressionSuite, FusesElementwiseChains) {
+  // Arrange
+  S21Matrix a = RandomMatrix(64, 64, 6);
+  S21Matrix b = RandomMatrix(64, 64, 7);
+  S21Expression la(a), lb(b);
+  S21Expression sum = la;
+  for (int k = 1; k <= 10; ++k) sum = sum + lb * static_cast<double>(k);
+  S21EvaluationReport report;
+
+  // Act
+  S21Matrix result = (sum.HadamardMul(la) - la).Eval(&report);
+
+  // Assert
+  S21Matrix expected = a + b * 55.0;
+  expected.HadamardMul(a);
+  ExpectNear(result, expected - a, 1e-12);
+  ASSERT_EQ(report.kernels, 1u);
+  ASSERT_EQ(report.fused, 21u);
+  ASSERT_EQ(report.peak_live, 1u);
+}
+
+// --- Тестирование нескольких выходов и независимых ветвей ---
+TEST(ExpressionSuite, SharedOutputsAndBranches) {
+  // Arrange
+  S21Matrix a = RandomMatrix(50, 50, 8);
+  S21Matrix b = RandomMatrix(50, 50, 9);
+  S21Expression la(a), lb(b);
+  S21Expression left = la * lb;
+  S21Expression right = lb * la;
+  S21EvaluationReport report;
+
+  // Act
+  std::vector<S21Matrix> values = S21Expression::Eval(
+      {left + right, left - right, la.Transpose().Transpose()}, &report);
+
+  // Assert
+  ASSERT_EQ(values.size(), 3u);
+  ExpectNear(values[0], a * b + b * a, 1e-12);
+  ExpectNear(values[1], a * b - b * a, 1e-12);
+  ASSERT_EQ(values[2], a);
+  ASSERT_EQ(report.kernels, 4u);
+  ASSERT_LE(report.peak_live, 4u);
+}
+
+// --- Тестирование запрета временных матриц ---
+TEST(ExpressionSuite, RejectsTemporaries) {
+  // Временная матрица уничтожилась бы до Eval()
+  static_assert(!std::is_constructible_v<S21Expression, S21Matrix&&>);
+  static_assert(std::is_constructible_v<S21Expression, const S21Matrix&>);
+  static_assert(std::is_constructible_v<S21Expression, S21Matrix&>);
+}
+
+// --- Тестирование проверки размеров ---
+TEST(ExpressionSuite, ShapeErrors) {
+  // Arrange
+  S21Matrix a(2, 3);
+  S21Matrix b(2, 2);
+  S21Expression la(a), lb(b);
+
+  // Act & Assert
+  ASSERT_THROW(la + lb, std::invalid_argument);
+  ASSERT_THROW(la - lb, std::invalid_argument);
+  ASSERT_THROW(la * lb, std::invalid_argument);
+  ASSERT_THROW(la.HadamardMul(lb), std::invalid_argument);
+  ASSERT_NO_THROW(lb * la);
+  ASSERT_EQ((lb * la).get_cols(), 3);
+  ASSERT_EQ(la.Transpose().get_rows(), 3);
+}
+
+// --- Тестирование параллельного пути на отдельном пуле ---
+TEST(ExpressionSuite, ParallelExecutor) {
+  // Arrange: независимые произведения выполняются на двух потоках
+  S21Matrix a = RandomMatrix(40, 40, 10);
+  S21Matrix b = RandomMatrix(40, 40, 11);
+  S21Matrix c = RandomMatrix(40, 40, 12);
+  S21Expression la(a), lb(b), lc(c);
+  S21Expression sum = la * lb + lb * lc + lc * la;
+  S21Executor executor(2);
+  S21EvaluationReport report;
+  int limit = s21_internal::ThreadLimit();
+
+  // Act
+  std::vector<S21Matrix> values =
+      S21Expression::Eval({sum, sum * 2.0}, executor, &report);
+  S21Matrix single = (la * lb).Eval(executor);
+
+  // Assert
+  S21Matrix expected = a * b + b * c + c * a;
+  ExpectNear(values[0], expected, 1e-12);
+  ExpectNear(values[1], expected * 2.0, 1e-12);
+  ExpectNear(single, a * b, 1e-12);
+  ExpectNear(values[0], sum.Eval(), 1e-12);
+  ASSERT_EQ(report.kernels, 5u);
+  ASSERT_LE(report.peak_live, 4u);
+  ASSERT_EQ(s21_internal::ThreadLimit(), limit);
+}
+
+// --- Тестирование исключения в ядре ---
+TEST(ExpressionSuite, ThrowingKernel) {
+  // Arrange: после записи выражения лист меняет размер
+  S21Matrix a = RandomMatrix(20, 20, 13);
+  S21Matrix b = RandomMatrix(20, 20, 14);
+  S21Matrix c = RandomMatrix(20, 20, 15);
+  S21Expression la(a), lb(b), lc(c);
+  S21Expression sum = la * lb + lc * la + lb.HadamardMul(lc);
+  S21Executor executor(2);
+  c.set_cols(21);
+
+  // Act & Assert: ошибка доходит до вызывающего на обоих путях
+  ASSERT_THROW(sum.Eval(executor), std::invalid_argument);
+  S21Executor serial(1);
+  ASSERT_THROW(sum.Eval(serial), std::invalid_argument);
+  // Пул остаётся рабочим
+  c.set_cols(20);
+  S21Matrix hadamard = b;
+  hadamard.HadamardMul(c);
+  ExpectNear(sum.Eval(executor), a * b + c * a + hadamard, 1e-12);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+// Матрица rows x cols с детерминированными элементами
+S21Matrix Sample(int rows, int cols, int seed) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      m(i, j) = ((i * 5 + j * 11 + seed * 3) % 13) / 4.0 - 1.5;
+    }
+  }
+  return m;
+}
+
+void ExpectNear(const S21Matrix& actual, const S21Matrix& expected) {
+  ASSERT_EQ(actual.get_rows(), expected.get_rows());
+  ASSERT_EQ(actual.get_cols(), expected.get_cols());
+  for (int i = 0; i < actual.get_rows(); ++i) {
+    for (int j = 0; j < actual.get_cols(); ++j) {
+      ASSERT_NEAR(actual(i, j), expected(i, j), 1e-12);
+    }
+  }
+}
+}  // namespace
+
+// --- Тестирование Gemm со всеми вариантами транспонирования ---
+TEST(GemmSuite, AllTransposeCombinations) {
+  const S21Transpose kModes[] = {S21Transpose::kNone,
+                                 S21Transpose::kTranspose};
+  for (S21Transpose trans_a : kModes) {
+    for (S21Transpose trans_b : kModes) {
+      // Arrange
+      bool ta = trans_a == S21Transpose::kTranspose;
+      bool tb = trans_b == S21Transpose::kTranspose;
+      S21Matrix a = ta ? Sample(7, 5, 1) : Sample(5, 7, 1);
+      S21Matrix b = tb ? Sample(6, 7, 2) : Sample(7, 6, 2);
+      S21Matrix c = Sample(5, 6, 3);
+      S21Matrix op_a = ta ? a.Transpose() : a;
+      S21Matrix op_b = tb ? b.Transpose() : b;
+      S21Matrix expected = op_a * op_b * 0.5 + c * -2.0;
+
+      // Act
+      S21Matrix::Gemm(0.5, a, b, -2.0, c, trans_a, trans_b);
+
+      // Assert
+      ExpectNear(c, expected);
+    }
+  }
+}
+
+// --- Тестирование особых значений alpha и beta ---
+TEST(GemmSuite, ZeroAlphaAndBeta) {
+  // Arrange
+  S21Matrix a = Sample(4, 6, 1);
+  S21Matrix b = Sample(6, 5, 2);
+  S21Matrix c(4, 5);
+  for (double& x : c) x = std::numeric_limits<double>::quiet_NaN();
+  S21Matrix d = Sample(4, 5, 3);
+  S21Matrix expected_d = d * 3.0;
+
+  // Act
+  S21Matrix::Gemm(1.0, a, b, 0.0, c);
+  S21Matrix::Gemm(0.0, a, b, 3.0, d);
+
+  // Assert
+  ExpectNear(c, a * b);
+  ExpectNear(d, expected_d);
+}
+
+// --- Тестирование накопления в операнд (C = C * B + C) ---
+TEST(GemmSuite, AccumulatorAliasesOperand) {
+  // Arrange
+  S21Matrix c = Sample(6, 6, 1);
+  S21Matrix b = Sample(6, 6, 2);
+  S21Matrix expected = c * b + c;
+
+  // Act
+  S21Matrix::Gemm(1.0, c, b, 1.0, c);
+
+  // Assert
+  ExpectNear(c, expected);
+}
+
+// --- Тестирование проверки размеров ---
+TEST(GemmSuite, DimensionMismatch) {
+  // Arrange
+  S21Matrix a(3, 4);
+  S21Matrix b(4, 2);
+  S21Matrix c(3, 2);
+  S21Matrix wrong(2, 3);
+
+  // Act & Assert
+  ASSERT_NO_THROW(S21Matrix::Gemm(1.0, a, b, 1.0, c));
+  ASSERT_THROW(S21Matrix::Gemm(1.0, a, b, 1.0, wrong), std::invalid_argument);
+  ASSERT_THROW(S21Matrix::Gemm(1.0, a, b, 1.0, c, S21Transpose::kTranspose),
+               std::invalid_argument);
+  ASSERT_THROW(
+      S21Matrix::Gemm(1.0, a, b, 1.0, c, S21Transpose::kNone,
+                      S21Transpose::kTranspose),
+      std::invalid_argument);
+}
+
+// --- Тестирование повторного использования буфера в operator*= ---
+TEST(GemmSuite, MulAssignReusesWorkspace) {
+  // Arrange
+  S21Matrix a = Sample(8, 8, 1);
+  S21Matrix b = Sample(8, 8, 2) * 0.25;
+  S21Matrix expected = a * b * b * b;
+  S21Matrix c = Sample(8, 8, 3);
+  const double* c_buffer = std::as_const(c).data();
+
+  // Act
+  a *= b;
+  const double* first = std::as_const(a).data();
+  a *= b;
+  const double* second = std::as_const(a).data();
+  a *= b;
+  const double* third = std::as_const(a).data();
+  S21Matrix::Gemm(1.0, a, b, 1.0, c);
+
+  // Assert
+  ExpectNear(a, expected);
+  ASSERT_NE(first, second);
+  ASSERT_EQ(first, third);
+  ASSERT_EQ(std::as_const(c).data(), c_buffer);
+}
+
+// --- Тестирование operator*= на матрице с общим буфером ---
+TEST(GemmSuite, MulAssignWithCopyOnWrite) {
+  // Arrange
+  S21Matrix a = Sample(6, 6, 1);
+  a.set_copy_on_write(true);
+  S21Matrix copy = a;
+  S21Matrix b = Sample(6, 6, 2);
+  S21Matrix expected = Sample(6, 6, 1) * b;
+
+  // Act
+  a *= b;
+  a *= b;
+
+  // Assert
+  ExpectNear(copy, Sample(6, 6, 1));
+  ExpectNear(a, expected * b);
+  ASSERT_TRUE(a.get_copy_on_write());
+}
+
+// --- Тестирование ограничения рабочего буфера ---
+TEST(GemmSuite, LargeProductsBypassWorkspace) {
+  // Arrange: произведение 1100 x 1000 больше 8 МиБ
+  S21Matrix tall = Sample(1100, 3, 1);
+  S21Matrix wide = Sample(3, 1000, 2);
+  S21Matrix expected = tall * wide;
+  S21Matrix small = Sample(8, 8, 3);
+  S21Matrix small_b = Sample(8, 8, 4);
+
+  // Act
+  S21Matrix big = tall;
+  big *= wide;
+  S21Matrix::Gemm(2.0, big, S21Matrix(1000, 1000), 1.0, big);
+  small *= small_b;
+  S21Matrix::ReleaseWorkspace();
+  small *= small_b;
+
+  // Assert: результаты не зависят от того, где формировалось произведение
+  ExpectNear(expected, big);
+  ExpectNear(small, Sample(8, 8, 3) * small_b * small_b);
+  ASSERT_EQ(big.get_rows(), 1100);
+  ASSERT_EQ(big.get_cols(), 1000);
+}
@@ -0,0 +1,43 @@
+#ifndef S21_TEST_HELPERS_H
+#define S21_TEST_HELPERS_H
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "s21_matrix_oop.h"
+
+// Общие вспомогательные функции тестов
+
+// Случайная матрица rows x cols с элементами из [-1, 1]
+inline S21Matrix RandomMatrix(int rows, int cols, unsigned seed) {
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = uniform(engine);
+  }
+  return m;
+}
+
+// RandomMatrix с cols, прибавленным к диагонали: хорошо обусловлена,
+// квадратная матрица невырождена
+inline S21Matrix DominantMatrix(int rows, int cols, unsigned seed) {
+  S21Matrix m = RandomMatrix(rows, cols, seed);
+  for (int i = 0; i < rows && i < cols; ++i) m(i, i) += cols;
+  return m;
+}
+
+// Сравнение матриц поэлементно с допуском
+inline void ExpectNear(const S21Matrix& a, const S21Matrix& b,
+                       double tolerance) {
+  ASSERT_EQ(a.get_rows(), b.get_rows());
+  ASSERT_EQ(a.get_cols(), b.get_cols());
+  for (int i = 0; i < a.get_rows(); ++i) {
+    for (int j = 0; j < a.get_cols(); ++j) {
+      ASSERT_NEAR(a(i, j), b(i, j), tolerance);
+    }
+  }
+}
+
+#endif  // S21_TEST_HELPERS_H
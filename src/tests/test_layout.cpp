@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>
+
+#include "s21_layout.h"
+#include "test_helpers.h"
+
+namespace {
+// Буфер матрицы в порядке по столбцам
+std::vector<double> ColumnMajor(const S21Matrix& m) {
+  std::vector<double> buffer(m.get_rows() * m.get_cols());
+  for (int j = 0; j < m.get_cols(); ++j) {
+    for (int i = 0; i < m.get_rows(); ++i) {
+      buffer[j * m.get_rows() + i] = m(i, j);
+    }
+  }
+  return buffer;
+}
+
+// Сравнение представления с матрицей поэлементно
+template <S21Layout L, typename T>
+void ExpectNear(const S21MatrixView<L, T>& view, const S21Matrix& m,
+                double tolerance) {
+  ASSERT_EQ(view.get_rows(), m.get_rows());
+  ASSERT_EQ(view.get_cols(), m.get_cols());
+  for (int i = 0; i < m.get_rows(); ++i) {
+    for (int j = 0; j < m.get_cols(); ++j) {
+      ASSERT_NEAR(view(i, j), m(i, j), tolerance);
+    }
+  }
+}
+}  // namespace
+
+// --- Тестирование представлений внешнего буфера ---
+TEST(LayoutSuite, ViewsOfExternalBuffers) {
+  // Arrange
+  S21Matrix m = RandomMatrix(5, 7, 1);
+  std::vector<double> buffer = ColumnMajor(m);
+
+  // Act
+  S21MatrixView<S21Layout::kColMajor> col(buffer.data(), 5, 7);
+  S21MatrixView<S21Layout::kRowMajor> transposed = col.Transpose();
+  S21MatrixView<S21Layout::kColMajor> block = col.Block(1, 2, 3, 4);
+  block(0, 0) = 42.0;
+
+  // Assert
+  ASSERT_EQ(col.get_stride(), 5);
+  ASSERT_EQ(transposed.get_rows(), 7);
+  ASSERT_EQ(transposed.data(), buffer.data());
+  ASSERT_DOUBLE_EQ(buffer[2 * 5 + 1], 42.0);
+  m(1, 2) = 42.0;
+  ExpectNear(col, m, 0.0);
+  ExpectNear(transposed, m.Transpose(), 0.0);
+  ASSERT_DOUBLE_EQ(block(2, 3), m(3, 5));
+  ASSERT_THROW(col(5, 0), std::out_of_range);
+  ASSERT_THROW(col.Block(3, 0, 3, 1), std::out_of_range);
+  ASSERT_THROW(S21ConstMatrixView<S21Layout::kColMajor>(buffer.data(), 5, 7, 4),
+               std::invalid_argument);
+}
+
+// --- Тестирование умножения при всех сочетаниях порядков хранения ---
+TEST(LayoutSuite, GemmAllLayoutCombinations) {
+  // Arrange
+  S21Matrix a = RandomMatrix(40, 30, 2);
+  S21Matrix b = RandomMatrix(30, 50, 3);
+  S21Matrix c = RandomMatrix(40, 50, 4);
+  S21Matrix expected = a * b * 2.0 - c;
+  std::vector<double> a_col = ColumnMajor(a);
+  std::vector<double> b_col = ColumnMajor(b);
+  S21ConstMatrixView<S21Layout::kRowMajor> a_row_view(a);
+  S21ConstMatrixView<S21Layout::kRowMajor> b_row_view(b);
+  S21ConstMatrixView<S21Layout::kColMajor> a_col_view(a_col.data(), 40, 30);
+  S21ConstMatrixView<S21Layout::kColMajor> b_col_view(b_col.data(), 30, 50);
+
+  // Act & Assert
+  for (int mask = 0; mask < 8; ++mask) {
+    std::vector<double> c_col = ColumnMajor(c);
+    S21Matrix c_row = c;
+    S21MatrixView<S21Layout::kColMajor> c_col_view(c_col.data(), 40, 50);
+    S21MatrixView<S21Layout::kRowMajor> c_row_view(c_row);
+    auto run = [&](const auto& x, const auto& y) {
+      if (mask & 4) {
+        S21LayoutOps::Gemm(2.0, x, y, -1.0, c_col_view);
+        ExpectNear(c_col_view, expected, 1e-12);
+      } else {
+        S21LayoutOps::Gemm(2.0, x, y, -1.0, c_row_view);
+        ExpectNear(c_row_view, expected, 1e-12);
+      }
+    };
+    switch (mask & 3) {
+      case 0:
+        run(a_row_view, b_row_view);
+        break;
+      case 1:
+        run(a_col_view, b_row_view);
+        break;
+      case 2:
+        run(a_row_view, b_col_view);
+        break;
+      default:
+        run(a_col_view, b_col_view);
+    }
+  }
+  ASSERT_EQ(S21LayoutOps::Multiply(a_col_view, b_col_view), a * b);
+  ASSERT_THROW(S21LayoutOps::Multiply(a_col_view, a_row_view),
+               std::invalid_argument);
+}
+
+// --- Тестирование копирования и поэлементных операций ---
+TEST(LayoutSuite, CopyAndElementwise) {
+  // Arrange
+  S21Matrix a = RandomMatrix(70, 45, 5);
+  S21Matrix b = RandomMatrix(70, 45, 6);
+  std::vector<double> b_col = ColumnMajor(b);
+  S21ConstMatrixView<S21Layout::kRowMajor> a_view(a);
+  S21ConstMatrixView<S21Layout::kColMajor> b_view(b_col.data(), 70, 45);
+  std::vector<double> out_col(70 * 45);
+  S21MatrixView<S21Layout::kColMajor> out(out_col.data(), 70, 45);
+  S21Matrix out_row(70, 45);
+  S21MatrixView<S21Layout::kRowMajor> out_row_view(out_row);
+  S21Matrix hadamard = a;
+  hadamard.HadamardMul(b);
+
+  // Act & Assert
+  S21LayoutOps::Copy(a_view, out);
+  ExpectNear(out, a, 0.0);
+  ASSERT_EQ(S21LayoutOps::ToMatrix(b_view), b);
+  S21LayoutOps::Add(a_view, b_view, out);
+  ExpectNear(out, a + b, 1e-15);
+  S21LayoutOps::Sub(a_view, b_view, out_row_view);
+  ExpectNear(out_row_view, a - b, 1e-15);
+  S21LayoutOps::HadamardMul(b_view, a_view, out);
+  ExpectNear(out, hadamard, 1e-15);
+  // Запись в один из аргументов того же представления
+  S21LayoutOps::Add(out, b_view, out);
+  ExpectNear(out, hadamard + b, 1e-15);
+  ASSERT_EQ(RandomMatrix(37, 53, 7).Transpose().Transpose(),
+            RandomMatrix(37, 53, 7));
+  ASSERT_THROW(S21LayoutOps::Add(a_view, b_view.Transpose(), out),
+               std::invalid_argument);
+}
+
+// --- Тестирование записи в матрицу через представление ---
+TEST(LayoutSuite, MutableViewsMarkMatrixModified) {
+  // Arrange: LU закэширован, копия делит буфер при копировании при записи
+  S21Matrix m(5, 5);
+  for (int i = 0; i < 5; ++i) m(i, i) = 1.0;
+  m.set_copy_on_write(true);
+  ASSERT_EQ(m.Determinant(), 1.0);
+  S21Matrix copy = m;
+  S21MatrixView<S21Layout::kRowMajor> view(m);
+  std::uint64_t version = m.get_version();
+
+  // Act
+  view(0, 0) = 3.0;
+  double det = m.Determinant();
+  view.Transpose().Block(1, 1, 2, 2)(0, 0) = 2.0;
+  S21LayoutOps::Add(view, view, view);
+
+  // Assert
+  ASSERT_GT(m.get_version(), version);
+  ASSERT_DOUBLE_EQ(det, 3.0);
+  ASSERT_DOUBLE_EQ(m(1, 1), 4.0);
+  ASSERT_DOUBLE_EQ(m.Determinant(), 6.0 * 4.0 * 8.0);
+  ASSERT_DOUBLE_EQ(m.InverseMatrix()(0, 0), 1.0 / 6.0);
+  ASSERT_DOUBLE_EQ(copy(0, 0), 1.0);
+  ASSERT_DOUBLE_EQ(copy(1, 1), 1.0);
+  ASSERT_EQ(copy.Determinant(), 1.0);
+}
+
+// --- Тестирование запрета представлений временных матриц ---
+TEST(LayoutSuite, RejectsTemporaries) {
+  // Буфер временной матрицы освободился бы раньше представления
+  using ConstView = S21MatrixView<S21Layout::kRowMajor, const double>;
+  using View = S21MatrixView<S21Layout::kRowMajor>;
+  static_assert(!std::is_constructible_v<ConstView, S21Matrix&&>);
+  static_assert(!std::is_constructible_v<ConstView, const S21Matrix&&>);
+  static_assert(!std::is_constructible_v<View, S21Matrix&&>);
+  static_assert(std::is_constructible_v<ConstView, const S21Matrix&>);
+  static_assert(std::is_constructible_v<View, S21Matrix&>);
+}
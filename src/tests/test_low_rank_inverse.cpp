@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+
+#include "s21_low_rank_inverse.h"
+
+namespace {
+S21Matrix Diagonal(int n) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    m(i, i) = 4.0 + i;
+    if (i + 1 < n) m(i, i + 1) = 1.0;
+  }
+  return m;
+}
+}  // namespace
+
+// --- Тестирование обновления ранга 1 ---
+TEST(LowRankInverseSuite, Rank1Update) {
+  // Arrange
+  S21LowRankInverse tracker(Diagonal(5));
+  S21Vector u(5);
+  S21Vector v(5);
+  for (int i = 0; i < 5; ++i) {
+    u(i) = 0.5 * i;
+    v(i) = 1.0 - 0.25 * i;
+  }
+
+  // Act
+  tracker.UpdateRank1(u, v);
+
+  // Assert
+  S21Matrix expected = Diagonal(5);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) expected(i, j) += u(i) * v(j);
+  }
+  ASSERT_TRUE(tracker.get_matrix() == expected);
+  ASSERT_TRUE(tracker.get_inverse() == expected.InverseMatrix());
+  ASSERT_NEAR(tracker.get_determinant(), expected.Determinant(), 1e-9);
+  ASSERT_EQ(tracker.get_updates_since_refactor(), 1);
+}
+
+// --- Тестирование обновления ранга k ---
+TEST(LowRankInverseSuite, RankKUpdate) {
+  // Arrange
+  S21LowRankInverse tracker(Diagonal(6));
+  S21Matrix u(6, 2);
+  S21Matrix v(6, 2);
+  for (int i = 0; i < 6; ++i) {
+    u(i, 0) = 1.0;
+    u(i, 1) = i % 2;
+    v(i, 0) = 0.1 * i;
+    v(i, 1) = -0.2;
+  }
+
+  // Act
+  tracker.Update(u, v);
+
+  // Assert
+  S21Matrix expected = Diagonal(6) + u * v.Transpose();
+  ASSERT_TRUE(tracker.get_inverse() == expected.InverseMatrix());
+  ASSERT_NEAR(tracker.get_determinant(), expected.Determinant(), 1e-7);
+  ASSERT_LT(tracker.Drift(), 1e-10);
+}
+
+// --- Тестирование замены строки и столбца ---
+TEST(LowRankInverseSuite, ReplaceRowAndColumn) {
+  // Arrange
+  S21LowRankInverse tracker(Diagonal(4));
+  S21Vector row(4);
+  S21Vector col(4);
+  for (int i = 0; i < 4; ++i) {
+    row(i) = 1.0 + i;
+    col(i) = 2.0 - i;
+  }
+
+  // Act
+  tracker.ReplaceRow(1, row);
+  tracker.ReplaceColumn(3, col);
+
+  // Assert
+  S21Matrix expected = Diagonal(4);
+  for (int j = 0; j < 4; ++j) expected(1, j) = row(j);
+  for (int i = 0; i < 4; ++i) expected(i, 3) = col(i);
+  ASSERT_TRUE(tracker.get_matrix() == expected);
+  ASSERT_TRUE(tracker.get_inverse() == expected.InverseMatrix());
+  ASSERT_NEAR(tracker.get_determinant(), expected.Determinant(), 1e-9);
+}
+
+// --- Тестирование периодической перефакторизации ---
+TEST(LowRankInverseSuite, RefactorInterval) {
+  S21LowRankInverse tracker(Diagonal(3), 2);
+  S21Vector u(3);
+  S21Vector v(3);
+  u(0) = 0.1;
+  v(2) = 0.1;
+
+  tracker.UpdateRank1(u, v);
+  ASSERT_EQ(tracker.get_refactor_count(), 0);
+  tracker.UpdateRank1(u, v);
+  ASSERT_EQ(tracker.get_refactor_count(), 1);
+  ASSERT_EQ(tracker.get_updates_since_refactor(), 0);
+}
+
+TEST(LowRankInverseSuite, DriftTriggersRefactor) {
+  // Нулевой допуск заставляет перефакторизовать после каждого обновления
+  S21LowRankInverse tracker(Diagonal(3), 100, -1.0);
+  S21Vector u(3);
+  S21Vector v(3);
+  u(1) = 0.3;
+  v(0) = 0.7;
+  tracker.UpdateRank1(u, v);
+  ASSERT_EQ(tracker.get_refactor_count(), 1);
+}
+
+TEST(LowRankInverseSuite, Throws) {
+  ASSERT_THROW(S21LowRankInverse(S21Matrix(2, 3)), std::invalid_argument);
+  ASSERT_THROW(S21LowRankInverse(S21Matrix(2, 2)), std::invalid_argument);
+  ASSERT_THROW(S21LowRankInverse(Diagonal(2), 0), std::invalid_argument);
+
+  S21LowRankInverse tracker(Diagonal(2));
+  S21Vector row(2);
+  ASSERT_THROW(tracker.ReplaceRow(0, row), std::invalid_argument);
+  ASSERT_THROW(tracker.ReplaceRow(2, row), std::out_of_range);
+  ASSERT_THROW(tracker.ReplaceColumn(0, S21Vector(3)), std::invalid_argument);
+  ASSERT_THROW(tracker.Update(S21Matrix(2, 1), S21Matrix(2, 2)),
+               std::invalid_argument);
+  ASSERT_TRUE(tracker.get_matrix() == Diagonal(2));
+}
+
+// --- Тестирование относительного критерия вырожденности ---
+TEST(LowRankInverseSuite, SingularityIsRelative) {
+  // Arrange: обновление оставляет в (0, 0) малое, но ненулевое значение
+  S21Matrix identity(3, 3);
+  for (int i = 0; i < 3; ++i) identity(i, i) = 1.0;
+  S21LowRankInverse tracker(identity);
+  S21Vector u(3);
+  S21Vector v(3);
+  u(0) = -(1.0 - 1e-13);
+  v(0) = 1.0;
+
+  // Act
+  tracker.UpdateRank1(u, v);
+
+  // Assert: ёмкостная матрица 1e-13 не вырождена относительно своего масштаба
+  double diagonal = tracker.get_matrix()(0, 0);
+  ASSERT_NEAR(diagonal, 1e-13, 1e-16);
+  ASSERT_NEAR(tracker.get_determinant(), diagonal, 1e-18);
+  ASSERT_NEAR(tracker.get_inverse()(0, 0), 1.0 / diagonal, 1e-3 / diagonal);
+  // Точное обнуление строки отклоняется, состояние не меняется
+  S21LowRankInverse exact(identity);
+  u(0) = -1.0;
+  ASSERT_THROW(exact.UpdateRank1(u, v), std::invalid_argument);
+  ASSERT_TRUE(exact.get_matrix() == identity);
+}
+
+// --- Тестирование запуска с готовой обратной матрицей ---
+TEST(LowRankInverseSuite, StartsFromKnownInverse) {
+  // Arrange
+  S21Matrix a = Diagonal(6);
+  S21Matrix inverse = a.InverseMatrix();
+  S21Vector u(6);
+  S21Vector v(6);
+  u(2) = 0.5;
+  v(4) = -0.75;
+
+  // Act
+  S21LowRankInverse tracker(a, inverse, a.Determinant());
+  tracker.UpdateRank1(u, v);
+
+  // Assert
+  S21Matrix expected = a;
+  expected(2, 4) += u(2) * v(4);
+  ASSERT_TRUE(tracker.get_inverse() == expected.InverseMatrix());
+  ASSERT_NEAR(tracker.get_determinant(), expected.Determinant(), 1e-9);
+  ASSERT_EQ(tracker.get_refactor_count(), 0);
+  ASSERT_THROW(S21LowRankInverse(a, S21Matrix(5, 6), 1.0),
+               std::invalid_argument);
+  ASSERT_THROW(S21LowRankInverse(S21Matrix(2, 3), S21Matrix(2, 3), 1.0),
+               std::invalid_argument);
+}
+
+// --- Тестирование плохо обусловленной матрицы ---
+TEST(LowRankInverseSuite, IllConditionedDriftIsRelative) {
+  // Arrange: матрица Гильберта 8x8, число обусловленности около 1e10
+  S21Matrix hilbert(8, 8);
+  for (int i = 0; i < 8; ++i) {
+    for (int j = 0; j < 8; ++j) hilbert(i, j) = 1.0 / (i + j + 1);
+  }
+  S21LowRankInverse tracker(hilbert);
+  double fresh = tracker.Drift();
+  S21Vector u(8);
+  S21Vector v(8);
+
+  // Act
+  for (int step = 0; step < 10; ++step) {
+    u(step % 8) = 1e-3;
+    v((step + 3) % 8) = 1e-6 * (step + 1);
+    tracker.UpdateRank1(u, v);
+    u(step % 8) = 0.0;
+    v((step + 3) % 8) = 0.0;
+  }
+
+  // Assert: абсолютный допуск 1e-9 требовал бы перефакторизаций
+  ASSERT_GT(fresh, 1e-9);
+  ASSERT_EQ(tracker.get_refactor_count(), 0);
+  ASSERT_LT(tracker.Drift(), 1e3 * fresh);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <cfloat>
+#include <thread>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+// Трёхдиагональная матрица 2, -1: определитель равен n + 1
+S21Matrix Laplacian(int n) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    m(i, i) = 2;
+    if (i > 0) m(i, i - 1) = -1;
+    if (i + 1 < n) m(i, i + 1) = -1;
+  }
+  return m;
+}
+
+// Единичная матрица n x n, в которой строка 1 отличается от строки 0 на
+// delta во втором столбце
+S21Matrix NearlyDependent(int n, double delta) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) m(i, i) = 1.0;
+  m(0, 1) = 1.0;
+  m(1, 0) = 1.0;
+  m(1, 1) = 1.0 + delta;
+  return m;
+}
+}  // namespace
+
+// --- Тестирование версии матрицы ---
+TEST(LuCacheSuite, VersionChangesOnMutation) {
+  // Arrange
+  S21Matrix m(2, 2);
+  const S21Matrix& const_m = m;
+  std::uint64_t v0 = m.get_version();
+
+  // Act & Assert
+  double value = const_m(0, 0);
+  ASSERT_EQ(m.get_version(), v0);
+  m(0, 0) = value + 1.0;
+  std::uint64_t v1 = m.get_version();
+  ASSERT_GT(v1, v0);
+  m.SumMatrix(m);
+  ASSERT_GT(m.get_version(), v1);
+  std::uint64_t v2 = m.get_version();
+  m.set_rows(3);
+  ASSERT_GT(m.get_version(), v2);
+  std::uint64_t v3 = m.get_version();
+  m.data();
+  ASSERT_GT(m.get_version(), v3);
+}
+
+// --- Тестирование определителя и обращения через LU ---
+TEST(LuCacheSuite, LargeDeterminantAndInverse) {
+  // Arrange
+  S21Matrix m = Laplacian(8);
+  S21Matrix identity(8, 8);
+  for (int i = 0; i < 8; ++i) identity(i, i) = 1;
+
+  // Act
+  double det = m.Determinant();
+  S21Matrix inverse = m.InverseMatrix();
+
+  // Assert
+  ASSERT_NEAR(det, 9.0, 1e-9);
+  ASSERT_NEAR(m.Determinant(), det, 0.0);
+  ASSERT_TRUE(m * inverse == identity);
+}
+
+TEST(LuCacheSuite, CacheInvalidatedByMutation) {
+  // Arrange
+  S21Matrix m = Laplacian(5);
+  ASSERT_NEAR(m.Determinant(), 6.0, 1e-9);
+
+  // Act
+  m.MulNumber(2.0);
+
+  // Assert: det(2A) = 2^5 * det(A)
+  ASSERT_NEAR(m.Determinant(), 192.0, 1e-9);
+}
+
+TEST(LuCacheSuite, CopySharesFactorization) {
+  S21Matrix m = Laplacian(6);
+  double det = m.Determinant();
+  S21Matrix copy(m);
+  ASSERT_DOUBLE_EQ(copy.Determinant(), det);
+  copy(0, 0) = 3;
+  ASSERT_NE(copy.Determinant(), det);
+  ASSERT_DOUBLE_EQ(m.Determinant(), det);
+}
+
+TEST(LuCacheSuite, LargeCalcComplements) {
+  // Arrange
+  S21Matrix m = Laplacian(4);
+  m(0, 3) = 1;
+
+  // Act
+  S21Matrix complements = m.CalcComplements();
+
+  // Assert: A * adj(A) = det(A) * I
+  S21Matrix expected(4, 4);
+  for (int i = 0; i < 4; ++i) expected(i, i) = m.Determinant();
+  ASSERT_TRUE(m * complements.Transpose() == expected);
+}
+
+// --- Тестирование Solve ---
+TEST(LuCacheSuite, Solve) {
+  // Arrange
+  S21Matrix m = Laplacian(4);
+  S21Vector x(4);
+  for (int i = 0; i < 4; ++i) x(i) = i + 1.0;
+  S21Vector b = m * x;
+  S21Matrix rhs(4, 2);
+  for (int i = 0; i < 4; ++i) {
+    rhs(i, 0) = b(i);
+    rhs(i, 1) = 2 * b(i);
+  }
+
+  // Act
+  S21Vector solution = m.Solve(b);
+  S21Matrix solutions = m.Solve(rhs);
+
+  // Assert
+  ASSERT_TRUE(solution == x);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_NEAR(solutions(i, 0), x(i), 1e-12);
+    ASSERT_NEAR(solutions(i, 1), 2 * x(i), 1e-12);
+  }
+}
+
+TEST(LuCacheSuite, SolveThrows) {
+  S21Matrix singular(4, 4);
+  S21Matrix rect(2, 3);
+  ASSERT_THROW(singular.Solve(S21Vector(4)), std::invalid_argument);
+  ASSERT_THROW(singular.InverseMatrix(), std::invalid_argument);
+  ASSERT_THROW(rect.Solve(S21Vector(2)), std::invalid_argument);
+  ASSERT_THROW(Laplacian(4).Solve(S21Matrix(3, 1)), std::invalid_argument);
+}
+
+// --- Тестирование одновременного чтения из нескольких потоков ---
+TEST(LuCacheSuite, ConcurrentConstReaders) {
+  const S21Matrix m = Laplacian(30);
+  std::vector<double> results(8, 0.0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&m, &results, t]() { results[t] = m.Determinant(); });
+  }
+  for (auto& thread : threads) thread.join();
+  for (double r : results) ASSERT_NEAR(r, 31.0, 1e-9);
+}
+
+// --- Тестирование единого критерия вырожденности ---
+TEST(LuCacheSuite, SingularityRuleIsScaleInvariant) {
+  for (int n = 2; n <= 6; ++n) {
+    // Arrange
+    S21Matrix small_scale(n, n);
+    for (int i = 0; i < n; ++i) small_scale(i, i) = 0.01;
+    S21Matrix tiny = small_scale * 1e-30;
+
+    // Act
+    S21Matrix inverse = small_scale.InverseMatrix();
+
+    // Assert: масштаб не влияет на решение, до 4x4 и после
+    ASSERT_DOUBLE_EQ(inverse(n - 1, n - 1), 100.0);
+    ASSERT_NO_THROW(tiny.InverseMatrix());
+    // Граница: ведущий элемент delta против n * DBL_EPSILON
+    ASSERT_NO_THROW(NearlyDependent(n, 2 * n * DBL_EPSILON).InverseMatrix());
+    ASSERT_THROW(NearlyDependent(n, DBL_EPSILON).InverseMatrix(),
+                 std::invalid_argument);
+    ASSERT_THROW((NearlyDependent(n, DBL_EPSILON) * 1e12).InverseMatrix(),
+                 std::invalid_argument);
+  }
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "s21_matrix_chain.h"
+
+namespace {
+S21Matrix Filled(int rows, int cols, double seed) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      m(i, j) = seed + i - 0.5 * j;
+    }
+  }
+  return m;
+}
+
+// Можно ли дописать в цепочку операнд типа M каждым из способов
+template <typename M>
+constexpr bool kAppendable =
+    requires(S21MatrixChain c, M m) { c * static_cast<M>(m); } ||
+    requires(S21MatrixChain c, M m) { c *= static_cast<M>(m); } ||
+    requires(S21MatrixChain c, M m) { c.Append(static_cast<M>(m)); };
+}  // namespace
+
+// --- Тестирование выбора порядка умножения ---
+TEST(MatrixChainSuite, ChoosesCheapestOrder) {
+  // Arrange: 10x30, 30x5, 5x60 — классический пример
+  S21Matrix a = Filled(10, 30, 1.0);
+  S21Matrix b = Filled(30, 5, 2.0);
+  S21Matrix c = Filled(5, 60, 3.0);
+
+  // Act
+  S21MatrixChain chain = S21MatrixChain(a) * b * c;
+
+  // Assert
+  ASSERT_EQ(chain.get_size(), 3);
+  ASSERT_DOUBLE_EQ(chain.OptimalCost(), 4500.0);
+  ASSERT_DOUBLE_EQ(chain.SequentialCost(), 4500.0);
+  ASSERT_EQ(chain.Parenthesization(), "((A0 A1) A2)");
+}
+
+TEST(MatrixChainSuite, RightAssociativeIsCheaper) {
+  // Arrange: вектор-строка в конце делает правую ассоциацию выгоднее
+  S21Matrix a = Filled(40, 40, 1.0);
+  S21Matrix b = Filled(40, 40, 2.0);
+  S21Matrix c = Filled(40, 1, 3.0);
+
+  // Act
+  S21MatrixChain chain({a, b, c});
+
+  // Assert
+  ASSERT_EQ(chain.Parenthesization(), "(A0 (A1 A2))");
+  ASSERT_LT(chain.OptimalCost(), chain.SequentialCost());
+}
+
+// --- Тестирование вычисления произведения ---
+TEST(MatrixChainSuite, EvaluateMatchesOperators) {
+  // Arrange
+  S21Matrix a = Filled(3, 7, 0.5);
+  S21Matrix b = Filled(7, 2, -1.0);
+  S21Matrix c = Filled(2, 9, 2.0);
+  S21Matrix d = Filled(9, 4, 1.5);
+
+  // Act
+  S21Matrix result = (S21MatrixChain(a) * b * c * d).Evaluate();
+
+  // Assert
+  ASSERT_TRUE(result == a * b * c * d);
+}
+
+TEST(MatrixChainSuite, SingleOperand) {
+  S21Matrix a = Filled(2, 2, 1.0);
+  S21MatrixChain chain(a);
+  ASSERT_TRUE(chain.Evaluate() == a);
+  ASSERT_DOUBLE_EQ(chain.OptimalCost(), 0.0);
+}
+
+TEST(MatrixChainSuite, Throws) {
+  S21Matrix a(2, 3);
+  S21Matrix b(2, 3);
+  S21MatrixChain chain(a);
+  ASSERT_THROW(chain *= b, std::invalid_argument);
+  ASSERT_THROW(S21MatrixChain().Evaluate(), std::logic_error);
+}
+
+// --- Тестирование защиты от временных операндов ---
+TEST(MatrixChainSuite, RejectsTemporaries) {
+  // Временные матрицы уничтожились бы до Evaluate()
+  static_assert(!std::is_constructible_v<S21MatrixChain, S21Matrix&&>);
+  static_assert(!kAppendable<S21Matrix&&>);
+  static_assert(kAppendable<const S21Matrix&>);
+  static_assert(kAppendable<S21Matrix&>);
+}
+
+// --- Тестирование одновременных константных вызовов ---
+TEST(MatrixChainSuite, ConcurrentConstUse) {
+  // Arrange
+  S21Matrix a = Filled(30, 4, 1.0);
+  S21Matrix b = Filled(4, 25, 2.0);
+  S21Matrix c = Filled(25, 3, 3.0);
+  S21Matrix d = Filled(3, 20, 4.0);
+  const S21MatrixChain chain = S21MatrixChain(a) * b * c * d;
+  S21Matrix expected = a * b * c * d;
+  std::vector<int> mismatches(4, 0);
+
+  // Act: порядок уже вычислен в Append, константные методы только читают
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int round = 0; round < 20; ++round) {
+        if (!(chain.Evaluate() == expected)) ++mismatches[t];
+        if (chain.Parenthesization() != "((A0 (A1 A2)) A3)") ++mismatches[t];
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  // Assert
+  for (int count : mismatches) ASSERT_EQ(count, 0);
+  ASSERT_DOUBLE_EQ(chain.OptimalCost(),
+                   4.0 * 25 * 3 + 30.0 * 4 * 3 + 30.0 * 3 * 20);
+}
@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "s21_matrix_io.h"
+
+namespace {
+// Временный файл, удаляемый в конце теста
+class TempFile {
+ public:
+  explicit TempFile(const std::string& name)
+      : path_((std::filesystem::temp_directory_path() /
+               ("s21_io_" + std::to_string(::getpid()) + "_" + name))
+                  .string()) {}
+  ~TempFile() { std::remove(path_.c_str()); }
+  const std::string& path() const { return path_; }
+  void Write(const std::string& text) const {
+    std::ofstream(path_, std::ios::binary) << text;
+  }
+
+ private:
+  std::string path_;
+};
+
+S21Matrix Awkward(int rows, int cols) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      m(i, j) = (i - j) / 3.0 + (i * cols + j) * 1e-3;
+    }
+  }
+  if (rows > 1 && cols > 1) {
+    m(0, 0) = 1e-300;
+    m(1, 1) = -3.5e200;
+    m(0, 1) = 0.0;
+  }
+  return m;
+}
+
+// Побитовое сравнение: запись и чтение должны быть точными
+void ExpectIdentical(const S21Matrix& a, const S21Matrix& b) {
+  ASSERT_EQ(a.get_rows(), b.get_rows());
+  ASSERT_EQ(a.get_cols(), b.get_cols());
+  for (int i = 0; i < a.get_rows(); ++i) {
+    for (int j = 0; j < a.get_cols(); ++j) ASSERT_EQ(a(i, j), b(i, j));
+  }
+}
+}  // namespace
+
+// --- Тестирование CSV ---
+TEST(MatrixIoSuite, CsvRoundTrip) {
+  // Arrange
+  TempFile file("round.csv");
+  S21Matrix m = Awkward(7, 5);
+
+  // Act
+  S21MatrixIo::WriteCsv(m, file.path());
+  S21Matrix read = S21MatrixIo::ReadCsv(file.path());
+
+  // Assert
+  ExpectIdentical(read, m);
+}
+
+TEST(MatrixIoSuite, CsvFormatting) {
+  // Arrange: пробелы, CRLF, пустые строки, знак плюс и другой разделитель
+  TempFile file("format.csv");
+  file.Write(" 1 ; +2.5;-3e2\r\n\n4;5 ;  6\r\n   \n");
+  S21TextIoOptions options;
+  options.delimiter = ';';
+
+  // Act
+  S21Matrix m = S21MatrixIo::ReadCsv(file.path(), options);
+
+  // Assert
+  ASSERT_EQ(m.get_rows(), 2);
+  ASSERT_EQ(m.get_cols(), 3);
+  ASSERT_DOUBLE_EQ(m(0, 1), 2.5);
+  ASSERT_DOUBLE_EQ(m(0, 2), -300.0);
+  ASSERT_DOUBLE_EQ(m(1, 2), 6.0);
+}
+
+TEST(MatrixIoSuite, CsvErrors) {
+  // Arrange
+  TempFile ragged("ragged.csv");
+  ragged.Write("1,2\n3\n");
+  TempFile bad("bad.csv");
+  bad.Write("1,x\n");
+  TempFile empty("empty.csv");
+  empty.Write("\n\n");
+
+  // Act & Assert
+  ASSERT_THROW(S21MatrixIo::ReadCsv(ragged.path()), std::invalid_argument);
+  ASSERT_THROW(S21MatrixIo::ReadCsv(bad.path()), std::invalid_argument);
+  ASSERT_THROW(S21MatrixIo::ReadCsv(empty.path()), std::invalid_argument);
+  ASSERT_THROW(S21MatrixIo::ReadCsv("/nonexistent/dir/m.csv"),
+               std::runtime_error);
+}
+
+TEST(MatrixIoSuite, ChunkedAndParallelParsing) {
+  // Arrange: блоки меньше одной строки и параллельный разбор каждого блока
+  TempFile file("chunks.csv");
+  S21Matrix m = Awkward(120, 90);
+  S21MatrixIo::WriteCsv(m, file.path());
+  S21TextIoOptions tiny;
+  tiny.chunk_bytes = 64;
+  S21TextIoOptions parallel;
+  parallel.chunk_bytes = 8192;
+  parallel.parallel_min_bytes = 0;
+  S21TextIoOptions serial;
+  serial.parallel = false;
+
+  // Act & Assert
+  ExpectIdentical(S21MatrixIo::ReadCsv(file.path(), tiny), m);
+  ExpectIdentical(S21MatrixIo::ReadCsv(file.path(), parallel), m);
+  ExpectIdentical(S21MatrixIo::ReadCsv(file.path(), serial), m);
+}
+
+// --- Тестирование Matrix Market ---
+TEST(MatrixIoSuite, MatrixMarketRoundTrip) {
+  // Arrange
+  TempFile array("array.mtx");
+  TempFile coordinate("coordinate.mtx");
+  S21Matrix m = Awkward(6, 4);
+
+  // Act
+  S21MatrixIo::WriteMatrixMarket(m, array.path());
+  S21MatrixIo::WriteMatrixMarket(m, coordinate.path(), true);
+
+  // Assert
+  ExpectIdentical(S21MatrixIo::ReadMatrixMarket(array.path()), m);
+  ExpectIdentical(S21MatrixIo::ReadMatrixMarket(coordinate.path()), m);
+}
+
+TEST(MatrixIoSuite, MatrixMarketStructures) {
+  // Arrange
+  TempFile symmetric("symmetric.mtx");
+  symmetric.Write(
+      "%%MatrixMarket matrix coordinate real symmetric\n"
+      "% comment\n"
+      "\n"
+      "  \t% indented comment\n"
+      "3 3 3\n"
+      "1 1 2.0\n"
+      "3 1 -1.5\n"
+      "% inner comment\n"
+      "2 2 4\n");
+  TempFile skew("skew.mtx");
+  skew.Write(
+      "%%MatrixMarket matrix array real skew-symmetric\n"
+      "3 3\n1\n2\n3\n");
+  TempFile pattern("pattern.mtx");
+  pattern.Write(
+      "%%MatrixMarket Matrix Coordinate Pattern General\n"
+      "2 3 2\n1 3\n2 1\n");
+
+  // Act
+  S21Matrix s = S21MatrixIo::ReadMatrixMarket(symmetric.path());
+  S21Matrix k = S21MatrixIo::ReadMatrixMarket(skew.path());
+  S21Matrix p = S21MatrixIo::ReadMatrixMarket(pattern.path());
+
+  // Assert
+  ASSERT_DOUBLE_EQ(s(0, 2), -1.5);
+  ASSERT_DOUBLE_EQ(s(2, 0), -1.5);
+  ASSERT_DOUBLE_EQ(s(1, 1), 4.0);
+  ASSERT_DOUBLE_EQ(k(1, 0), 1.0);
+  ASSERT_DOUBLE_EQ(k(0, 1), -1.0);
+  ASSERT_DOUBLE_EQ(k(2, 1), 3.0);
+  ASSERT_DOUBLE_EQ(k(1, 2), -3.0);
+  ASSERT_DOUBLE_EQ(k(2, 2), 0.0);
+  ASSERT_EQ(p.get_cols(), 3);
+  ASSERT_DOUBLE_EQ(p(0, 2), 1.0);
+  ASSERT_DOUBLE_EQ(p(1, 0), 1.0);
+  ASSERT_DOUBLE_EQ(p(1, 1), 0.0);
+}
+
+TEST(MatrixIoSuite, MatrixMarketErrors) {
+  // Arrange
+  TempFile banner("banner.mtx");
+  banner.Write("3 3\n1\n");
+  TempFile complex("complex.mtx");
+  complex.Write("%%MatrixMarket matrix array complex general\n1 1\n1 0\n");
+  TempFile count("count.mtx");
+  count.Write("%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n");
+  TempFile range("range.mtx");
+  range.Write("%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n");
+
+  // Act & Assert
+  ASSERT_THROW(S21MatrixIo::ReadMatrixMarket(banner.path()),
+               std::invalid_argument);
+  ASSERT_THROW(S21MatrixIo::ReadMatrixMarket(complex.path()),
+               std::invalid_argument);
+  ASSERT_THROW(S21MatrixIo::ReadMatrixMarket(count.path()),
+               std::invalid_argument);
+  ASSERT_THROW(S21MatrixIo::ReadMatrixMarket(range.path()),
+               std::invalid_argument);
+  // Размеры и индексы должны быть целыми и помещаться в int
+  const char* bad[] = {
+      "array real general\n2.5 2\n",
+      "array real general\n3000000000 1\n",
+      "array real general\nnan 1\n",
+      "coordinate real general\n2 2 0.5\n",
+      "coordinate real general\n2 2 5\n",
+      "coordinate real general\n2 2 1\n1.5 1 1\n",
+      "coordinate real general\n2 2 1\n1e20 1 1\n",
+      "coordinate real general\n2 2 1\n1 nan 1\n",
+  };
+  TempFile malformed("malformed.mtx");
+  for (const char* text : bad) {
+    malformed.Write(std::string("%%MatrixMarket matrix ") + text);
+    ASSERT_THROW(S21MatrixIo::ReadMatrixMarket(malformed.path()),
+                 std::invalid_argument)
+        << text;
+  }
+}
+
+// --- Тестирование printMatrix ---
+TEST(MatrixIoSuite, PrintMatrix) {
+  // Arrange
+  S21Matrix m(2, 2);
+  m(0, 0) = 1.25;
+  m(0, 1) = -2;
+  m(1, 1) = 10.04;
+
+  // Act
+  testing::internal::CaptureStdout();
+  m.printMatrix();
+  std::string output = testing::internal::GetCapturedStdout();
+
+  // Assert
+  ASSERT_EQ(output, "1.2 -2.0 \n0.0 10.0 \n");
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+S21Matrix DiagonallyDominant(int n) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      m(i, j) = (i == j) ? 2.0 * n : std::sin(i + 0.3 * j);
+    }
+  }
+  return m;
+}
+
+S21Matrix Hilbert(int n) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) m(i, j) = 1.0 / (i + j + 1.0);
+  }
+  return m;
+}
+}  // namespace
+
+// --- Тестирование уточнения в двойной точности ---
+TEST(MixedPrecisionSuite, RefinementReachesDoubleAccuracy) {
+  // Arrange
+  S21Matrix a = DiagonallyDominant(50);
+  S21Vector x(50);
+  for (int i = 0; i < 50; ++i) x(i) = 1.0 + 0.01 * i;
+  S21Vector b = a * x;
+  S21RefinementReport report;
+
+  // Act
+  S21Vector solution = a.SolveMixed(b, &report);
+
+  // Assert
+  ASSERT_FALSE(report.used_fallback);
+  ASSERT_GE(report.iterations, 1);
+  ASSERT_LT(report.backward_error, 1e-15);
+  for (int i = 0; i < 50; ++i) ASSERT_NEAR(solution(i), x(i), 1e-13);
+}
+
+TEST(MixedPrecisionSuite, InverseMatchesDouble) {
+  S21Matrix a = DiagonallyDominant(12);
+  S21RefinementReport report;
+  S21Matrix inverse = a.InverseMatrixMixed(&report);
+  ASSERT_TRUE(inverse == a.InverseMatrix());
+  ASSERT_FALSE(report.used_fallback);
+}
+
+// --- Тестирование перехода на двойную точность ---
+TEST(MixedPrecisionSuite, IllConditionedFallsBack) {
+  // Матрица Гильберта 10x10 слишком плохо обусловлена для float
+  S21Matrix a = Hilbert(10);
+  S21Vector b(10);
+  b(0) = 1.0;
+  S21RefinementReport report;
+
+  S21Vector solution = a.SolveMixed(b, &report);
+
+  ASSERT_TRUE(report.used_fallback);
+  ASSERT_TRUE(solution == a.Solve(b));
+}
+
+TEST(MixedPrecisionSuite, OutOfFloatRangeFallsBack) {
+  S21Matrix a(2, 2);
+  a(0, 0) = 1e300;
+  a(1, 1) = 1.0;
+  S21Matrix b(2, 1);
+  b(0, 0) = 1e300;
+  b(1, 0) = 2.0;
+  S21RefinementReport report;
+
+  S21Matrix solution = a.SolveMixed(b, &report);
+
+  ASSERT_TRUE(report.used_fallback);
+  ASSERT_DOUBLE_EQ(solution(0, 0), 1.0);
+  ASSERT_DOUBLE_EQ(solution(1, 0), 2.0);
+}
+
+TEST(MixedPrecisionSuite, Throws) {
+  ASSERT_THROW(S21Matrix(3, 3).SolveMixed(S21Vector(3)),
+               std::invalid_argument);
+  ASSERT_THROW(S21Matrix(2, 3).InverseMatrixMixed(), std::invalid_argument);
+  ASSERT_THROW(Hilbert(3).SolveMixed(S21Vector(2)), std::invalid_argument);
+}
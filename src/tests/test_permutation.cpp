@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <type_traits>
+
+#include "s21_permutation.h"
+#include "test_helpers.h"
+
+namespace {
+// Случайная перестановка [0, n)
+S21Permutation RandomPermutation(int n, unsigned seed) {
+  std::vector<int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937(seed));
+  return S21Permutation(order);
+}
+
+// Матрица, собранная по спискам индексов через operator()
+S21Matrix Gathered(const S21Matrix& m, const std::vector<int>& rows,
+                   const std::vector<int>& cols) {
+  S21Matrix result(static_cast<int>(rows.size()),
+                   static_cast<int>(cols.size()));
+  for (int i = 0; i < result.get_rows(); ++i) {
+    for (int j = 0; j < result.get_cols(); ++j) {
+      result(i, j) = m(rows[i], cols[j]);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+// --- Тестирование перестановок ---
+TEST(PermutationSuite, CompositionInverseAndSign) {
+  // Arrange
+  S21Permutation p({2, 0, 1, 3});
+  S21Permutation q({1, 0, 2, 3});
+
+  // Act
+  S21Permutation pq = p * q;
+  S21Permutation swapped = S21Permutation(4);
+  swapped.Swap(1, 3);
+
+  // Assert: p * q переставляет сначала по q, затем по p
+  ASSERT_EQ(pq[0], q[p[0]]);
+  ASSERT_EQ(p * p.Inverse(), S21Permutation(4));
+  ASSERT_EQ(p.Inverse() * p, S21Permutation(4));
+  ASSERT_EQ(p.Sign(), 1);
+  ASSERT_EQ(q.Sign(), -1);
+  ASSERT_EQ(pq.Sign(), -1);
+  ASSERT_EQ(swapped[1], 3);
+  ASSERT_THROW(S21Permutation({0, 0, 1}), std::invalid_argument);
+  ASSERT_THROW(S21Permutation({0, 3}), std::invalid_argument);
+  ASSERT_THROW(S21Permutation(0), std::invalid_argument);
+  ASSERT_THROW(p * S21Permutation(3), std::invalid_argument);
+  ASSERT_THROW(p[4], std::out_of_range);
+}
+
+// --- Тестирование перестановки на месте ---
+TEST(PermutationSuite, InPlacePermute) {
+  // Arrange
+  S21Matrix m = RandomMatrix(90, 70, 1);
+  S21Permutation rows = RandomPermutation(90, 2);
+  S21Permutation cols = RandomPermutation(70, 3);
+  S21Matrix shared = m;
+  std::vector<int> all_cols(70);
+  std::iota(all_cols.begin(), all_cols.end(), 0);
+
+  // Act
+  shared.PermuteRows(rows);
+  S21Matrix both = shared;
+  both.PermuteCols(cols);
+
+  // Assert
+  ASSERT_EQ(shared, Gathered(m, rows.data(), all_cols));
+  ASSERT_EQ(both, Gathered(m, rows.data(), cols.data()));
+  // Копия с общим буфером не изменилась
+  ASSERT_EQ(m, RandomMatrix(90, 70, 1));
+  both.PermuteCols(cols.Inverse());
+  both.PermuteRows(rows.Inverse());
+  ASSERT_EQ(both, m);
+  ASSERT_THROW(m.PermuteRows(cols), std::invalid_argument);
+  ASSERT_THROW(m.PermuteCols(rows), std::invalid_argument);
+}
+
+// --- Тестирование представлений с выборкой строк и столбцов ---
+TEST(PermutationSuite, GatherViews) {
+  // Arrange
+  S21Matrix m = RandomMatrix(6, 5, 4);
+  std::vector<int> rows = {5, 0, 0, 3};
+  std::vector<int> cols = {4, 1};
+
+  // Act
+  S21GatherView picked(m, rows, cols);
+  S21GatherView row_subset(m, rows, {});
+  S21GatherView whole = m;
+
+  // Assert
+  ASSERT_EQ(picked.get_rows(), 4);
+  ASSERT_EQ(picked.get_cols(), 2);
+  ASSERT_TRUE(picked.get_gathers_cols());
+  ASSERT_FALSE(row_subset.get_gathers_cols());
+  ASSERT_DOUBLE_EQ(picked(2, 0), m(0, 4));
+  ASSERT_EQ(picked.SourceRow(0), m.data() + 5 * 5);
+  ASSERT_EQ(picked.ToMatrix(), Gathered(m, rows, cols));
+  ASSERT_EQ(row_subset.ToMatrix(), Gathered(m, rows, {0, 1, 2, 3, 4}));
+  ASSERT_EQ(whole.ToMatrix(), m);
+  ASSERT_THROW(picked(4, 0), std::out_of_range);
+  ASSERT_THROW(S21GatherView(m, {6}, {}), std::out_of_range);
+  ASSERT_THROW(S21GatherView(m, S21Permutation(5), S21Permutation(5)),
+               std::invalid_argument);
+}
+
+// --- Тестирование арифметики над представлениями ---
+TEST(PermutationSuite, ArithmeticOnViews) {
+  // Arrange
+  S21Matrix a = RandomMatrix(40, 30, 5);
+  S21Matrix b = RandomMatrix(30, 50, 6);
+  S21Permutation pr = RandomPermutation(40, 7);
+  S21Permutation pc = RandomPermutation(30, 8);
+  S21Permutation pb = RandomPermutation(50, 9);
+  S21GatherView va(a, pr, pc);
+  S21GatherView vb(b, pc.Inverse(), pb);
+  S21GatherView va_rows(a, pr.data(), {});
+  S21Matrix ma = va.ToMatrix();
+  S21Matrix mb = vb.ToMatrix();
+  S21Vector x(30);
+  for (int i = 0; i < 30; ++i) x(i) = b(i, 0);
+
+  // Act & Assert
+  ExpectNear(S21GatherOps::Multiply(va, vb), ma * mb, 1e-12);
+  ExpectNear(S21GatherOps::Multiply(va_rows, b), va_rows.ToMatrix() * b,
+             1e-12);
+  ExpectNear(S21GatherOps::Multiply(a, vb), a * mb, 1e-12);
+  S21Vector y = S21GatherOps::MulVector(va, x);
+  S21Vector expected = ma * x;
+  for (int i = 0; i < 40; ++i) ASSERT_NEAR(y(i), expected(i), 1e-12);
+  S21Matrix hadamard = ma;
+  hadamard.HadamardMul(a);
+  ASSERT_EQ(S21GatherOps::Add(va, a), ma + a);
+  ASSERT_EQ(S21GatherOps::Sub(a, va), a - ma);
+  ASSERT_EQ(S21GatherOps::HadamardMul(va, a), hadamard);
+  ASSERT_EQ(S21GatherOps::Add(va_rows, va_rows), va_rows.ToMatrix() * 2.0);
+  ASSERT_THROW(S21GatherOps::Multiply(va, va), std::invalid_argument);
+  ASSERT_THROW(S21GatherOps::Add(va, b), std::invalid_argument);
+  ASSERT_THROW(S21GatherOps::MulVector(va, S21Vector(40)),
+               std::invalid_argument);
+}
+
+// --- Тестирование запрета представлений временных матриц ---
+TEST(PermutationSuite, GatherViewRejectsTemporaries) {
+  // Представление хранит указатель на источник
+  static_assert(!std::is_constructible_v<S21GatherView, S21Matrix&&>);
+  static_assert(!std::is_convertible_v<S21Matrix&&, S21GatherView>);
+  static_assert(!std::is_constructible_v<S21GatherView, S21Matrix&&,
+                                         std::vector<int>, std::vector<int>>);
+  static_assert(
+      !std::is_constructible_v<S21GatherView, const S21Matrix&&,
+                               const S21Permutation&, const S21Permutation&>);
+  static_assert(std::is_convertible_v<const S21Matrix&, S21GatherView>);
+  static_assert(std::is_constructible_v<S21GatherView, S21Matrix&,
+                                        std::vector<int>, std::vector<int>>);
+}
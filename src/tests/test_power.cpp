@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+S21Matrix Fibonacci() {
+  S21Matrix m(2, 2);
+  m(0, 0) = 1;
+  m(0, 1) = 1;
+  m(1, 0) = 1;
+  return m;
+}
+}  // namespace
+
+// --- Тестирование Pow ---
+TEST(PowerSuite, PositivePower) {
+  // Arrange
+  S21Matrix m = Fibonacci();
+
+  // Act
+  S21Matrix result = m.Pow(10);
+
+  // Assert: F(11), F(10), F(9)
+  ASSERT_DOUBLE_EQ(result(0, 0), 89.0);
+  ASSERT_DOUBLE_EQ(result(0, 1), 55.0);
+  ASSERT_DOUBLE_EQ(result(1, 0), 55.0);
+  ASSERT_DOUBLE_EQ(result(1, 1), 34.0);
+}
+
+TEST(PowerSuite, MatchesRepeatedMultiplication) {
+  S21Matrix m(3, 3);
+  m(0, 0) = 0.5;
+  m(0, 1) = 0.25;
+  m(0, 2) = 0.25;
+  m(1, 0) = 0.1;
+  m(1, 1) = 0.8;
+  m(1, 2) = 0.1;
+  m(2, 0) = 0.3;
+  m(2, 1) = 0.3;
+  m(2, 2) = 0.4;
+
+  S21Matrix expected = m;
+  for (int i = 1; i < 7; ++i) expected *= m;
+
+  ASSERT_TRUE(m.Pow(7) == expected);
+}
+
+TEST(PowerSuite, ZeroAndNegativePower) {
+  // Arrange
+  S21Matrix m = Fibonacci();
+  S21Matrix identity(2, 2);
+  identity(0, 0) = 1;
+  identity(1, 1) = 1;
+  S21Matrix inverse = m.InverseMatrix();
+
+  // Act & Assert
+  ASSERT_TRUE(m.Pow(0) == identity);
+  ASSERT_TRUE(m.Pow(-3) == inverse * inverse * inverse);
+  ASSERT_TRUE(m.Pow(-3) * m.Pow(3) == identity);
+}
+
+TEST(PowerSuite, PowThrows) {
+  S21Matrix rect(2, 3);
+  S21Matrix singular(2, 2);
+  ASSERT_THROW(rect.Pow(2), std::invalid_argument);
+  ASSERT_THROW(singular.Pow(-1), std::invalid_argument);
+}
+
+// --- Тестирование PowSymmetric ---
+TEST(PowerSuite, SymmetricEigenPower) {
+  // Arrange
+  S21Matrix m(3, 3);
+  m(0, 0) = 2;
+  m(0, 1) = -1;
+  m(1, 0) = -1;
+  m(1, 1) = 2;
+  m(1, 2) = -1;
+  m(2, 1) = -1;
+  m(2, 2) = 2;
+
+  // Act
+  S21Matrix eigen = m.PowSymmetric(5);
+  S21Matrix eigen_inverse = m.PowSymmetric(-1);
+
+  // Assert
+  ASSERT_TRUE(eigen == m.Pow(5));
+  ASSERT_TRUE(eigen_inverse == m.InverseMatrix());
+}
+
+TEST(PowerSuite, PowSymmetricThrows) {
+  S21Matrix m = Fibonacci();
+  m(0, 1) = 2;
+  ASSERT_THROW(m.PowSymmetric(3), std::invalid_argument);
+  ASSERT_THROW(S21Matrix(2, 2).PowSymmetric(-1), std::invalid_argument);
+}
+
+// --- Тестирование относительного критерия вырожденности ---
+TEST(PowerSuite, PowSymmetricSingularityIsRelative) {
+  // Arrange
+  S21Matrix small(3, 3);
+  for (int i = 0; i < 3; ++i) small(i, i) = 1e-8;
+  S21Matrix nearly_singular = small;
+  nearly_singular(0, 0) = 1e8;
+
+  // Act
+  S21Matrix inverse = small.PowSymmetric(-1);
+
+  // Assert: малый масштаб не делает матрицу вырожденной
+  for (int i = 0; i < 3; ++i) ASSERT_NEAR(inverse(i, i), 1e8, 1e-6);
+  ASSERT_THROW(nearly_singular.PowSymmetric(-1), std::invalid_argument);
+}
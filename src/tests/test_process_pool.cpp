@@ -0,0 +1,113 @@
+#include <fcntl.h>
+#include <signal.h>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <memory>
+#include <vector>
+
+#include "s21_process_pool.h"
+#include "test_helpers.h"
+
+// --- Тестирование видимости сегмента в другом процессе ---
+TEST(ProcessPoolSuite, SharedMatrixAcrossProcesses) {
+  // Arrange
+  S21SharedMatrix shared(RandomMatrix(3, 4, 1));
+  std::string name = shared.get_name();
+
+  // Act: дочерний процесс открывает сегмент по имени и пишет в него
+  pid_t child = fork();
+  if (child == 0) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    void* memory = fd < 0 ? MAP_FAILED
+                          : mmap(nullptr, 12 * sizeof(double),
+                                 PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) _exit(1);
+    static_cast<double*>(memory)[1 * 4 + 2] = 42.0;
+    _exit(0);
+  }
+  int status = 0;
+  waitpid(child, &status, 0);
+
+  // Assert
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+  ASSERT_DOUBLE_EQ(shared(1, 2), 42.0);
+  S21SharedMatrix moved = std::move(shared);
+  ASSERT_EQ(moved.get_name(), name);
+  ASSERT_DOUBLE_EQ(moved.ToMatrix()(1, 2), 42.0);
+  ASSERT_THROW(moved(3, 0), std::out_of_range);
+  ASSERT_THROW(S21SharedMatrix(0, 2), std::invalid_argument);
+}
+
+// --- Тестирование умножения в пуле процессов ---
+TEST(ProcessPoolSuite, MultiplyMatchesSerialProduct) {
+  // Arrange
+  S21ProcessPool pool(3);
+  S21Matrix a = RandomMatrix(150, 200, 2);
+  S21Matrix b = RandomMatrix(200, 600, 3);
+  S21SharedMatrix sa(a);
+  S21SharedMatrix sb(b);
+  S21SharedMatrix sc(150, 600);
+
+  // Act
+  pool.Multiply(sa, sb, sc);
+
+  // Assert
+  ASSERT_EQ(pool.get_workers(), 3);
+  ExpectNear(sc.ToMatrix(), a * b, 1e-12);
+  // Повторные задания используют те же барьеры
+  for (unsigned seed = 4; seed < 8; ++seed) {
+    S21Matrix x = RandomMatrix(70, 90, seed);
+    S21Matrix y = RandomMatrix(90, 300, seed + 10);
+    ExpectNear(pool.Multiply(x, y), x * y, 1e-12);
+  }
+}
+
+// --- Тестирование крайних случаев и ошибок ---
+TEST(ProcessPoolSuite, EdgeCasesAndErrors) {
+  // Arrange
+  S21ProcessPool pool(2);
+  S21ProcessPool local(0);
+  S21Matrix a = RandomMatrix(1, 5, 8);
+  S21Matrix b = RandomMatrix(5, 1, 9);
+  S21SharedMatrix sa(a);
+  S21SharedMatrix wrong(4, 4);
+
+  // Act & Assert: плиток меньше, чем процессов
+  ExpectNear(pool.Multiply(a, b), a * b, 1e-15);
+  ExpectNear(local.Multiply(b, a), b * a, 1e-15);
+  ASSERT_THROW(pool.Multiply(a, a), std::invalid_argument);
+  ASSERT_THROW(pool.Multiply(sa, wrong, wrong), std::invalid_argument);
+  ASSERT_THROW(S21ProcessPool(-1), std::invalid_argument);
+}
+
+// --- Тестирование погибших и остановленных рабочих ---
+TEST(ProcessPoolSuite, DeadAndStoppedWorkers) {
+  // Arrange
+  S21Matrix a = RandomMatrix(130, 90, 10);
+  S21Matrix b = RandomMatrix(90, 300, 11);
+  S21Matrix expected = a * b;
+  auto pool = std::make_unique<S21ProcessPool>(3);
+  std::vector<pid_t> pids = pool->get_pids();
+  ASSERT_EQ(pids.size(), 3u);
+
+  // Act & Assert: убитый рабочий не блокирует умножение
+  kill(pids[0], SIGKILL);
+  siginfo_t info{};
+  waitid(P_PID, pids[0], &info, WEXITED | WNOWAIT);
+  ExpectNear(pool->Multiply(a, b), expected, 1e-12);
+  ASSERT_EQ(pool->get_workers(), 2);
+  // Остановленный рабочий пропускает задание
+  kill(pids[1], SIGSTOP);
+  ExpectNear(pool->Multiply(a, b), expected, 1e-12);
+  kill(pids[1], SIGCONT);
+  ExpectNear(pool->Multiply(a, b), expected, 1e-12);
+  // Деструктор не ждёт остановленного рабочего бесконечно
+  kill(pids[2], SIGSTOP);
+  pool.reset();
+  ASSERT_EQ(waitpid(pids[2], nullptr, WNOHANG), -1);
+  ASSERT_THROW(S21ProcessPool(257), std::invalid_argument);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <execution>
+#include <numeric>
+
+#include "s21_matrix_oop.h"
+
+// --- Тестирование data() и stride() ---
+TEST(RawAccessSuite, DataIsRowMajor) {
+  // Arrange
+  S21Matrix m(2, 3);
+  m(1, 2) = 7.0;
+
+  // Act
+  double* data = m.data();
+
+  // Assert
+  ASSERT_EQ(m.stride(), 3);
+  ASSERT_DOUBLE_EQ(data[1 * m.stride() + 2], 7.0);
+  data[0] = -1.0;
+  ASSERT_DOUBLE_EQ(m(0, 0), -1.0);
+}
+
+// --- Тестирование row() ---
+TEST(RawAccessSuite, RowSpan) {
+  // Arrange
+  S21Matrix m(3, 2);
+  m(2, 0) = 4.0;
+  m(2, 1) = 5.0;
+  const S21Matrix& const_m = m;
+
+  // Act
+  std::span<double> row = m.row(2);
+  row[1] = 6.0;
+
+  // Assert
+  ASSERT_EQ(row.size(), 2u);
+  ASSERT_DOUBLE_EQ(const_m.row(2)[0], 4.0);
+  ASSERT_DOUBLE_EQ(m(2, 1), 6.0);
+  ASSERT_THROW(m.row(3), std::out_of_range);
+  ASSERT_THROW(const_m.row(-1), std::out_of_range);
+}
+
+// --- Тестирование At с политиками доступа ---
+TEST(RawAccessSuite, AccessPolicies) {
+  S21Matrix m(2, 2);
+  m.At<S21UncheckedAccess>(1, 1) = 3.0;
+  const S21Matrix& const_m = m;
+
+  ASSERT_DOUBLE_EQ(m.At(1, 1), 3.0);
+  ASSERT_DOUBLE_EQ(const_m.At<S21UncheckedAccess>(1, 1), 3.0);
+  ASSERT_THROW(m.At(2, 0), std::out_of_range);
+  ASSERT_THROW(const_m.At<S21CheckedAccess>(0, -1), std::out_of_range);
+  // Чтение через const не меняет версию, запись без проверки — меняет
+  std::uint64_t version = m.get_version();
+  ASSERT_DOUBLE_EQ(const_m.At<S21UncheckedAccess>(0, 0), 0.0);
+  ASSERT_EQ(m.get_version(), version);
+  m.At<S21UncheckedAccess>(0, 0) = 1.0;
+  ASSERT_NE(m.get_version(), version);
+}
+
+// --- Тестирование итераторов и алгоритмов STL ---
+TEST(RawAccessSuite, IteratorsWithAlgorithms) {
+  // Arrange
+  S21Matrix m(4, 5);
+  std::iota(m.begin(), m.end(), 1.0);
+
+  // Act
+  std::transform(std::execution::par_unseq, m.begin(), m.end(), m.begin(),
+                 [](double v) { return 2.0 * v; });
+  double sum = std::reduce(std::execution::par_unseq, m.cbegin(), m.cend());
+
+  // Assert
+  ASSERT_EQ(m.end() - m.begin(), 20);
+  ASSERT_DOUBLE_EQ(m(0, 0), 2.0);
+  ASSERT_DOUBLE_EQ(m(3, 4), 40.0);
+  ASSERT_DOUBLE_EQ(sum, 420.0);
+  ASSERT_DOUBLE_EQ(*std::max_element(m.cbegin(), m.cend()), 40.0);
+}
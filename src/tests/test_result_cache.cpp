@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "s21_result_cache.h"
+#include "test_helpers.h"
+
+namespace {
+// Включает пустой кэш на время теста и восстанавливает настройки
+class ResultCacheSuite : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    capacity_ = S21ResultCache::get_capacity();
+    S21ResultCache::Clear();
+    S21ResultCache::set_enabled(true);
+  }
+
+  void TearDown() override {
+    S21ResultCache::set_enabled(false);
+    S21ResultCache::set_capacity(capacity_);
+    S21ResultCache::Clear();
+  }
+
+ private:
+  std::size_t capacity_ = 0;
+};
+}  // namespace
+
+// --- Тестирование попаданий для разных экземпляров ---
+TEST_F(ResultCacheSuite, HitsAcrossInstances) {
+  // Arrange: две матрицы с одинаковым содержимым и разными буферами
+  S21Matrix a = DominantMatrix(20, 20, 1);
+  S21Matrix b = DominantMatrix(20, 20, 1);
+  ASSERT_NE(a.data(), b.data());
+
+  // Act: у b нет своей LU-факторизации, поэтому он идёт в кэш
+  S21Matrix first = a.InverseMatrix();
+  S21Matrix second = b.InverseMatrix();
+  double det_b = b.Determinant();
+  double det_copy = DominantMatrix(20, 20, 1).Determinant();
+  S21Matrix complements = DominantMatrix(20, 20, 1).CalcComplements();
+  S21Matrix complements_copy = DominantMatrix(20, 20, 1).CalcComplements();
+
+  // Assert
+  S21CacheStats stats = S21ResultCache::get_stats();
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(det_b, det_copy);
+  ASSERT_EQ(complements, complements_copy);
+  // Промахи: обратная, определитель и дополнения; обратная внутри
+  // CalcComplements не ищется и не сохраняется
+  ASSERT_EQ(stats.hits, 3u);
+  ASSERT_EQ(stats.misses, 3u);
+  ASSERT_EQ(stats.entries, 3u);
+  ASSERT_GT(stats.bytes, 3 * 20 * 20 * sizeof(double));
+  // Матрица с актуальной LU-факторизацией считает по ней без хеширования
+  ASSERT_EQ(a.Determinant(), det_b);
+  ASSERT_EQ(a.CalcComplements(), complements);
+  ASSERT_EQ(a.InverseMatrix(), first);
+  stats = S21ResultCache::get_stats();
+  ASSERT_EQ(stats.hits + stats.misses, 6u);
+  // Результаты разных бэкендов хранятся раздельно
+  S21Backend backend = S21LinearAlgebra::get_backend();
+  S21LinearAlgebra::set_backend(backend == S21Backend::kBuiltin
+                                    ? S21Backend::kOpenBlas
+                                    : S21Backend::kBuiltin);
+  DominantMatrix(20, 20, 1).Determinant();
+  S21LinearAlgebra::set_backend(backend);
+  DominantMatrix(20, 20, 1).Determinant();
+  stats = S21ResultCache::get_stats();
+  ASSERT_EQ(stats.misses, 4u);
+  ASSERT_EQ(stats.hits, 4u);
+  ASSERT_EQ(stats.entries, 4u);
+  // Матрицы до 4x4 не кэшируются
+  S21Matrix small = DominantMatrix(4, 4, 2);
+  small.InverseMatrix();
+  small.Determinant();
+  ASSERT_EQ(S21ResultCache::get_stats().entries, 4u);
+}
+
+// --- Тестирование хеша и проверки содержимого ---
+TEST_F(ResultCacheSuite, ChangedContentsMiss) {
+  // Arrange
+  S21Matrix a = DominantMatrix(9, 9, 3);
+  S21Matrix changed = DominantMatrix(9, 9, 3);
+  changed(8, 8) = std::nextafter(changed(8, 8), 100.0);
+  S21Matrix swapped = DominantMatrix(9, 9, 3);
+  for (int j = 0; j < 9; ++j) std::swap(swapped(0, j), swapped(1, j));
+  S21Matrix wide(3, 12);
+  S21Matrix tall(12, 3);
+
+  // Act
+  double det = a.Determinant();
+  double det_changed = changed.Determinant();
+
+  // Assert
+  ASSERT_EQ(S21ResultCache::Hash(a),
+            S21ResultCache::Hash(DominantMatrix(9, 9, 3)));
+  ASSERT_NE(S21ResultCache::Hash(a), S21ResultCache::Hash(changed));
+  ASSERT_NE(S21ResultCache::Hash(a), S21ResultCache::Hash(swapped));
+  ASSERT_NE(S21ResultCache::Hash(wide), S21ResultCache::Hash(tall));
+  ASSERT_NE(det, det_changed);
+  ASSERT_NEAR(swapped.Determinant(), -det, 1e-9 * std::fabs(det));
+  S21CacheStats stats = S21ResultCache::get_stats();
+  ASSERT_EQ(stats.hits, 0u);
+  ASSERT_EQ(stats.misses, 3u);
+  ASSERT_EQ(stats.collisions, 0u);
+}
+
+// --- Тестирование дополнений вырожденной матрицы ---
+TEST_F(ResultCacheSuite, SingularComplementsSkipMinors) {
+  // Arrange: две одинаковые строки делают матрицу вырожденной
+  S21Matrix singular = DominantMatrix(12, 12, 7);
+  for (int j = 0; j < 12; ++j) singular(11, j) = singular(0, j);
+
+  // Act
+  S21Matrix complements = singular.CalcComplements();
+
+  // Assert: в кэш попадает только сам результат, миноры его не трогают
+  S21CacheStats stats = S21ResultCache::get_stats();
+  ASSERT_EQ(stats.misses, 1u);
+  ASSERT_EQ(stats.entries, 1u);
+  ASSERT_EQ(stats.evictions, 0u);
+  // Копия без своей факторизации находит результат в кэше
+  S21Matrix copy = DominantMatrix(12, 12, 7);
+  for (int j = 0; j < 12; ++j) copy(11, j) = copy(0, j);
+  ASSERT_EQ(copy.CalcComplements(), complements);
+  ASSERT_EQ(S21ResultCache::get_stats().hits, 1u);
+}
+
+// --- Тестирование ограничения памяти и вытеснения ---
+TEST_F(ResultCacheSuite, CapacityAndEviction) {
+  // Arrange: каждый определитель 20x20 занимает больше 3200 байт
+  S21Matrix m1 = DominantMatrix(20, 20, 4);
+  S21Matrix m2 = DominantMatrix(20, 20, 5);
+  S21Matrix m3 = DominantMatrix(20, 20, 6);
+  S21ResultCache::set_capacity(8000);
+
+  // Act
+  m1.Determinant();
+  m2.Determinant();
+  // Копия m1 без своей факторизации; m1 становится самым свежим
+  DominantMatrix(20, 20, 4).Determinant();
+  m3.Determinant();  // вытесняет m2
+
+  // Assert
+  S21CacheStats stats = S21ResultCache::get_stats();
+  ASSERT_EQ(stats.entries, 2u);
+  ASSERT_EQ(stats.evictions, 1u);
+  ASSERT_LE(stats.bytes, 8000u);
+  DominantMatrix(20, 20, 4).Determinant();
+  ASSERT_EQ(S21ResultCache::get_stats().hits, 2u);
+  DominantMatrix(20, 20, 5).Determinant();
+  ASSERT_EQ(S21ResultCache::get_stats().hits, 2u);
+  // Результат больше ёмкости не сохраняется
+  S21ResultCache::set_capacity(1000);
+  ASSERT_EQ(S21ResultCache::get_stats().entries, 0u);
+  DominantMatrix(20, 20, 4).InverseMatrix();
+  ASSERT_EQ(S21ResultCache::get_stats().entries, 0u);
+  // Выключенный кэш не ищет и не сохраняет
+  S21ResultCache::set_capacity(1 << 20);
+  S21ResultCache::set_enabled(false);
+  DominantMatrix(20, 20, 4).InverseMatrix();
+  ASSERT_EQ(S21ResultCache::get_stats().entries, 0u);
+  S21ResultCache::Clear();
+  ASSERT_EQ(S21ResultCache::get_stats().misses, 0u);
+}
+
+// --- Тестирование многопоточности и вырожденных матриц ---
+TEST_F(ResultCacheSuite, ConcurrentLookups) {
+  // Arrange
+  std::vector<S21Matrix> inputs;
+  std::vector<S21Matrix> expected;
+  S21ResultCache::set_enabled(false);
+  for (unsigned seed = 0; seed < 6; ++seed) {
+    inputs.push_back(DominantMatrix(12, 12, 10 + seed));
+    expected.push_back(inputs.back().InverseMatrix());
+  }
+  S21ResultCache::set_enabled(true);
+  S21Matrix singular(8, 8);
+  singular(0, 0) = 1.0;
+  std::vector<int> mismatches(4, 0);
+
+  // Act
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int round = 0; round < 50; ++round) {
+        int k = (round + t) % 6;
+        S21Matrix copy = DominantMatrix(12, 12, 10 + k);
+        if (!(copy.InverseMatrix() == expected[k])) ++mismatches[t];
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  // Assert
+  for (int count : mismatches) ASSERT_EQ(count, 0);
+  S21CacheStats stats = S21ResultCache::get_stats();
+  ASSERT_EQ(stats.hits + stats.misses, 200u);
+  ASSERT_GE(stats.hits, 200u - 4 * 6);
+  ASSERT_EQ(stats.entries, 6u);
+  // Ошибка вычисления не кэшируется
+  ASSERT_THROW(singular.InverseMatrix(), std::invalid_argument);
+  ASSERT_THROW(singular.InverseMatrix(), std::invalid_argument);
+  ASSERT_EQ(S21ResultCache::get_stats().entries, 6u);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+// Счётчик выделений кучи во всей тестовой программе
+std::atomic<long> heap_allocations{0};
+
+bool StoredInline(const S21Matrix& m) {
+  const char* begin = reinterpret_cast<const char*>(&m);
+  const char* element = reinterpret_cast<const char*>(m.data());
+  return element >= begin && element < begin + sizeof(S21Matrix);
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+  heap_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// --- Тестирование встроенного буфера ---
+TEST(SmallBufferSuite, SmallTemporariesDoNotAllocate) {
+  // Arrange
+  S21Matrix a(3, 3);
+  S21Matrix b(3, 3);
+  for (int i = 0; i < 3; ++i) {
+    a(i, i) = 2.0;
+    b(i, 2 - i) = 1.0;
+  }
+
+  // Act
+  long before = heap_allocations.load();
+  S21Matrix product = a * b;
+  S21Matrix sum = a + b;
+  S21Matrix inverse = a.InverseMatrix();
+  S21Matrix transposed = product.Transpose();
+  S21Matrix square(4, 4);
+  S21Matrix copy = square;
+  long after = heap_allocations.load();
+
+  // Assert
+  ASSERT_EQ(after, before);
+  ASSERT_DOUBLE_EQ(product(0, 2), 2.0);
+  ASSERT_DOUBLE_EQ(sum(1, 1), 3.0);
+  ASSERT_DOUBLE_EQ(inverse(2, 2), 0.5);
+  ASSERT_DOUBLE_EQ(transposed(2, 0), 2.0);
+  ASSERT_TRUE(copy == square);
+}
+
+TEST(SmallBufferSuite, StorageMode) {
+  // Arrange & Act
+  S21Matrix small(4, 4);
+  S21Matrix vector(1, 16);
+  S21Matrix large(3, 6);
+
+  // Assert
+  ASSERT_TRUE(StoredInline(small));
+  ASSERT_TRUE(StoredInline(vector));
+  ASSERT_FALSE(StoredInline(large));
+}
+
+TEST(SmallBufferSuite, MoveBetweenModes) {
+  // Arrange
+  S21Matrix small(2, 2);
+  small(1, 0) = 5.0;
+  S21Matrix large(5, 5);
+  large(4, 4) = 7.0;
+  const double* large_storage = std::as_const(large).data();
+
+  // Act
+  S21Matrix moved_small = std::move(small);
+  S21Matrix target(2, 2);
+  target = std::move(large);
+  S21Matrix back(6, 6);
+  back = std::move(moved_small);
+
+  // Assert: инлайн-данные копируются, куча передаётся без копирования
+  ASSERT_DOUBLE_EQ(back(1, 0), 5.0);
+  ASSERT_TRUE(StoredInline(back));
+  ASSERT_DOUBLE_EQ(target(4, 4), 7.0);
+  ASSERT_EQ(std::as_const(target).data(), large_storage);
+  ASSERT_EQ(small.get_rows(), 0);
+  ASSERT_EQ(large.get_rows(), 0);
+}
+
+TEST(SmallBufferSuite, ResizeAcrossThreshold) {
+  // Arrange
+  S21Matrix m(4, 4);
+  m(3, 3) = 1.5;
+
+  // Act
+  m.set_rows(6);
+  m(5, 0) = 2.5;
+  m.set_rows(2);
+  m.set_cols(8);
+
+  // Assert
+  ASSERT_TRUE(StoredInline(m));
+  ASSERT_EQ(m.get_cols(), 8);
+  ASSERT_DOUBLE_EQ(m(1, 3), 0.0);
+}
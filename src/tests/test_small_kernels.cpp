@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+// Матрица n x n с детерминированными «случайными» элементами
+S21Matrix Sample(int n, int seed) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      m(i, j) = ((i * 7 + j * 13 + seed * 5) % 17) / 4.0 - 2.0;
+    }
+    m(i, i) += n;
+  }
+  return m;
+}
+
+// Блочно-диагональная матрица diag(m, 1): n + 1 > 4 идёт через LU
+S21Matrix Embed(const S21Matrix& m) {
+  int n = m.get_rows();
+  S21Matrix result(n + 1, n + 1);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) result(i, j) = m(i, j);
+  }
+  result(n, n) = 1.0;
+  return result;
+}
+}  // namespace
+
+// --- Тестирование замкнутых формул для n <= 4 ---
+TEST(SmallKernelsSuite, DeterminantMatchesLu) {
+  for (int n = 1; n <= 4; ++n) {
+    for (int seed = 0; seed < 5; ++seed) {
+      // Arrange
+      S21Matrix m = Sample(n, seed);
+
+      // Act
+      double det = m.Determinant();
+
+      // Assert
+      ASSERT_NEAR(det, Embed(m).Determinant(), 1e-9 * std::fabs(det));
+    }
+  }
+}
+
+TEST(SmallKernelsSuite, InverseMatchesLu) {
+  for (int n = 1; n <= 4; ++n) {
+    // Arrange
+    S21Matrix m = Sample(n, n);
+
+    // Act
+    S21Matrix inverse = m.InverseMatrix();
+    S21Matrix reference = Embed(m).InverseMatrix();
+
+    // Assert
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        ASSERT_NEAR(inverse(i, j), reference(i, j), 1e-12);
+      }
+    }
+  }
+}
+
+TEST(SmallKernelsSuite, ComplementsOfSingular4x4) {
+  // Arrange: четвёртая строка равна сумме первых двух, ранг 3
+  S21Matrix m = Sample(4, 1);
+  for (int j = 0; j < 4; ++j) m(3, j) = m(0, j) + m(1, j);
+
+  // Act
+  S21Matrix complements = m.CalcComplements();
+  S21Matrix product = m * complements.Transpose();
+
+  // Assert: A * adj(A) = det(A) * I = 0, но adj(A) ненулевая
+  ASSERT_NEAR(m.Determinant(), 0.0, 1e-12);
+  double largest = 0.0;
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_NEAR(product(i, j), 0.0, 1e-9);
+      largest = std::fmax(largest, std::fabs(complements(i, j)));
+    }
+  }
+  ASSERT_GT(largest, 1.0);
+  ASSERT_THROW(m.InverseMatrix(), std::invalid_argument);
+}
+
+TEST(SmallKernelsSuite, Complements2x2) {
+  // Arrange
+  S21Matrix m(2, 2);
+  m(0, 0) = 1;
+  m(0, 1) = 2;
+  m(1, 0) = 3;
+  m(1, 1) = 4;
+
+  // Act
+  S21Matrix complements = m.CalcComplements();
+
+  // Assert
+  ASSERT_EQ(complements(0, 0), 4);
+  ASSERT_EQ(complements(0, 1), -3);
+  ASSERT_EQ(complements(1, 0), -2);
+  ASSERT_EQ(complements(1, 1), 1);
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "s21_band_matrix.h"
+#include "s21_symmetric_matrix.h"
+#include "s21_triangular_matrix.h"
+
+namespace {
+S21Matrix Dense(int rows, int cols, int seed) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      m(i, j) = ((i * 5 + j * 3 + seed) % 11) / 2.0 - 2.5;
+    }
+  }
+  return m;
+}
+
+S21Vector Sequence(int n) {
+  S21Vector v(n);
+  for (int i = 0; i < n; ++i) v(i) = 1.0 + i % 4 - 0.5 * (i % 3);
+  return v;
+}
+
+void ExpectNear(const S21Vector& a, const S21Vector& b, double tolerance) {
+  ASSERT_EQ(a.get_size(), b.get_size());
+  for (int i = 0; i < a.get_size(); ++i) ASSERT_NEAR(a(i), b(i), tolerance);
+}
+}  // namespace
+
+// --- Тестирование симметричных матриц ---
+TEST(StructuredSuite, SymmetricMatchesDense) {
+  // Arrange
+  S21Matrix base = Dense(7, 7, 1);
+  S21Matrix dense = base + base.Transpose();
+  S21SymmetricMatrix packed(dense);
+  S21Matrix other = Dense(7, 3, 2);
+  S21Vector x = Sequence(7);
+
+  // Act
+  S21Matrix product = packed.MulMatrix(other);
+  S21Vector y = packed.MulVector(x);
+
+  // Assert
+  ASSERT_TRUE(packed.ToDense() == dense);
+  ASSERT_TRUE(product == dense * other);
+  ExpectNear(y, dense * x, 1e-12);
+  ASSERT_NEAR(packed.Determinant(), dense.Determinant(),
+              1e-9 * std::fabs(dense.Determinant()));
+}
+
+TEST(StructuredSuite, SymmetricSharedElementAndIndefinite) {
+  // Arrange: нулевой ведущий элемент требует перехода на LU
+  S21SymmetricMatrix m(3);
+  m(1, 0) = 2.0;
+  m(2, 2) = 3.0;
+  m(2, 1) = 1.0;
+
+  // Act & Assert
+  ASSERT_DOUBLE_EQ(m(0, 1), 2.0);
+  ASSERT_NEAR(m.Determinant(), -12.0, 1e-12);
+  ASSERT_THROW(S21SymmetricMatrix(Dense(3, 3, 0)), std::invalid_argument);
+  ASSERT_THROW(m(3, 0), std::out_of_range);
+}
+
+// --- Тестирование треугольных матриц ---
+TEST(StructuredSuite, TriangularSolveAndMultiply) {
+  for (S21Triangle triangle : {S21Triangle::kLower, S21Triangle::kUpper}) {
+    // Arrange
+    S21TriangularMatrix t(6, triangle);
+    for (int i = 0; i < 6; ++i) {
+      for (int j = 0; j < 6; ++j) {
+        bool inside = triangle == S21Triangle::kLower ? j <= i : j >= i;
+        if (inside) t(i, j) = (i == j) ? 3.0 + i : 0.5 * (i - j) + 0.25;
+      }
+    }
+    S21Matrix dense = t.ToDense();
+    S21Vector b = Sequence(6);
+    S21Matrix rhs = Dense(6, 4, 3);
+
+    // Act
+    S21Vector x = t.Solve(b);
+    S21Matrix solution = t.Solve(rhs);
+
+    // Assert
+    ExpectNear(dense * x, b, 1e-12);
+    ASSERT_TRUE(dense * solution == rhs);
+    ASSERT_TRUE(t.MulMatrix(rhs) == dense * rhs);
+    ExpectNear(t.MulVector(b), dense * b, 1e-12);
+    ASSERT_NEAR(t.Determinant(), 3.0 * 4 * 5 * 6 * 7 * 8, 1e-9);
+    ASSERT_TRUE(S21TriangularMatrix(dense, triangle).ToDense() == dense);
+  }
+}
+
+TEST(StructuredSuite, TriangularStructure) {
+  // Arrange
+  S21TriangularMatrix lower(3, S21Triangle::kLower);
+  const S21TriangularMatrix& view = lower;
+
+  // Act & Assert
+  ASSERT_THROW(lower(0, 2), std::out_of_range);
+  ASSERT_DOUBLE_EQ(view(0, 2), 0.0);
+  ASSERT_THROW(lower.Solve(Sequence(3)), std::invalid_argument);
+  ASSERT_THROW(S21TriangularMatrix(Dense(3, 3, 1), S21Triangle::kLower),
+               std::invalid_argument);
+}
+
+// --- Тестирование ленточных матриц ---
+TEST(StructuredSuite, BandMatchesDense) {
+  // Arrange
+  S21BandMatrix band(9, 2, 1);
+  for (int i = 0; i < 9; ++i) {
+    for (int j = std::max(0, i - 2); j <= std::min(8, i + 1); ++j) {
+      band(i, j) = ((i * 7 + j * 3) % 5) - 1.5;
+    }
+  }
+  S21Matrix dense = band.ToDense();
+  S21Vector b = Sequence(9);
+  S21Matrix other = Dense(9, 2, 4);
+
+  // Act
+  S21Vector x = band.Solve(b);
+
+  // Assert
+  ExpectNear(dense * x, b, 1e-10);
+  ASSERT_NEAR(band.Determinant(), dense.Determinant(),
+              1e-9 * std::fabs(dense.Determinant()));
+  ExpectNear(band.MulVector(b), dense * b, 1e-12);
+  ASSERT_TRUE(band.MulMatrix(other) == dense * other);
+  ASSERT_TRUE(S21BandMatrix(dense, 2, 1).ToDense() == dense);
+  ASSERT_THROW(S21BandMatrix(dense, 1, 1), std::invalid_argument);
+  ASSERT_THROW(band(0, 2), std::out_of_range);
+}
+
+TEST(StructuredSuite, TridiagonalThomas) {
+  // Arrange: матрица 2, -1 порядка n, определитель n + 1
+  const int n = 1000;
+  S21BandMatrix t(n, 1, 1);
+  for (int i = 0; i < n; ++i) {
+    t(i, i) = 2.0;
+    if (i > 0) t(i, i - 1) = -1.0;
+    if (i + 1 < n) t(i, i + 1) = -1.0;
+  }
+  S21Vector b = Sequence(n);
+
+  // Act
+  S21Vector thomas = t.SolveTridiagonal(b);
+  S21Vector general = t.Solve(b);
+
+  // Assert
+  ExpectNear(t.MulVector(thomas), b, 1e-8);
+  ExpectNear(thomas, general, 1e-6);
+  ASSERT_NEAR(t.Determinant(), n + 1.0, 1e-6);
+  ASSERT_THROW(S21BandMatrix(4, 2, 0).SolveTridiagonal(Sequence(4)),
+               std::invalid_argument);
+}
+
+TEST(StructuredSuite, SingularBand) {
+  // Arrange
+  S21BandMatrix band(4, 1, 1);
+  band(0, 0) = 1.0;
+  band(1, 1) = 1.0;
+  band(3, 3) = 1.0;
+
+  // Act & Assert
+  ASSERT_DOUBLE_EQ(band.Determinant(), 0.0);
+  ASSERT_THROW(band.Solve(Sequence(4)), std::invalid_argument);
+  ASSERT_THROW(S21BandMatrix(3, 3, 0), std::invalid_argument);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "s21_matrix_oop.h"
+
+// --- Тестирование конструкторов S21Vector ---
+TEST(VectorSuite, Constructors) {
+  // Arrange & Act
+  S21Vector v1;
+  S21Vector v2(5);
+  v2(4) = 7.0;
+  S21Vector v3(v2);
+  S21Vector v4(std::move(v2));
+
+  // Assert
+  ASSERT_EQ(v1.get_size(), 3);
+  ASSERT_EQ(v3.get_size(), 5);
+  ASSERT_DOUBLE_EQ(v3(4), 7.0);
+  ASSERT_DOUBLE_EQ(v4(4), 7.0);
+  ASSERT_EQ(v2.get_size(), 0);
+  ASSERT_THROW(S21Vector(0), std::invalid_argument);
+  ASSERT_THROW(v3(5), std::out_of_range);
+}
+
+// --- Тестирование Dot, Axpy и норм ---
+TEST(VectorSuite, DotAxpyNorms) {
+  // Arrange
+  S21Vector x(3);
+  S21Vector y(3);
+  x(0) = 1;
+  x(1) = -2;
+  x(2) = 2;
+  y(0) = 3;
+  y(1) = 1;
+  y(2) = 0.5;
+
+  // Act
+  double dot = x.Dot(y);
+  y.Axpy(2.0, x);
+
+  // Assert
+  ASSERT_DOUBLE_EQ(dot, 2.0);
+  ASSERT_DOUBLE_EQ(y(0), 5.0);
+  ASSERT_DOUBLE_EQ(y(1), -3.0);
+  ASSERT_DOUBLE_EQ(y(2), 4.5);
+  ASSERT_DOUBLE_EQ(x.Norm1(), 5.0);
+  ASSERT_DOUBLE_EQ(x.Norm2(), 3.0);
+  ASSERT_DOUBLE_EQ(x.NormInf(), 2.0);
+  ASSERT_THROW(x.Dot(S21Vector(2)), std::invalid_argument);
+}
+
+TEST(VectorSuite, Norm2WithoutOverflow) {
+  S21Vector v(2);
+  v(0) = 3e200;
+  v(1) = 4e200;
+  ASSERT_DOUBLE_EQ(v.Norm2(), 5e200);
+  // NaN не теряется при повторном масштабированном проходе
+  S21Vector invalid(3);
+  invalid(0) = std::numeric_limits<double>::quiet_NaN();
+  ASSERT_TRUE(std::isnan(invalid.Norm2()));
+  ASSERT_TRUE(std::isnan(invalid.NormInf()));
+}
+
+TEST(VectorSuite, LongVectorDot) {
+  // Длинный вектор проходит через блочную параллельную редукцию
+  S21Vector x(300000);
+  S21Vector y(300000);
+  for (int i = 0; i < x.get_size(); ++i) {
+    x(i) = 1.0;
+    y(i) = (i % 2 == 0) ? 2.0 : -1.0;
+  }
+  ASSERT_DOUBLE_EQ(x.Dot(y), 150000.0);
+}
+
+// --- Тестирование произведения матрицы на вектор ---
+TEST(VectorSuite, MatrixVectorProducts) {
+  // Arrange
+  S21Matrix a(2, 3);
+  a(0, 0) = 1;
+  a(0, 1) = 2;
+  a(0, 2) = 3;
+  a(1, 0) = 4;
+  a(1, 1) = 5;
+  a(1, 2) = 6;
+  S21Vector x(3);
+  x(0) = 1;
+  x(1) = 0;
+  x(2) = -1;
+  S21Vector z(2);
+  z(0) = 1;
+  z(1) = 2;
+
+  // Act
+  S21Vector y = a * x;
+  S21Vector t = a.MulTransposedVector(z);
+
+  // Assert
+  ASSERT_EQ(y.get_size(), 2);
+  ASSERT_DOUBLE_EQ(y(0), -2.0);
+  ASSERT_DOUBLE_EQ(y(1), -2.0);
+  ASSERT_EQ(t.get_size(), 3);
+  ASSERT_DOUBLE_EQ(t(0), 9.0);
+  ASSERT_DOUBLE_EQ(t(1), 12.0);
+  ASSERT_DOUBLE_EQ(t(2), 15.0);
+  ASSERT_THROW(a.MulVector(z), std::invalid_argument);
+  ASSERT_THROW(a.MulTransposedVector(x), std::invalid_argument);
+}